@@ -0,0 +1,101 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_document_file.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_document_file.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_dynamic_settings.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_dynamic_settings.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_error.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_error.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_interpreter.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_interpreter.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_optimiser.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_optimiser.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_parse_tree.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_parse_tree.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_parser.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_parser.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_program.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_program.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_scanner.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_scanner.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_stack.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_stack.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_static_pass.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_static_pass.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_lexical_pass.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_lexical_pass.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_link_pass.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_link_pass.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_table.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_table.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_value.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_value.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/code_ast_fields.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/code_ast_fields.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/code_settings_constants.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/code_settings_constants.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/forscape_interpreter_gen.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/forscape_interpreter_gen.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/forscape_optimiser_gen.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/forscape_optimiser_gen.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_keywords.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_keywords.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_shorthand.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_shorthand.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_themes.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_themes.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_change_settings.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_change_settings.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_comment.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_comment.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_indent.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_indent.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_line.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_line.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_list.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_list.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_pair.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_pair.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_phrase.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_phrase.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_text.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_text.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_insert_chars.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_insert_chars.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_remove_chars.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_remove_chars.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_construct.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_construct.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_constructs/typeset_accentbar.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_constructs/typeset_accentbar.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_constructs/typeset_settings.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_constructs/typeset_settings.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_controller.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_controller.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_line.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_line.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_marker.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_marker.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_model.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_model.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_node_pool.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_node_pool.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_parser.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_parser.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_phrase.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_phrase.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_selection.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_selection.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_subphrase.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_subphrase.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_text.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_text.cpp.o.d"
+  "CMakeFiles/ForscapeTests.dir/test_driver.cpp.o"
+  "CMakeFiles/ForscapeTests.dir/test_driver.cpp.o.d"
+  "ForscapeTests"
+  "ForscapeTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ForscapeTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,64 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/forscape_document_file.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_document_file.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_document_file.cpp.o.d"
+  "/root/repo/src/forscape_dynamic_settings.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_dynamic_settings.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_dynamic_settings.cpp.o.d"
+  "/root/repo/src/forscape_error.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_error.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_error.cpp.o.d"
+  "/root/repo/src/forscape_interpreter.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_interpreter.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_interpreter.cpp.o.d"
+  "/root/repo/src/forscape_optimiser.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_optimiser.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_optimiser.cpp.o.d"
+  "/root/repo/src/forscape_parse_tree.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_parse_tree.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_parse_tree.cpp.o.d"
+  "/root/repo/src/forscape_parser.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_parser.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_parser.cpp.o.d"
+  "/root/repo/src/forscape_program.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_program.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_program.cpp.o.d"
+  "/root/repo/src/forscape_scanner.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_scanner.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_scanner.cpp.o.d"
+  "/root/repo/src/forscape_stack.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_stack.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_stack.cpp.o.d"
+  "/root/repo/src/forscape_static_pass.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_static_pass.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_static_pass.cpp.o.d"
+  "/root/repo/src/forscape_symbol_lexical_pass.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_lexical_pass.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_lexical_pass.cpp.o.d"
+  "/root/repo/src/forscape_symbol_link_pass.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_link_pass.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_link_pass.cpp.o.d"
+  "/root/repo/src/forscape_symbol_table.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_table.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_symbol_table.cpp.o.d"
+  "/root/repo/src/forscape_value.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_value.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/forscape_value.cpp.o.d"
+  "/root/repo/src/generated/code_ast_fields.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/code_ast_fields.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/code_ast_fields.cpp.o.d"
+  "/root/repo/src/generated/code_settings_constants.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/code_settings_constants.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/code_settings_constants.cpp.o.d"
+  "/root/repo/src/generated/forscape_interpreter_gen.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/forscape_interpreter_gen.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/forscape_interpreter_gen.cpp.o.d"
+  "/root/repo/src/generated/forscape_optimiser_gen.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/forscape_optimiser_gen.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/forscape_optimiser_gen.cpp.o.d"
+  "/root/repo/src/generated/typeset_keywords.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_keywords.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_keywords.cpp.o.d"
+  "/root/repo/src/generated/typeset_shorthand.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_shorthand.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_shorthand.cpp.o.d"
+  "/root/repo/src/generated/typeset_themes.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_themes.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/generated/typeset_themes.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_command_change_settings.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_change_settings.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_change_settings.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_command_comment.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_comment.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_comment.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_command_indent.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_indent.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_indent.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_command_line.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_line.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_line.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_command_list.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_list.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_list.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_command_pair.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_pair.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_pair.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_command_phrase.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_phrase.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_phrase.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_command_text.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_text.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_command_text.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_insert_chars.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_insert_chars.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_insert_chars.cpp.o.d"
+  "/root/repo/src/typeset_commands/typeset_remove_chars.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_remove_chars.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_commands/typeset_remove_chars.cpp.o.d"
+  "/root/repo/src/typeset_construct.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_construct.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_construct.cpp.o.d"
+  "/root/repo/src/typeset_constructs/typeset_accentbar.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_constructs/typeset_accentbar.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_constructs/typeset_accentbar.cpp.o.d"
+  "/root/repo/src/typeset_constructs/typeset_settings.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_constructs/typeset_settings.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_constructs/typeset_settings.cpp.o.d"
+  "/root/repo/src/typeset_controller.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_controller.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_controller.cpp.o.d"
+  "/root/repo/src/typeset_line.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_line.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_line.cpp.o.d"
+  "/root/repo/src/typeset_marker.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_marker.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_marker.cpp.o.d"
+  "/root/repo/src/typeset_model.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_model.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_model.cpp.o.d"
+  "/root/repo/src/typeset_node_pool.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_node_pool.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_node_pool.cpp.o.d"
+  "/root/repo/src/typeset_parser.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_parser.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_parser.cpp.o.d"
+  "/root/repo/src/typeset_phrase.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_phrase.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_phrase.cpp.o.d"
+  "/root/repo/src/typeset_selection.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_selection.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_selection.cpp.o.d"
+  "/root/repo/src/typeset_subphrase.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_subphrase.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_subphrase.cpp.o.d"
+  "/root/repo/src/typeset_text.cpp" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_text.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/root/repo/src/typeset_text.cpp.o.d"
+  "/root/repo/test/test_driver.cpp" "CMakeFiles/ForscapeTests.dir/test_driver.cpp.o" "gcc" "CMakeFiles/ForscapeTests.dir/test_driver.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
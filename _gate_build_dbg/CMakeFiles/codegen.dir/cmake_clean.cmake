@@ -0,0 +1,30 @@
+file(REMOVE_RECURSE
+  "/root/repo/src/generated/code_ast_fields.cpp"
+  "/root/repo/src/generated/code_ast_fields.h"
+  "/root/repo/src/generated/code_error_types.h"
+  "/root/repo/src/generated/code_parsenode_ops.h"
+  "/root/repo/src/generated/code_predefined.h"
+  "/root/repo/src/generated/code_settings_constants.cpp"
+  "/root/repo/src/generated/code_settings_constants.h"
+  "/root/repo/src/generated/code_tokentype.h"
+  "/root/repo/src/generated/construct_codes.h"
+  "/root/repo/src/generated/forscape_interpreter_gen.cpp"
+  "/root/repo/src/generated/forscape_optimiser_gen.cpp"
+  "/root/repo/src/generated/semantic_tags.h"
+  "/root/repo/src/generated/typeset_closesymbol.h"
+  "/root/repo/src/generated/typeset_keywords.cpp"
+  "/root/repo/src/generated/typeset_keywords.h"
+  "/root/repo/src/generated/typeset_shorthand.cpp"
+  "/root/repo/src/generated/typeset_shorthand.h"
+  "/root/repo/src/generated/typeset_themes.cpp"
+  "/root/repo/src/generated/typeset_themes.h"
+  "/root/repo/src/generated/unicode_subscripts.h"
+  "/root/repo/src/generated/unicode_superscripts.h"
+  "/root/repo/src/generated/unicode_zerowidth.h"
+  "CMakeFiles/codegen"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/codegen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
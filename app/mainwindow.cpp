@@ -4,6 +4,7 @@
 #include <forscape_message.h>
 #include <forscape_scanner.h>
 #include <forscape_serial.h>
+#include <forscape_document_file.h>
 #include <forscape_serial_unicode.h>
 #include <forscape_parser.h>
 #include <forscape_program.h>
@@ -419,10 +420,9 @@ void MainWindow::pollInterpreterThread(){
                 break;
             default:
                 auto model = editor->getModel();
-                Typeset::Selection c = Program::instance()->parse_tree.getSelection(interpreter.error_node);
+                Typeset::Selection c = Program::instance()->executable_tree.getSelection(interpreter.error_node);
                 Program::instance()->error_stream.fail(c, interpreter.error_code);
                 Code::Error::writeErrors(model->errors, output, editor);
-                output->calculateSizes();
                 output->updateLayout();
                 console->updateModel();
                 console->scrollToBottom();
@@ -623,7 +623,7 @@ void MainWindow::checkOutput(){
                 break;
             case Forscape::InterpreterOutput::CreatePlot:{
                 const PlotCreate& plt = *static_cast<PlotCreate*>(msg);
-                addPlot(plt.title, plt.x_label, plt.y_label);
+                addPlot(plt.title, plt.x_label, plt.y_label, plt.id);
                 delete msg;
                 break;
             }
@@ -633,6 +633,12 @@ void MainWindow::checkOutput(){
                 delete msg;
                 break;
             }
+            case Forscape::InterpreterOutput::AppendDiscreteSeries:{
+                const PlotAppend& append = *static_cast<PlotAppend*>(msg);
+                appendSeries(append.data, append.id);
+                delete msg;
+                break;
+            }
             default: assert(false);
         }
 
@@ -716,6 +722,7 @@ bool MainWindow::saveAs(QString path, Forscape::Typeset::Model* saved_model) {
     std::filesystem::path std_path = std::filesystem::canonical(toCppPath(active_file_path));
     saved_model->write_time = std::filesystem::file_time_type::clock::now();
     project_browser->saveModel(saved_model, std_path);
+    if(saved_model->path == std_path) saved_model->markSaved();
 
     updateRecentProjectsFromCurrent();
 
@@ -728,19 +735,15 @@ void MainWindow::openProject(QString path){
     if(promptForUnsavedChanges("changing project")) return;
 
     std::filesystem::path std_path = toCppPath(path);
-    std::ifstream in(std_path);
-    if(!in.is_open()){
+    Forscape::DocumentFile in(std_path);
+    if(!in.isOpen()){
         QMessageBox messageBox;
         messageBox.critical(nullptr, "Error", "Could not open \"" + path + "\" to read.");
         messageBox.setFixedSize(500,200);
         return;
     }
 
-    std::stringstream buffer;
-    buffer << in.rdbuf();
-
-    std::string src = buffer.str();
-    src.erase( std::remove(src.begin(), src.end(), '\r'), src.end() );
+    std::string_view src = in.serial();
 
     if(isIllFormedUtf8(src)){
         QMessageBox messageBox;
@@ -807,18 +810,26 @@ void MainWindow::removeFile(Forscape::Typeset::Model* model) noexcept {
     updateViewJumpPointElements();
 }
 
-void MainWindow::addPlot(const std::string& title, const std::string& x_label, const std::string& y_label){
+void MainWindow::addPlot(const std::string& title, const std::string& x_label, const std::string& y_label, size_t id){
     active_plot = new Plot(title, x_label, y_label);
+    plots[id] = active_plot;
     active_plot->show();
     connect(this, SIGNAL(destroyed()), active_plot, SLOT(deleteLater()));
 }
 
-void MainWindow::addSeries(const std::vector<std::pair<double, double>>& data) const alloc_except {
+void MainWindow::addSeries(const Forscape::PlotColumns& data) const alloc_except {
     assert(active_plot);
     active_plot->addSeries(data);
     active_plot->update();
 }
 
+void MainWindow::appendSeries(const Forscape::PlotColumns& data, size_t id) const alloc_except {
+    auto lookup = plots.find(id);
+    assert(lookup != plots.end());
+    lookup->second->appendSeries(data);
+    lookup->second->update();
+}
+
 QString MainWindow::getLastDir(){
     if(settings.contains(LAST_DIRECTORY)){
         QString last_dir = settings.value(LAST_DIRECTORY).toString();
@@ -1011,9 +1022,8 @@ void MainWindow::on_actionUnicode_triggered(){
 }
 
 void MainWindow::onTextChanged(){
-    //EVENTUALLY: doing a deep comparison is terrible. Need a more efficient way to determine if the document is saved
     auto model = editor->getModel();
-    const bool changed_from_save = !model->isSavedDeepComparison();
+    const bool changed_from_save = !model->isSaved();
     const bool never_saved = active_file_path.isEmpty();
     const bool saveable = changed_from_save || never_saved;
     setWindowTitle(
@@ -1039,7 +1049,7 @@ void MainWindow::onTextChanged(){
 }
 
 void MainWindow::onModelChanged(Forscape::Typeset::Model* model) {
-    const bool changed_from_save = !model->isSavedDeepComparison();
+    const bool changed_from_save = !model->isSaved();
     if(changed_from_save) modified_files.insert(model);
     else modified_files.erase(model);
     ui->actionSave_All->setDisabled(modified_files.empty());
@@ -1151,8 +1161,12 @@ void MainWindow::checkForChanges(){
         QMessageBox::Yes|QMessageBox::No
     );
 
-    if(reply == QMessageBox::Yes) on_actionReload_triggered();
-    else onTextChanged();
+    if(reply == QMessageBox::Yes){
+        on_actionReload_triggered();
+    }else{
+        model->markModified();
+        onTextChanged();
+    }
 }
 
 void MainWindow::on_actionPreferences_triggered(){
@@ -1285,8 +1299,8 @@ bool MainWindow::on_actionSave_All_triggered() {
 void MainWindow::on_actionReload_triggered() {
     Forscape::Typeset::Model* model = editor->getModel();
     assert(!model->path.empty());
-    std::ifstream in(model->path);
-    if(!in.is_open()){
+    Forscape::DocumentFile in(model->path);
+    if(!in.isOpen()){
         QMessageBox messageBox;
         QString str = toQString(model->path);
         messageBox.critical(nullptr, "Error", "Could not open \"" + str + "\" to read.");
@@ -1294,11 +1308,7 @@ void MainWindow::on_actionReload_triggered() {
         return;
     }
 
-    std::stringstream buffer;
-    buffer << in.rdbuf();
-
-    std::string src = buffer.str();
-    src.erase( std::remove(src.begin(), src.end(), '\r'), src.end() );
+    std::string_view src = in.serial();
 
     if(isIllFormedUtf8(src)){
         QMessageBox messageBox;
@@ -1317,9 +1327,10 @@ void MainWindow::on_actionReload_triggered() {
 
     Forscape::Typeset::Controller& controller = editor->getController();
     controller.selectAll();
-    controller.insertSerial(src);
+    controller.insertSerial(std::string(src));
     //EVENTUALLY: leave the controller at the same place as before, if possible
     model->resetUndoRedo();
+    model->markSaved();
 
     onTextChanged();
     editor->updateModel();
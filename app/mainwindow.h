@@ -21,6 +21,7 @@ class Splitter;
 
 namespace Forscape{
 class ProjectBrowser;
+struct PlotColumns;
 
 namespace Typeset {
 class Console;
@@ -59,6 +60,7 @@ private:
     Splitter* vertical_splitter;
     Preferences* preferences;
     Plot* active_plot = nullptr;
+    FORSCAPE_UNORDERED_MAP<size_t, Plot*> plots; //By interpreter id, for streaming appends
     QString project_path;
     QString active_file_path;
     QTimer interpreter_poll_timer;
@@ -158,8 +160,9 @@ private:
     bool savePrompt();
     bool saveAs(QString name);
     bool saveAs(QString path, Forscape::Typeset::Model* model);
-    void addPlot(const std::string& title, const std::string& x_label, const std::string& y_label);
-    void addSeries(const std::vector<std::pair<double, double>>& data) const alloc_except;
+    void addPlot(const std::string& title, const std::string& x_label, const std::string& y_label, size_t id);
+    void addSeries(const Forscape::PlotColumns& data) const alloc_except;
+    void appendSeries(const Forscape::PlotColumns& data, size_t id) const alloc_except;
     QString getLastDir();
     void setEditorToModelAndLine(Forscape::Typeset::Model* model, size_t line);
     void loadRecentProjects();
@@ -4,6 +4,8 @@
 
 #include <QPainter>
 #include <QPainterPath>
+#include <algorithm>
+#include <cmath>
 #include <typeset_painter.h>
 #include <typeset_themes.h>
 
@@ -13,18 +15,156 @@
 
 class Plot::DiscreteSeries : public Plot::Series {
 private:
-    const std::vector<std::pair<double, double>> data;
+    std::vector<Forscape::PlotColumns> chunks; //Streamed points stay in the chunks they arrived in
+    size_t size = 0;
+
+    //Small appends, such as the points of a streamed scalar plot, are copied into a batch owned by the series
+    //rather than kept as a chunk each. The batch is the last chunk until it fills or a larger chunk arrives.
+    static constexpr size_t BATCH_POINTS = 256;
+    static constexpr size_t MAX_BATCHED_APPEND = BATCH_POINTS / 8;
+    double* batch_x = nullptr;
+    double* batch_y = nullptr;
+
+    //The chunks are interleaved into the path drawn, reducing large series to the first, min, max, and last point
+    //of each run through a pixel column. This is pixel-exact for a line plot. Appended points extend the path,
+    //which is only rebuilt when the zoom changes.
+    struct Run {
+        double column;
+        size_t first;
+        size_t low;
+        size_t high;
+        size_t last;
+        QPointF first_pt;
+        QPointF low_pt;
+        QPointF high_pt;
+        QPointF last_pt;
+    };
+    mutable std::vector<QPointF> path;
+    mutable size_t path_points = 0; //Points of the series which the path covers
+    mutable size_t path_chunk = 0; //The chunk the path ends in, so extending it skips the chunks it covers
+    mutable size_t path_chunk_start = 0; //Index in the series of the first point of that chunk
+    mutable Run run; //The last run is left open, since appended points may continue it
+    mutable bool decimated = false;
+    mutable double path_x = 0;
+    mutable double path_w = 0;
+    mutable int path_columns = 0;
+    static constexpr size_t POINTS_PER_COLUMN = 4;
 
 public:
-    DiscreteSeries(const std::vector<std::pair<double, double>>& discrete_data)
-        : data(discrete_data) {}
+    DiscreteSeries(const Forscape::PlotColumns& discrete_data) {
+        append(discrete_data);
+    }
+
+    virtual void append(const Forscape::PlotColumns& data) override final {
+        if(data.size == 0) return;
+
+        for(size_t i = 0; i < data.size; i++){
+            min_x = std::min(min_x, data.x.get()[i]);
+            max_x = std::max(max_x, data.x.get()[i]);
+            min_y = std::min(min_y, data.y.get()[i]);
+            max_y = std::max(max_y, data.y.get()[i]);
+        }
+
+        if(data.size <= MAX_BATCHED_APPEND){
+            if(chunks.empty() || chunks.back().x.get() != batch_x || chunks.back().size + data.size > BATCH_POINTS)
+                startBatch();
+            Forscape::PlotColumns& batch = chunks.back();
+            std::copy(data.x.get(), data.x.get() + data.size, batch_x + batch.size);
+            std::copy(data.y.get(), data.y.get() + data.size, batch_y + batch.size);
+            batch.size += data.size;
+        }else{
+            chunks.push_back(data);
+        }
+        size += data.size;
+    }
 
 private:
-    const QPointF* asQPointFArray() const noexcept { return reinterpret_cast<const QPointF*>(data.data()); }
-    const QPointF& qpoint(size_t index) const noexcept { return asQPointFArray()[index]; }
+    void startBatch() {
+        batch_x = new double[BATCH_POINTS];
+        batch_y = new double[BATCH_POINTS];
+        chunks.push_back(Forscape::PlotColumns{
+            std::shared_ptr<const double>(batch_x, std::default_delete<double[]>()),
+            std::shared_ptr<const double>(batch_y, std::default_delete<double[]>()),
+            0});
+    }
 
-    void drawLinear(QPainter& painter) const {
-        for(size_t i = 1; i < data.size(); i++) painter.drawLine(qpoint(i-1), qpoint(i));
+    void extendPath() const {
+        const double columns_per_x = path_columns / path_w;
+        for(;;){
+            const Forscape::PlotColumns& chunk = chunks[path_chunk];
+            const size_t start = path_chunk_start;
+            for(size_t i = path_points - start; i < chunk.size; i++){
+                const size_t index = start + i;
+                const QPointF pt(chunk.x.get()[i], chunk.y.get()[i]);
+                if(!decimated){
+                    path.push_back(pt);
+                    continue;
+                }
+
+                const double column = std::floor((pt.x() - path_x) * columns_per_x);
+                if(index != 0 && column == run.column){
+                    run.last = index;
+                    run.last_pt = pt;
+                    if(pt.y() < run.low_pt.y()){
+                        run.low = index;
+                        run.low_pt = pt;
+                    }
+                    if(pt.y() > run.high_pt.y()){
+                        run.high = index;
+                        run.high_pt = pt;
+                    }
+                }else{
+                    if(index != 0) closeRun();
+                    run = Run{column, index, index, index, index, pt, pt, pt, pt};
+                }
+            }
+            path_points = start + chunk.size;
+
+            //The last chunk may still grow as a batch, so the path stays in it
+            if(path_chunk + 1 == chunks.size()) return;
+            path_chunk_start = path_points;
+            path_chunk++;
+        }
+    }
+
+    void closeRun() const {
+        size_t kept = run.first;
+        path.push_back(run.first_pt);
+        auto keep = [&](size_t index, const QPointF& pt){
+            if(index == kept) return;
+            path.push_back(pt);
+            kept = index;
+        };
+
+        if(run.low < run.high){
+            keep(run.low, run.low_pt);
+            keep(run.high, run.high_pt);
+        }else{
+            keep(run.high, run.high_pt);
+            keep(run.low, run.low_pt);
+        }
+        keep(run.last, run.last_pt);
+    }
+
+    void drawLinear(QPainter& painter, double scene_x, double scene_w, int columns) const {
+        const bool decimate = size > POINTS_PER_COLUMN*static_cast<size_t>(columns);
+        if(decimate != decimated || (decimate && (columns != path_columns || scene_x != path_x || scene_w != path_w))){
+            path.clear();
+            path_points = 0;
+            path_chunk = 0;
+            path_chunk_start = 0;
+            decimated = decimate;
+            path_x = scene_x;
+            path_w = scene_w;
+            path_columns = columns;
+        }
+
+        if(path_points < size) extendPath();
+
+        const size_t closed = path.size();
+        if(decimated) closeRun();
+        painter.drawPolyline(path.data(), static_cast<int>(path.size()));
+        path.resize(closed);
     }
 
     //EVENTUALLY: cubic spline fitting
@@ -32,12 +172,13 @@ private:
     void drawSquares(QPainter& painter) const {
         constexpr double HALF_WIDTH = 4;
         constexpr double WIDTH = 2*HALF_WIDTH;
-        for(const auto& datum : data)
-            painter.drawRect(datum.first-HALF_WIDTH, datum.second-HALF_WIDTH, WIDTH, WIDTH);
+        for(const Forscape::PlotColumns& chunk : chunks)
+            for(size_t i = 0; i < chunk.size; i++)
+                painter.drawRect(chunk.x.get()[i]-HALF_WIDTH, chunk.y.get()[i]-HALF_WIDTH, WIDTH, WIDTH);
     }
 
-    virtual void draw(QPainter& painter) const override final {
-        drawLinear(painter);
+    virtual void draw(QPainter& painter, double scene_x, double scene_w, int columns) const override final {
+        drawLinear(painter, scene_x, scene_w, columns);
     }
 };
 
@@ -51,19 +192,43 @@ Plot::~Plot(){
     for(Series* s : series) delete s;
 }
 
-void Plot::addSeries(const std::vector<std::pair<double, double>>& discrete_data){
-    series.push_back(new DiscreteSeries(discrete_data));
-    for(const auto& entry : discrete_data){
-        min_x = std::min(min_x, entry.first);
-        max_x = std::max(max_x, entry.first);
-        min_y = std::min(min_y, entry.second);
-        max_y = std::max(max_y, entry.second);
-    }
+void Plot::addSeries(const Forscape::PlotColumns& discrete_data){
+    DiscreteSeries* added = new DiscreteSeries(discrete_data);
+    series.push_back(added);
+    includeBounds(*added);
 
     scene_x = min_x;
     scene_y = min_y;
-    scene_w = max_x - min_x;
-    scene_h = max_y - min_y;
+    scene_w = max_x > min_x ? max_x - min_x : 1;
+    scene_h = max_y > min_y ? max_y - min_y : 1;
+}
+
+/// Grows an axis to contain [min, max], at least doubling it so that streamed points rarely change the zoom
+static void growAxis(double& start, double& extent, double min, double max) noexcept {
+    if(max > start + extent) extent = std::max(2*extent, max - start);
+    if(min < start){
+        const double end = start + extent;
+        start = std::min(min, end - 2*extent);
+        extent = end - start;
+    }
+}
+
+void Plot::appendSeries(const Forscape::PlotColumns& discrete_data){
+    if(series.empty()) return addSeries(discrete_data);
+
+    Series* extended = series.back();
+    extended->append(discrete_data);
+    includeBounds(*extended);
+
+    growAxis(scene_x, scene_w, min_x, max_x);
+    growAxis(scene_y, scene_h, min_y, max_y);
+}
+
+void Plot::includeBounds(const Series& s) noexcept {
+    min_x = std::min(min_x, s.min_x);
+    max_x = std::max(max_x, s.max_x);
+    min_y = std::min(min_y, s.min_y);
+    max_y = std::max(max_y, s.max_y);
 }
 
 void Plot::setTitle(const std::string& str) noexcept {
@@ -93,7 +258,7 @@ void Plot::paintEvent(QPaintEvent* event){
     line_pen.setWidthF(2);
     line_pen.setCosmetic(true);
     painter.setPen(line_pen);
-    for(const Series* s : series) s->draw(painter);
+    for(const Series* s : series) s->draw(painter, scene_x, scene_w, plotPixelWidth());
     painter.resetTransform();
     painter.setPen(pen);
 
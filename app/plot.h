@@ -4,13 +4,15 @@
 #define FORSCAPE_PLOT_H
 
 #include <QWidget>
+#include <forscape_message.h>
 class QPainter;
 
 class Plot : public QWidget {
 public:
     Plot(const std::string& title, const std::string& x_label, const std::string& y_label);
     ~Plot();
-    void addSeries(const std::vector<std::pair<double, double>>& discrete_data);
+    void addSeries(const Forscape::PlotColumns& discrete_data);
+    void appendSeries(const Forscape::PlotColumns& discrete_data);
     void setTitle(const std::string& str) noexcept;
     void setXLabel(const std::string& str) noexcept;
     void setYLabel(const std::string& str) noexcept;
@@ -33,9 +35,9 @@ private:
     double sceneRightX() const noexcept { return scene_x + scene_w; }
     double sceneTopY() const noexcept { return scene_y + scene_h; }
     double min_x = std::numeric_limits<double>::max();
-    double max_x = std::numeric_limits<double>::min();
+    double max_x = std::numeric_limits<double>::lowest();
     double min_y = std::numeric_limits<double>::max();
-    double max_y = std::numeric_limits<double>::min();
+    double max_y = std::numeric_limits<double>::lowest();
 
     static constexpr size_t MARGIN_TOP = 50;
     static constexpr size_t TEXT_MARGIN = 10;
@@ -49,12 +51,18 @@ private:
 
     class Series {
     public:
+        double min_x = std::numeric_limits<double>::max();
+        double max_x = std::numeric_limits<double>::lowest();
+        double min_y = std::numeric_limits<double>::max();
+        double max_y = std::numeric_limits<double>::lowest();
         virtual ~Series() noexcept {}
-        virtual void draw(QPainter& painter) const = 0;
+        virtual void append(const Forscape::PlotColumns& data) = 0;
+        virtual void draw(QPainter& painter, double scene_x, double scene_w, int columns) const = 0;
     };
     class DiscreteSeries;
 
     std::vector<Series*> series;
+    void includeBounds(const Series& s) noexcept;
 
     virtual void paintEvent(QPaintEvent* event) override;
 };
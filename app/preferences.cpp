@@ -3,6 +3,7 @@
 
 #include "forscape_common.h"
 #include "keywordsubstitutioneditor.h"
+#include <typeset_model.h>
 #include <typeset_themes.h>
 #include <typeset_view.h>
 #include <QColorDialog>
@@ -163,8 +164,10 @@ void Preferences::on_symbolsAddButton_clicked(){
 void Preferences::on_integralCheckBox_toggled(bool checked){
     Forscape::Typeset::integral_bounds_vertical = checked;
 
-    for(Forscape::Typeset::View* view : Forscape::Typeset::View::all_views)
+    for(Forscape::Typeset::View* view : Forscape::Typeset::View::all_views){
+        view->getModel()->invalidateLayout();
         view->updateModel();
+    }
 }
 
 
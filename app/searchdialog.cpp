@@ -2,6 +2,7 @@
 #include "ui_searchdialog.h"
 
 #include <mainwindow.h>
+#include <forscape_program.h>
 #include <forscape_serial.h>
 #include <forscape_unicode.h>
 #include <typeset_markerlink.h>
@@ -38,8 +39,6 @@ SearchDialog::SearchDialog(QWidget* parent, Typeset::View* in, Typeset::View* ou
     setWindowTitle("Search / Replace");
     setSizePolicy(QSizePolicy::Policy::Preferred, QSizePolicy::Policy::Minimum);
     resize(width(), 1);
-
-    //EVENTUALLY: support multi-file search, e.g. find in project
 }
 
 SearchDialog::~SearchDialog(){
@@ -200,17 +199,30 @@ void SearchDialog::on_findAllButton_clicked(){
         m->lastText()->tags.push_back( SemanticTag(lead.size()-1, SEM_STRING) );
         m->lastText()->tags.push_back( SemanticTag(lead.size()+search_str.size()+1, SEM_DEFAULT) );
 
-        if(hits.empty()){
+        //Without a selection, every file of the project is searched
+        std::vector<Typeset::Selection> project_hits;
+        bool use_sel = ui->selectionBox->isVisible() && ui->selectionBox->isChecked();
+        if(!use_sel){
+            bool use_case = ui->caseBox->isChecked();
+            bool word = ui->wordBox->isChecked();
+            const std::vector<Typeset::Model*>& files = Program::instance()->allFiles();
+            if(std::find(files.begin(), files.end(), in->getModel()) == files.end())
+                in->getModel()->search(search_str, project_hits, use_case, word);
+            Program::instance()->search(search_str, project_hits, use_case, word);
+        }
+        const std::vector<Typeset::Selection>& listed = use_sel ? hits : project_hits;
+
+        if(listed.empty()){
             m->appendLine();
             Typeset::Text* t = m->lastText();
             t->setString("NO RESULTS");
             t->tags.push_back( SemanticTag(0, SEM_ERROR) );
         }
 
-        for(const Typeset::Selection& sel : hits){
+        for(const Typeset::Selection& sel : listed){
             m->appendLine();
             Typeset::Text* t = m->lastText();
-            t->getParent()->appendConstruct( new Typeset::MarkerLink(sel.getStartLine(), in, in->getModel()) );
+            t->getParent()->appendConstruct( new Typeset::MarkerLink(sel.getStartLine(), in, sel.getModel()) );
         }
     }
 
@@ -37,6 +37,7 @@ def main():
     execfile('construct_codes.py')
     execfile('tokens.py')
     execfile('parse_nodes.py')
+    execfile('predefined.py')
     execfile('code_settings.py')
     execfile('colours.py')
     execfile('semantic_codes.py')
@@ -45,7 +46,7 @@ def main():
     execfile('errors.py')
     execfile('interpreter_dispatch.py')
     execfile('unicode_scripts.py')
-    # execfile('unicode_graphemes.py')
+    execfile('unicode_graphemes.py')
     
     shutil.copyfile("construct_codes.csv", "cache/construct_codes.csv")
     
@@ -1,5 +1,11 @@
 from utils import cpp, table_reader
 
+# Node fields are packed into 32-bit words. Storage classes:
+#   word: one word, sign-extended on read so that NONE and the high sentinel values round-trip
+#   wide: two words, for fields which may hold a pointer
+#   side: cold field held in a side table, with only its 32-bit index stored in the node
+WORDS = {"word": "1", "wide": "2", "side": "1"}
+
 
 def to_camel_case(snake_str):
     components = snake_str.split('_')
@@ -14,7 +20,7 @@ def main():
     header_writer = cpp.HeaderWriter(
         name="ast_fields",
         inner_namespace="Code",
-        includes=["forscape_value.h"]
+        includes=["forscape_value.h", "typeset_selection.h"]
     )
 
     nodes = table_reader.csv_to_list_of_tuples(
@@ -22,72 +28,155 @@ def main():
         tuple_name="Node",
     )
 
+    side_fields = [field for field in fields if field.storage == "side"]
+
     header_writer.write("#define FORSCAPE_AST_FIELD_CODEGEN_DECLARATIONS \\\n")
     prev = 0
 
     with open("../src/generated/code_ast_fields.cpp", "w", encoding="utf-8") as source_file:
         source_file.write("#include \"forscape_parse_tree.h\"\n\n")
-        source_file.write("#include \"typeset_selection.h\"\n\n")
+        source_file.write("#include \"typeset_selection.h\"\n")
+        source_file.write("#include <cstring>\n\n")
 
         source_file.write("namespace Forscape {\n\n")
         source_file.write("namespace Code {\n\n")
 
+        for field in side_fields:
+            source_file.write(f"static const {field.type} empty_{field.property} = {field.type}();\n\n")
+
         for field in fields:
-            word = (field.word == "y")
-            header_writer.write(f"    static constexpr size_t {field.property.upper()}_OFFSET = {prev}; \\\n")
-            if word:
-                prev = f"{field.property.upper()}_OFFSET + 1"
-                T = "size_t"
-                ref = f"data[pn+{field.property.upper()}_OFFSET]"
-                const_ref = f"data[pn+{field.property.upper()}_OFFSET]"
-            else:
-                prev = f"{field.property.upper()}_OFFSET + sizeof({field.type})/sizeof(size_t) + (sizeof({field.type}) % sizeof(size_t) != 0)"
-                T = f"const {field.type}&"
-                ref = f"*reinterpret_cast<{field.type}*>(data.data()+pn+{field.property.upper()}_OFFSET)"
-                const_ref = f"*reinterpret_cast<const {field.type}*>(data.data()+pn+{field.property.upper()}_OFFSET)"
+            offset = f"{field.property.upper()}_OFFSET"
+            header_writer.write(f"    static constexpr size_t {offset} = {prev}; \\\n")
+            prev = f"{offset} + {WORDS[field.storage]}"
             getter = to_camel_case("get_" + field.property)
             setter = to_camel_case("set_" + field.property)
+            table = f"{field.property}_table"
+
+            if field.storage == "side":
+                T = f"const {field.type}&"
+                setter_except = "alloc_except"
+            else:
+                T = "size_t"
+                setter_except = "noexcept"
+
             header_writer.write(f"    {T} {getter}(ParseNode pn) const noexcept; \\\n")
-            header_writer.write(f"    void {setter}(ParseNode pn, {T} {field.property}) noexcept;  \\\n")
+            header_writer.write(f"    void {setter}(ParseNode pn, {T} {field.property}) {setter_except};  \\\n")
             source_file.write(
                 f"{T} ParseTree::{getter}(ParseNode pn) const noexcept {{\n"
                 "    assert(isNode(pn));\n"
             )
-            if field.property == "selection":
-                source_file.write(f"    assert(({const_ref}).inValidState());\n")
-            source_file.write(
-                f"    return {const_ref};\n"
-                "}\n\n"
-            )
+            if field.storage == "word":
+                source_file.write(f"    return widen(data[pn+{offset}]);\n")
+            elif field.storage == "wide":
+                source_file.write(
+                    f"    size_t {field.property};\n"
+                    f"    std::memcpy(&{field.property}, data.data()+pn+{offset}, sizeof({field.property}));\n"
+                    f"    return {field.property};\n"
+                )
+            else:
+                source_file.write(
+                    f"    const uint32_t index = data[pn+{offset}];\n"
+                    f"    const {field.type}& {field.property} = (index == EMPTY_INDEX) ? empty_{field.property} : {table}[index];\n"
+                )
+                if field.property == "selection":
+                    source_file.write(f"    assert({field.property}.inValidState());\n")
+                source_file.write(f"    return {field.property};\n")
+            source_file.write("}\n\n")
+
             source_file.write(
-                f"void ParseTree::{setter}(ParseNode pn, {T} {field.property}) noexcept {{\n")
+                f"void ParseTree::{setter}(ParseNode pn, {T} {field.property}) {setter_except} {{\n")
             if field.property == "selection":
                 source_file.write("    assert(selection.inValidState(false));\n")
-            source_file.write(
-                "    assert(isNode(pn));\n"
-                f"    {ref} = {field.property};\n"
-                "}\n\n"
-            )
+            source_file.write("    assert(isNode(pn));\n")
+            if field.storage == "word":
+                source_file.write(f"    data[pn+{offset}] = narrow({field.property});\n")
+            elif field.storage == "wide":
+                source_file.write(f"    std::memcpy(data.data()+pn+{offset}, &{field.property}, sizeof({field.property}));\n")
+            else:
+                source_file.write(
+                    f"    uint32_t& index = data[pn+{offset}];\n"
+                    "    if(index == EMPTY_INDEX){\n"
+                    f"        index = narrow({table}.size());\n"
+                    f"        {table}.push_back({field.property});\n"
+                    "    }else{\n"
+                    f"        {table}[index] = {field.property};\n"
+                    "    }\n"
+                )
+            source_file.write("}\n\n")
 
+        # Several ops may share a flag name, e.g. every loop keeps its hoisted invariants in the flag
+        flag_ops = {}
         for node in [node for node in nodes if node.ast_flag]:
-            getter = to_camel_case("get_" + node.ast_flag)
-            setter = to_camel_case("set_" + node.ast_flag)
+            flag_ops.setdefault(node.ast_flag, []).append(node.enum)
+
+        for ast_flag, enums in flag_ops.items():
+            getter = to_camel_case("get_" + ast_flag)
+            setter = to_camel_case("set_" + ast_flag)
+            op_check = " || ".join(f"getOp(pn) == OP_{enum}" for enum in enums)
             header_writer.write(f"    size_t {getter}(ParseNode pn) const noexcept; \\\n")
             header_writer.write(f"    void {setter}(ParseNode pn, size_t value) noexcept;  \\\n")
             source_file.write(
                 f"size_t ParseTree::{getter}(ParseNode pn) const noexcept {{\n"
-                f"    assert(getOp(pn) == OP_{node.enum});\n"
+                f"    assert({op_check});\n"
                 f"    return getFlag(pn);\n"
                 "}\n\n"
             )
             source_file.write(
                 f"void ParseTree::{setter}(ParseNode pn, size_t value) noexcept {{\n"
-                f"    assert(getOp(pn) == OP_{node.enum});\n"
+                f"    assert({op_check});\n"
                 f"    setFlag(pn, value);\n"
                 "}\n\n"
             )
 
         header_writer.write(f"    static constexpr size_t FIXED_FIELDS = {prev};\n\n")
+
+        header_writer.write("#define FORSCAPE_AST_FIELD_CODEGEN_SIDE_TABLES \\\n")
+        for field in side_fields:
+            header_writer.write(f"    std::vector<{field.type}> {field.property}_table; \\\n")
+        header_writer.write(
+            "    void clearSideTables() noexcept; \\\n"
+            "    void resetSideIndices(ParseNode pn) noexcept; \\\n"
+            "    void copySideFields(ParseNode dest, ParseNode src) alloc_except; \\\n"
+            "    void appendSideTables(const ParseTree& other) alloc_except; \\\n"
+            "    void shiftSideIndices(ParseNode pn, const ParseTree& appended) noexcept;\n\n"
+        )
+
+        source_file.write("void ParseTree::clearSideTables() noexcept {\n")
+        for field in side_fields:
+            source_file.write(f"    {field.property}_table.clear();\n")
+        source_file.write("}\n\n")
+
+        source_file.write("void ParseTree::resetSideIndices(ParseNode pn) noexcept {\n")
+        for field in side_fields:
+            source_file.write(f"    data[pn+{field.property.upper()}_OFFSET] = EMPTY_INDEX;\n")
+        source_file.write("}\n\n")
+
+        source_file.write("void ParseTree::copySideFields(ParseNode dest, ParseNode src) alloc_except {\n")
+        for field in side_fields:
+            offset = f"{field.property.upper()}_OFFSET"
+            setter = to_camel_case("set_" + field.property)
+            source_file.write(
+                f"    if(data[src+{offset}] != EMPTY_INDEX) "
+                f"{setter}(dest, {field.property}_table[data[src+{offset}]]);\n"
+            )
+        source_file.write("}\n\n")
+
+        source_file.write("void ParseTree::appendSideTables(const ParseTree& other) alloc_except {\n")
+        for field in side_fields:
+            table = f"{field.property}_table"
+            source_file.write(f"    {table}.insert({table}.end(), other.{table}.cbegin(), other.{table}.cend());\n")
+        source_file.write("}\n\n")
+
+        source_file.write("void ParseTree::shiftSideIndices(ParseNode pn, const ParseTree& appended) noexcept {\n")
+        for field in side_fields:
+            offset = f"{field.property.upper()}_OFFSET"
+            table = f"{field.property}_table"
+            source_file.write(
+                f"    if(data[pn+{offset}] != EMPTY_INDEX)\n"
+                f"        data[pn+{offset}] += narrow({table}.size() - appended.{table}.size());\n"
+            )
+        source_file.write("}\n\n")
+
         source_file.write("}\n\n}\n")
 
     header_writer.finalize()
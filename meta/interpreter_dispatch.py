@@ -2,6 +2,16 @@ from utils import cpp, table_reader
 import re
 
 
+def operand(typ, value):
+    # Matrices are held in shared storage, which the rules only ever read
+    if typ == "MatrixXd":
+        return f"std::get<SharedMatrix>({value}).read()"
+    # Strings are a class of their own rather than std::string
+    if typ == "string":
+        return f"std::get<String>({value})"
+    return f"std::get<{typ}>({value})"
+
+
 def main():
     rules = table_reader.csv_to_list_of_tuples(
         csv_filepath="interpreter_dispatch.csv",
@@ -77,7 +87,10 @@ def main():
                            "}\n\n")
 
         codegen_file.write("Value Interpreter::unaryDispatch(ParseNode pn) {\n"
-                           "    Value child = interpretExpr( parse_tree.child(pn) );\n\n"
+                           "    //Variables are read in place, skipping even the reference count of shared matrices\n"
+                           "    ParseNode child_node = parse_tree.child(pn);\n"
+                           "    Value temp;\n"
+                           "    const Value& child = isVariableRead(child_node) ? read(child_node) : (temp = interpretExpr(child_node));\n\n"
                            "    switch( unaryCode(parse_tree.getOp(pn), child.index()) ){\n")
 
         for rule in unary_rules:
@@ -94,12 +107,12 @@ def main():
                         constraints = rule.constraint.split(":")
                         impl = rule.impl
                     else:
-                        impl = re.sub(r'\ba\b', f'std::get<{typ}>(child)', rule.impl)
+                        impl = re.sub(r'\ba\b', operand(typ, "child"), rule.impl)
 
                     codegen_file.write(f"        case unaryCode(OP_{op}, {typ}_index):\n")
             if rule.constraint:
                 codegen_file.write("        {\n")
-                codegen_file.write(f"            const auto& a = std::get<{typ}>(child);\n")
+                codegen_file.write(f"            const auto& a = {operand(typ, 'child')};\n")
             for con in constraints:
                 parts = con.split("=>")
                 assert len(parts) == 2, f"Missing arrow for {con}"
@@ -123,6 +136,18 @@ def main():
         codegen_file.write("Value Interpreter::binaryDispatch(ParseNode pn) {\n"
                            "    ParseNode lhs = parse_tree.lhs(pn);\n"
                            "    ParseNode rhs = parse_tree.rhs(pn);\n"
+                           "\n"
+                           "    //Variables are read in place once nothing else can be evaluated,\n"
+                           "    //since evaluating an operand could move the stack under a reference\n"
+                           "    if(isVariableRead(rhs)){\n"
+                           "        if(isVariableRead(lhs)){\n"
+                           "            const Value& vL = read(lhs);\n"
+                           "            return binaryDispatch(parse_tree.getOp(pn), vL, read(rhs), pn);\n"
+                           "        }\n"
+                           "        Value vL = interpretExpr(lhs);\n"
+                           "        return binaryDispatch(parse_tree.getOp(pn), vL, read(rhs), pn);\n"
+                           "    }\n"
+                           "\n"
                            "    Value vL = interpretExpr(lhs);\n"
                            "    Value vR = interpretExpr(rhs);\n"
                            "\n"
@@ -153,14 +178,14 @@ def main():
                             constraints = rule.constraint.split(":")
                             impl = rule.impl
                         else:
-                            impl = re.sub(r'\ba\b', f'std::get<{a_op}>(lhs)', rule.impl)
-                            impl = re.sub(r'\bb\b', f'std::get<{b_op}>(rhs)', impl)
+                            impl = re.sub(r'\ba\b', operand(a_op, "lhs"), rule.impl)
+                            impl = re.sub(r'\bb\b', operand(b_op, "rhs"), impl)
 
                         codegen_file.write(f"        case binaryCode(OP_{op}, {a_op}_index, {b_op}_index):\n")
             if rule.constraint:
                 codegen_file.write("        {\n")
-                codegen_file.write(f"            const auto& a = std::get<{a_op}>(lhs);\n")
-                codegen_file.write(f"            const auto& b = std::get<{b_op}>(rhs);\n")
+                codegen_file.write(f"            const auto& a = {operand(a_op, 'lhs')};\n")
+                codegen_file.write(f"            const auto& b = {operand(b_op, 'rhs')};\n")
             for con in constraints:
                 parts = con.split("=>")
                 assert len(parts) == 2, f"Missing arrow for {con}"
@@ -177,6 +202,74 @@ def main():
 
         codegen_file.write("\n}\n\n}\n")
 
+    write_constant_folding(nullary_rules, unary_rules, binary_rules)
+
+
+NUMERIC_LITERAL = r"[0-9]+(\.[0-9]*)?(e-?[0-9]+)?f?"
+
+
+def is_foldable(rule):
+    """
+    A rule folds at compile time if it maps doubles to a double without touching the interpreter,
+    so the optimiser computes exactly what the interpreter would have.
+    """
+    if rule.a not in ("", "double") or rule.b not in ("", "double"):
+        return False
+    if rule.return_type not in ("", "double"):
+        return False
+    names = re.sub(NUMERIC_LITERAL, "", rule.impl)
+    names = re.sub(r"std::\w+|static_cast<double>", "", names)
+    return set(re.findall(r"[A-Za-z_]\w*", names)) <= {"a", "b", "int"}
+
+
+def write_fold_cases(file, rules):
+    for rule in [rule for rule in rules if is_foldable(rule)]:
+        for op in rule.op.split("|"):
+            # Calls have the callee as their first child rather than an operand
+            if op != "CALL":
+                file.write(f"        case OP_{op}:\n")
+        file.write("            ")
+        if rule.constraint:
+            for con in rule.constraint.split(":"):
+                condition = con.split("=>")[0]
+                file.write(f"if({condition}) return false;\n            ")
+        file.write(f"val = {rule.impl};\n"
+                   "            return true;\n")
+
+
+def write_constant_folding(nullary_rules, unary_rules, binary_rules):
+    with open("../src/generated/forscape_optimiser_gen.cpp", "w", encoding="utf-8") as codegen_file:
+        codegen_file.write("#include \"forscape_optimiser.h\"\n\n")
+        codegen_file.write("#include <cmath>\n\n")
+        codegen_file.write("namespace Forscape {\n\n")
+        codegen_file.write("namespace Code {\n\n")
+
+        codegen_file.write("bool Optimiser::foldConstant(Op op, double& val) noexcept {\n"
+                           "    switch(op){\n")
+        for rule in nullary_rules:
+            if re.fullmatch(NUMERIC_LITERAL, rule.impl):
+                for op in rule.op.split("|"):
+                    codegen_file.write(f"        case OP_{op}: val = {rule.impl}; return true;\n")
+        codegen_file.write("        default: return false;\n"
+                           "    }\n"
+                           "}\n\n")
+
+        codegen_file.write("bool Optimiser::foldUnary(Op op, double a, double& val) noexcept {\n"
+                           "    switch(op){\n")
+        write_fold_cases(codegen_file, unary_rules)
+        codegen_file.write("        default: return false;\n"
+                           "    }\n"
+                           "}\n\n")
+
+        codegen_file.write("bool Optimiser::foldBinary(Op op, double a, double b, double& val) noexcept {\n"
+                           "    switch(op){\n")
+        write_fold_cases(codegen_file, binary_rules)
+        codegen_file.write("        default: return false;\n"
+                           "    }\n"
+                           "}\n\n")
+
+        codegen_file.write("}\n\n}\n")
+
 
 if __name__ == "__main__":
     main()
@@ -0,0 +1,26 @@
+from utils import cpp, perfect_hash, table_reader
+
+
+def main():
+    entries = table_reader.csv_to_list_of_tuples(
+        csv_filepath="predefined.csv",
+    )
+
+    header_writer = cpp.HeaderWriter(
+        name="predefined",
+        inner_namespace="Code",
+        includes=["code_parsenode_ops.h", "forscape_perfect_hash.h"],
+    )
+
+    perfect_hash.write_map(
+        header_writer,
+        "FORSCAPE_PREDEFINED_MAP",
+        [e.label for e in entries],
+        [f"OP_{e.op}" for e in entries],
+    )
+
+    header_writer.finalize()
+
+
+if __name__ == "__main__":
+    main()
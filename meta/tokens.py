@@ -1,4 +1,4 @@
-from utils import cpp, table_reader, unicode
+from utils import cpp, perfect_hash, table_reader, unicode
 
 
 def main():
@@ -16,6 +16,7 @@ def main():
     header_writer = cpp.HeaderWriter(
         name="tokentype",
         inner_namespace="Code",
+        includes=["forscape_perfect_hash.h"],
     )
 
     header_writer.write("enum ForscapeTokenType {\n")
@@ -71,11 +72,13 @@ def main():
             header_writer.write(f"\\\n    case TOKEN_{construct.name.upper()}:")
     header_writer.write("\n\n")
 
-    header_writer.write("#define FORSCAPE_KEYWORD_MAP ")
-    for token in tokens:
-        if token.keyword == "y":
-            header_writer.write(f"\\\n    {{\"{token.label}\", {token.enum.upper()}}},")
-    header_writer.write("\n\n")
+    keywords = [token for token in tokens if token.keyword == "y"]
+    perfect_hash.write_map(
+        header_writer,
+        "FORSCAPE_KEYWORD_MAP",
+        [token.label for token in keywords],
+        [token.enum.upper() for token in keywords],
+    )
 
     header_writer.finalize()
 
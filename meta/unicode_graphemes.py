@@ -1,29 +1,104 @@
-from utils import cpp, unicode
-from wcwidth import wcwidth
+"""
+Zero-width codepoints, such as combining accents, join the grapheme before them.
+
+The codepoint ranges are listed in unicode_zerowidth.csv. They are looked up through a two-stage table:
+the high bits of a codepoint index a block, identical blocks are stored once, and the low bits pick out
+a single bit of that block. Run with --refresh to rebuild the csv from wcwidth.
+"""
+
+import sys
+from utils import cpp, table_reader
+
+BLOCK_BITS = 8
+BLOCK_SIZE = 1 << BLOCK_BITS
+WORDS_PER_BLOCK = BLOCK_SIZE // 64
+
+
+def refresh():
+    from wcwidth import wcwidth
+
+    codepoints = [i for i in range(256, 1114112) if wcwidth(chr(i)) == 0]
+    ranges = []
+    for code in codepoints:
+        if ranges and ranges[-1][1] == code - 1:
+            ranges[-1][1] = code
+        else:
+            ranges.append([code, code])
+
+    with open("unicode_zerowidth.csv", "w", encoding="utf-8") as csv_file:
+        csv_file.write("first,last\n")
+        for first, last in ranges:
+            csv_file.write(f"{first:04X},{last:04X}\n")
 
 
 def main():
+    ranges = table_reader.csv_to_list_of_tuples(
+        csv_filepath="unicode_zerowidth.csv",
+        tuple_name="ZeroWidthRange",
+    )
+
+    codepoints = set()
+    for r in ranges:
+        first = int(r.first, 16)
+        last = int(r.last, 16)
+        assert first <= last < 1114112, f"Invalid zero-width range {r.first}-{r.last}"
+        # countGraphemes only looks up lead bytes from 0xCC, the lead byte of U+0300, so a lower
+        # zero-width codepoint would be silently counted as a grapheme
+        assert first >= 0x300, f"Zero-width range {r.first}-{r.last} is below U+0300, which countGraphemes skips"
+        codepoints.update(range(first, last + 1))
+
+    num_blocks = max(codepoints) // BLOCK_SIZE + 1
+    blocks = [(0,) * WORDS_PER_BLOCK]
+    block_index = []
+    for b in range(num_blocks):
+        words = [0] * WORDS_PER_BLOCK
+        for offset in range(BLOCK_SIZE):
+            if b * BLOCK_SIZE + offset in codepoints:
+                words[offset // 64] |= 1 << (offset % 64)
+        words = tuple(words)
+        if words not in blocks:
+            blocks.append(words)
+        block_index.append(blocks.index(words))
+    assert len(blocks) <= 256, "Zero-width block index no longer fits in a byte"
+
     header_writer = cpp.HeaderWriter(
         name="unicode_zerowidth",
         includes=["forscape_common.h"],
     )
 
+    header_writer.write(f"inline constexpr size_t ZERO_WIDTH_BLOCK_BITS = {BLOCK_BITS};\n\n")
+
+    header_writer.write(f"inline constexpr uint8_t ZERO_WIDTH_BLOCK_INDEX[{num_blocks}] = {{")
+    for i in range(num_blocks):
+        if i % 32 == 0:
+            header_writer.write("\n    ")
+        header_writer.write(f"{block_index[i]},")
+    header_writer.write("\n};\n\n")
+
+    header_writer.write(f"inline constexpr uint64_t ZERO_WIDTH_BLOCKS[{len(blocks) * WORDS_PER_BLOCK}] = {{\n")
+    for words in blocks:
+        header_writer.write("    " + " ".join(f"0x{w:016X}," for w in words) + "\n")
+    header_writer.write("};\n\n")
+
     header_writer.write(
+        "/// Takes the UTF-8 bytes of a codepoint packed from the lowest byte up, as read by codepointInt.\n"
         "inline bool isZeroWidth(uint32_t code) noexcept {\n"
-        "    switch(code){\n")
-    for i in range(256, 1114112):
-        ch = chr(i)
-        if wcwidth(ch) == 0:
-            print(f"{i},")
-            header_writer.write(f"        case {unicode.to_num(ch)}:\n")
-    header_writer.write(
-        "            return true;\n"
-        "        default: return false;\n"
-        "    }\n"
-        "};\n\n")
+        "    uint32_t codepoint;\n"
+        "    if(code < 0x80) return false;\n"
+        "    else if(code < 0x10000) codepoint = ((code & 0x1F) << 6) | ((code >> 8) & 0x3F);\n"
+        "    else if(code < 0x1000000) codepoint = ((code & 0x0F) << 12) | (((code >> 8) & 0x3F) << 6) | ((code >> 16) & 0x3F);\n"
+        "    else codepoint = ((code & 0x07) << 18) | (((code >> 8) & 0x3F) << 12) | (((code >> 16) & 0x3F) << 6) | ((code >> 24) & 0x3F);\n"
+        "\n"
+        "    const uint32_t block = codepoint >> ZERO_WIDTH_BLOCK_BITS;\n"
+        "    if(block >= sizeof(ZERO_WIDTH_BLOCK_INDEX)) return false;\n"
+        f"    const uint64_t word = ZERO_WIDTH_BLOCKS[ZERO_WIDTH_BLOCK_INDEX[block]*{WORDS_PER_BLOCK} + ((codepoint >> 6) & {WORDS_PER_BLOCK - 1})];\n"
+        "    return (word >> (codepoint & 63)) & 1;\n"
+        "}\n\n")
 
     header_writer.finalize()
 
 
 if __name__ == "__main__":
+    if "--refresh" in sys.argv:
+        refresh()
     main()
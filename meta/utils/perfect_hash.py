@@ -0,0 +1,72 @@
+"""
+Minimal perfect hashing of a fixed key set, mirrored by src/forscape_perfect_hash.h.
+
+Each key is hashed once with FNV-1a. The high bits of that hash choose a bucket, and each bucket
+is given a displacement which moves all of its keys into unused slots. Every key ends up with a
+slot of its own, and there are exactly as many slots as keys.
+"""
+
+MASK_32 = 0xFFFFFFFF
+
+
+def hash_base(key):
+    h = 2166136261
+    for b in key.encode("utf-8"):
+        h = ((h ^ b) * 16777619) & MASK_32
+    return h
+
+
+def hash_range(h, n):
+    return (h * n) >> 32
+
+
+def hash_slot(h, displacement, n):
+    x = ((h ^ displacement) * 0x9E3779B1) & MASK_32
+    x ^= x >> 15
+    return hash_range(x, n)
+
+
+def build(keys):
+    """
+    Returns the displacement of each bucket, and the index of the key stored in each slot.
+    """
+    n = len(keys)
+    assert n > 0, "Cannot build a perfect hash of no keys"
+    assert len(set(keys)) == n, "Perfect hash keys must be unique"
+    hashes = [hash_base(key) for key in keys]
+
+    buckets = [[] for _ in range(n)]
+    for i in range(n):
+        buckets[hash_range(hashes[i], n)].append(i)
+
+    displacements = [0] * n
+    slots = [None] * n
+    for b in sorted(range(n), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            break
+        for displacement in range(1 << 16):
+            candidate = [hash_slot(hashes[i], displacement, n) for i in buckets[b]]
+            if len(set(candidate)) == len(candidate) and all(slots[s] is None for s in candidate):
+                for i, s in zip(buckets[b], candidate):
+                    slots[s] = i
+                displacements[b] = displacement
+                break
+        else:
+            raise RuntimeError(f"No perfect hash displacement for bucket {b}")
+
+    return displacements, slots
+
+
+def write_map(header_writer, macro, keys, values):
+    """
+    Writes a macro holding the initialiser of a PerfectHashMap, with the count in a constant.
+    """
+    displacements, slots = build(keys)
+    header_writer.write(f"constexpr size_t {macro}_SIZE = {len(keys)};\n\n")
+    header_writer.write(f"#define {macro} {{ \\\n")
+    header_writer.write(f"    {{{{{', '.join(str(d) for d in displacements)}}}}}, \\\n")
+    header_writer.write("    {{ \\\n")
+    for i in slots:
+        header_writer.write(f"        {{\"{keys[i]}\", {values[i]}}}, \\\n")
+    header_writer.write("    }} \\\n")
+    header_writer.write("}\n\n")
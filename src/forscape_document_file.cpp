@@ -0,0 +1,107 @@
+#include "forscape_document_file.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Forscape {
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::filesystem::path& path) noexcept {
+    HANDLE file = CreateFileW(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) return;
+
+    LARGE_INTEGER file_size;
+    if(!GetFileSizeEx(file, &file_size)){
+        CloseHandle(file);
+        return;
+    }
+
+    size = static_cast<size_t>(file_size.QuadPart);
+    if(size == 0){
+        CloseHandle(file);
+        is_open = true;
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if(mapping == nullptr){
+        size = 0;
+        return;
+    }
+    data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    is_open = (data != nullptr);
+    if(!is_open) size = 0;
+}
+
+MappedFile::~MappedFile() noexcept {
+    if(data) UnmapViewOfFile(data);
+}
+#else
+MappedFile::MappedFile(const std::filesystem::path& path) noexcept {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd == -1) return;
+
+    struct stat file_stat;
+    if(fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)){
+        ::close(fd);
+        return;
+    }
+
+    size = static_cast<size_t>(file_stat.st_size);
+    if(size == 0){
+        ::close(fd);
+        is_open = true;
+        return;
+    }
+
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(mapped == MAP_FAILED){
+        size = 0;
+        return;
+    }
+    data = static_cast<const char*>(mapped);
+    is_open = true;
+}
+
+MappedFile::~MappedFile() noexcept {
+    if(data) munmap(const_cast<char*>(data), size);
+}
+#endif
+
+bool MappedFile::isOpen() const noexcept {
+    return is_open;
+}
+
+std::string_view MappedFile::bytes() const noexcept {
+    return std::string_view(data, size);
+}
+
+DocumentFile::DocumentFile(const std::filesystem::path& path) {
+    MappedFile mapped(path);
+    is_open = mapped.isOpen();
+    text = mapped.bytes();
+    text.erase( std::remove(text.begin(), text.end(), '\r'), text.end() );
+}
+
+bool DocumentFile::isOpen() const noexcept {
+    return is_open;
+}
+
+std::string_view DocumentFile::serial() const noexcept {
+    return text;
+}
+
+}
@@ -0,0 +1,41 @@
+#ifndef FORSCAPE_DOCUMENT_FILE_H
+#define FORSCAPE_DOCUMENT_FILE_H
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace Forscape {
+
+/// Read-only memory mapping of an entire file. An empty file maps to an empty view.
+class MappedFile {
+public:
+    MappedFile(const std::filesystem::path& path) noexcept;
+    ~MappedFile() noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    bool isOpen() const noexcept;
+    std::string_view bytes() const noexcept;
+
+private:
+    const char* data = nullptr;
+    size_t size = 0;
+    bool is_open = false;
+};
+
+/// The serial of a document read from disk. The file is mapped rather than streamed, and copied once
+/// to drop carriage returns, which also gives the null terminator the serial scan relies on.
+class DocumentFile {
+public:
+    DocumentFile(const std::filesystem::path& path);
+    bool isOpen() const noexcept;
+    std::string_view serial() const noexcept;
+
+private:
+    std::string text;
+    bool is_open;
+};
+
+}
+
+#endif // FORSCAPE_DOCUMENT_FILE_H
@@ -5,6 +5,7 @@
 #include "forscape_message.h"
 #include "forscape_symbol_link_pass.h"
 
+#include <algorithm>
 #include <thread>
 
 #ifdef USE_CONAN_EIGEN
@@ -27,8 +28,8 @@ Interpreter::Interpreter() noexcept
 void Interpreter::run(
         const ParseTree& parse_tree,
         const InstantiationLookup& inst_lookup,
-        const NumericSwitchMap& number_switch,
-        const StringSwitchMap& string_switch){
+        const SwitchTables& switch_tables,
+        std::shared_ptr<const StringTable> strings){
     assert(parse_tree.getOp(parse_tree.root) == OP_BLOCK);
     reset();
 
@@ -38,8 +39,8 @@ void Interpreter::run(
 
     this->parse_tree = parse_tree;
     this->inst_lookup = inst_lookup;
-    this->number_switch = number_switch;
-    this->string_switch = string_switch;
+    this->switch_tables = switch_tables;
+    this->strings = std::move(strings);
     SymbolTableLinker linker(this->parse_tree);
     linker.link();
     this->parse_tree.patchClones();
@@ -50,10 +51,10 @@ void Interpreter::run(
 
 void Interpreter::runThread(const ParseTree& parse_tree,
         const InstantiationLookup& inst_lookup,
-        const NumericSwitchMap& number_switch,
-        const StringSwitchMap& string_switch){
+        const SwitchTables& switch_tables,
+        std::shared_ptr<const StringTable> strings){
     status = NORMAL;
-    std::thread(&Interpreter::run, this, parse_tree, inst_lookup, number_switch, string_switch).detach();
+    std::thread(&Interpreter::run, this, parse_tree, inst_lookup, switch_tables, std::move(strings)).detach();
 
     //EVENTUALLY: linking in a threaded call with the original symbol_table means a crash will happen
     //            if the symbol_table is invalidated before the linker finishes running.
@@ -70,6 +71,8 @@ void Interpreter::reset() noexcept {
     directive = RUN;
     status = NORMAL;
     stack.clear();
+    saved_invariants.clear();
+    plot_streams.clear();
     active_closure = nullptr;
 }
 
@@ -143,15 +146,18 @@ void Interpreter::assignStmt(ParseNode pn){
 }
 
 void Interpreter::whileStmt(ParseNode pn){
+    enterLoop(pn);
     while(status <= CONTINUE && evaluateCondition( parse_tree.arg<0>(pn) )){
         status = NORMAL;
         size_t stack_size = stack.size();
         interpretStmt( parse_tree.arg<1>(pn) );
         if(status < RETURN) stack.trim(stack_size);
     }
+    exitLoop(pn);
 }
 
 void Interpreter::forStmt(ParseNode pn){
+    enterLoop(pn);
     size_t stack_size = stack.size();
     interpretStmt(parse_tree.arg<0>(pn));
 
@@ -166,9 +172,11 @@ void Interpreter::forStmt(ParseNode pn){
     }
 
     if(status < RETURN) stack.trim(stack_size);
+    exitLoop(pn);
 }
 
 void Interpreter::rangedForStmt(ParseNode pn) {
+    enterLoop(pn);
     Value iterable_val = interpretExpr(parse_tree.arg<1>(pn));
     size_t stack_size = stack.size();
 
@@ -177,9 +185,10 @@ void Interpreter::rangedForStmt(ParseNode pn) {
         interpretStmt(parse_tree.arg<2>(pn));
     }else{
         assert(iterable_val.index() == MatrixXd_index);
-        const Eigen::MatrixXd& mat = std::get<Eigen::MatrixXd>(iterable_val);
+        const Eigen::MatrixXd& mat = std::get<SharedMatrix>(iterable_val).read();
         if(mat.rows() > 1 && mat.cols() > 1){
             error(DIMENSION_MISMATCH, parse_tree.arg<1>(pn));
+            exitLoop(pn);
             return;
         }
 
@@ -193,6 +202,40 @@ void Interpreter::rangedForStmt(ParseNode pn) {
     }
 
     if(status < RETURN) stack.trim(stack_size);
+    exitLoop(pn);
+}
+
+void Interpreter::enterLoop(ParseNode pn){
+    //A recursive call may enter a loop which is still running in its caller, so the caller's cache is set aside
+    ParseNode invariants = parse_tree.getLoopInvariants(pn);
+    if(invariants == NONE) return;
+
+    for(size_t i = 0; i < parse_tree.getNumArgs(invariants); i++){
+        ParseNode invariant = parse_tree.arg(invariants, i);
+        saved_invariants.push_back(parse_tree.getValue(invariant));
+        parse_tree.setValue(invariant, Value());
+    }
+}
+
+void Interpreter::exitLoop(ParseNode pn){
+    ParseNode invariants = parse_tree.getLoopInvariants(pn);
+    if(invariants == NONE) return;
+
+    for(size_t i = parse_tree.getNumArgs(invariants); i-->0;){
+        parse_tree.setValue(parse_tree.arg(invariants, i), saved_invariants.back());
+        saved_invariants.pop_back();
+    }
+}
+
+Value Interpreter::loopInvariant(ParseNode pn){
+    //The cache is empty until the first evaluation in this run of the loop. Errors are never cached,
+    //since they share the index of an empty value.
+    const Value& cached = parse_tree.getValue(pn);
+    if(cached.index() != RuntimeError) return cached;
+
+    Value v = interpretExpr(parse_tree.child(pn));
+    parse_tree.setValue(pn, v);
+    return v;
 }
 
 void Interpreter::ifStmt(ParseNode pn){
@@ -222,23 +265,17 @@ void Interpreter::blockStmt(ParseNode pn){
 
 void Interpreter::switchStmtNumeric(ParseNode pn) {
     double switch_key = readDoubleAsserted(parse_tree.arg<0>(pn));
-    auto lookup = number_switch.find({pn, switch_key});
-    //EVENTUALLY: should make default path rhs earlier
-    ParseNode codepath = lookup == number_switch.end()
-            ? (parse_tree.getFlag(pn) != NONE ? parse_tree.rhs(parse_tree.getFlag(pn)) : NONE)
-            : lookup->second;
+    ParseNode codepath = switch_tables[parse_tree.getFlag(pn)].find(switch_key);
     if(codepath != NONE) interpretStmt(codepath);
 }
 
 void Interpreter::switchStmtString(ParseNode pn) {
     Value key_expr = interpretExpr(parse_tree.arg<0>(pn));
     assert(key_expr.index() == string_index);
-    std::string switch_key = std::get<std::string>(key_expr);
-    auto lookup = string_switch.find({pn, switch_key});
-    //EVENTUALLY: should make default path rhs earlier
-    ParseNode codepath = lookup == string_switch.end()
-            ? (parse_tree.getFlag(pn) != NONE ? parse_tree.rhs(parse_tree.getFlag(pn)) : NONE)
-            : lookup->second;
+    //A string built at runtime has no atom, but reaches the case of the literal with the same text
+    const String& key = std::get<String>(key_expr);
+    const uint32_t atom = key.getAtom() != String::NO_ATOM ? key.getAtom() : strings->find(key.str());
+    ParseNode codepath = switch_tables[parse_tree.getFlag(pn)].find(atom);
     if(codepath != NONE) interpretStmt(codepath);
 }
 
@@ -317,28 +354,30 @@ void Interpreter::returnStmt(ParseNode pn){
 void Interpreter::plotStmt(ParseNode pn){
     Value v_title = interpretExpr(parse_tree.arg<0>(pn));
     assert(v_title.index() == string_index);
-    const std::string& title = std::get<std::string>(v_title);
+    const std::string title(std::get<String>(v_title).str());
     Value v_xlabel = interpretExpr(parse_tree.arg<1>(pn));
     assert(v_xlabel.index() == string_index);
-    const std::string& x_label = std::get<std::string>(v_xlabel);
+    const std::string x_label(std::get<String>(v_xlabel).str());
     Value vx = interpretExpr(parse_tree.arg<2>(pn));
     Value v_ylabel = interpretExpr(parse_tree.arg<3>(pn));
     assert(v_ylabel.index() == string_index);
-    const std::string& y_label = std::get<std::string>(v_ylabel);
+    const std::string y_label(std::get<String>(v_ylabel).str());
     Value vy = interpretExpr(parse_tree.arg<4>(pn));
 
     if(status != NORMAL) return;
 
-    InterpreterOutput* series_command;
+    PlotColumns data;
+    bool scalar = vx.index() == double_index;
 
-    if(vx.index() == double_index){
+    if(scalar){
         if(vy.index() != double_index){
             error(DIMENSION_MISMATCH, pn);
             return;
         }else{
-            double x = std::get<double>(vx);
-            double y = std::get<double>(vy);
-            series_command = PlotDiscreteSeries::FromArrays(&x, &y, 1);
+            data = PlotColumns{
+                std::make_shared<double>(std::get<double>(vx)),
+                std::make_shared<double>(std::get<double>(vy)),
+                1};
         }
     }else{
         assert(vx.index() == MatrixXd_index);
@@ -347,20 +386,64 @@ void Interpreter::plotStmt(ParseNode pn){
             return;
         }
 
-        const Eigen::MatrixXd& x = std::get<Eigen::MatrixXd>(vx);
-        const Eigen::MatrixXd& y = std::get<Eigen::MatrixXd>(vy);
+        const Eigen::MatrixXd& x = std::get<SharedMatrix>(vx).read();
+        const Eigen::MatrixXd& y = std::get<SharedMatrix>(vy).read();
         if(x.rows() != y.rows() || x.cols() != y.cols() || (x.cols() > 1 && x.rows() > 1)){
             error(DIMENSION_MISMATCH, pn);
             return;
         }else{
-            series_command = PlotDiscreteSeries::FromArrays(x.data(), y.data(), x.size());
+            data = PlotColumns{std::get<SharedMatrix>(vx).share(), std::get<SharedMatrix>(vy).share(), static_cast<size_t>(x.size())};
         }
     }
 
-    InterpreterOutput* title_command = new PlotCreate(title, x_label, y_label);
+    //Executing the statement again streams onto its plot: scalars add a point,
+    //and vectors which only grew since they were last sent add the new tail
+    auto stream = plot_streams.find(pn);
+    if(stream != plot_streams.end()){
+        PlotStream& ps = stream->second;
+        if(scalar && ps.scalar){
+            message_queue.enqueue(new PlotAppend(std::move(data), ps.id));
+            return;
+        }else if(!scalar && !ps.scalar && extends(ps.sent, data)){
+            const size_t offset = ps.sent.size;
+            ps.sent = data;
+            if(data.size == offset) return;
+            message_queue.enqueue(new PlotAppend(tail(data, offset), ps.id));
+            return;
+        }
+    }
+
+    const size_t id = plots_created++;
+    if(scalar) plot_streams[pn] = PlotStream{id, PlotColumns{}, true};
+    else plot_streams[pn] = PlotStream{id, data, false};
+
+    message_queue.enqueue(new PlotCreate(title, x_label, y_label, id));
+    message_queue.enqueue(new PlotDiscreteSeries(std::move(data)));
+}
+
+PlotColumns Interpreter::tail(const PlotColumns& data, size_t offset) alloc_except {
+    const size_t size = data.size - offset;
+
+    //Aliasing keeps the whole matrix alive with the plot. That only pays when the tail is most of the matrix,
+    //so a vector grown a little at a time is copied, rather than keeping every version of it.
+    if(2*size >= data.size) return PlotColumns{
+        std::shared_ptr<const double>(data.x, data.x.get() + offset),
+        std::shared_ptr<const double>(data.y, data.y.get() + offset),
+        size};
 
-    message_queue.enqueue(title_command);
-    message_queue.enqueue(series_command);
+    auto copy = [offset, size](const std::shared_ptr<const double>& column){
+        double* buffer = new double[size];
+        std::copy(column.get() + offset, column.get() + offset + size, buffer);
+        return std::shared_ptr<const double>(buffer, std::default_delete<double[]>());
+    };
+    return PlotColumns{copy(data.x), copy(data.y), size};
+}
+
+bool Interpreter::extends(const PlotColumns& sent, const PlotColumns& data) noexcept {
+    if(data.size < sent.size) return false;
+    if(data.x == sent.x && data.y == sent.y) return true;
+    return std::equal(sent.x.get(), sent.x.get() + sent.size, data.x.get()) &&
+           std::equal(sent.y.get(), sent.y.get() + sent.size, data.y.get());
 }
 
 Value Interpreter::implicitMult(ParseNode pn, size_t start){
@@ -470,15 +553,15 @@ void Interpreter::reassign(ParseNode lhs, ParseNode rhs){
             Value& v_lhs = readLocal(lhs);
             if(v_rhs.index() != v_lhs.index()) error(DIMENSION_MISMATCH, rhs);
             else if(v_rhs.index() == MatrixXd_index){
-                const Eigen::MatrixXd& m_lhs = std::get<Eigen::MatrixXd>(v_lhs);
-                const Eigen::MatrixXd& m_rhs = std::get<Eigen::MatrixXd>(v_rhs);
+                const Eigen::MatrixXd& m_lhs = std::get<SharedMatrix>(v_lhs).read();
+                const Eigen::MatrixXd& m_rhs = std::get<SharedMatrix>(v_rhs).read();
                 if(m_lhs.rows() != m_rhs.rows() || m_lhs.cols() != m_rhs.cols()){
                     error(DIMENSION_MISMATCH, rhs);
                     break;
                 }
             }
 
-            v_lhs = v_rhs;
+            v_lhs = std::move(v_rhs);
             break;
         }
 
@@ -487,15 +570,15 @@ void Interpreter::reassign(ParseNode lhs, ParseNode rhs){
             Value& v_lhs = readGlobal(lhs);
             if(v_rhs.index() != v_lhs.index()) error(DIMENSION_MISMATCH, rhs);
             else if(v_rhs.index() == MatrixXd_index){
-                const Eigen::MatrixXd& m_lhs = std::get<Eigen::MatrixXd>(v_lhs);
-                const Eigen::MatrixXd& m_rhs = std::get<Eigen::MatrixXd>(v_rhs);
+                const Eigen::MatrixXd& m_lhs = std::get<SharedMatrix>(v_lhs).read();
+                const Eigen::MatrixXd& m_rhs = std::get<SharedMatrix>(v_rhs).read();
                 if(m_lhs.rows() != m_rhs.rows() || m_lhs.cols() != m_rhs.cols()){
                     error(DIMENSION_MISMATCH, rhs);
                     break;
                 }
             }
 
-            v_lhs = v_rhs;
+            v_lhs = std::move(v_rhs);
             break;
         }
 
@@ -504,15 +587,15 @@ void Interpreter::reassign(ParseNode lhs, ParseNode rhs){
             Value& v_lhs = readClosedVar(lhs);
             if(v_rhs.index() != v_lhs.index()) error(DIMENSION_MISMATCH, rhs);
             else if(v_rhs.index() == MatrixXd_index){
-                const Eigen::MatrixXd& m_lhs = std::get<Eigen::MatrixXd>(v_lhs);
-                const Eigen::MatrixXd& m_rhs = std::get<Eigen::MatrixXd>(v_rhs);
+                const Eigen::MatrixXd& m_lhs = std::get<SharedMatrix>(v_lhs).read();
+                const Eigen::MatrixXd& m_rhs = std::get<SharedMatrix>(v_rhs).read();
                 if(m_lhs.rows() != m_rhs.rows() || m_lhs.cols() != m_rhs.cols()){
                     error(DIMENSION_MISMATCH, rhs);
                     break;
                 }
             }
 
-            v_lhs = v_rhs;
+            v_lhs = std::move(v_rhs);
             break;
         }
 
@@ -525,6 +608,18 @@ void Interpreter::reassign(ParseNode lhs, ParseNode rhs){
     }
 }
 
+template<typename SliceType>
+void Interpreter::assignSlice(SliceType& slice, const Value& rvalue, ParseNode rhs){
+    if(rvalue.index() == double_index){
+        if(slice.rows() == 1 && slice.cols() == 1) slice(0,0) = std::get<double>(rvalue);
+        else error(DIMENSION_MISMATCH, rhs);
+    }else{
+        const Eigen::MatrixXd& rmat = std::get<SharedMatrix>(rvalue).read();
+        if(rmat.cols() == slice.cols() && rmat.rows() == slice.rows()) slice = rmat;
+        else error(DIMENSION_MISMATCH, rhs);
+    }
+}
+
 void Interpreter::reassignSubscript(ParseNode lhs, ParseNode rhs){
     size_t num_indices = parse_tree.getNumArgs(lhs)-1;
     Value rvalue = interpretExpr(rhs);
@@ -547,16 +642,10 @@ void Interpreter::reassignSubscript(ParseNode lhs, ParseNode rhs){
             return;
 
         case MatrixXd_index:{
-            Eigen::MatrixXd& lmat = std::get<Eigen::MatrixXd>(lvalue);
-
-            Eigen::MatrixXd rmat;
-            if(rvalue.index() == double_index){
-                rmat.resize(1,1);
-                rmat(0,0) = std::get<double>(rvalue);
-            }else if(rvalue.index() == MatrixXd_index){
-                assert(rvalue.index() == MatrixXd_index);
-                rmat = std::get<Eigen::MatrixXd>(rvalue);
-            }else{
+            Eigen::MatrixXd& lmat = std::get<SharedMatrix>(lvalue).write();
+
+            //Write straight into the stored matrix. The rhs is already evaluated, so it cannot alias lmat.
+            if(rvalue.index() != double_index && rvalue.index() != MatrixXd_index){
                 error(TYPE_ERROR, rhs);
                 return;
             }
@@ -571,11 +660,7 @@ void Interpreter::reassignSubscript(ParseNode lhs, ParseNode rhs){
                 Slice s = readSubscript(index_node, lmat.size());
                 if(status != NORMAL) return;
                 auto v = lmat.cols() == 1 ? lmat(s, Slice(0, 1, Eigen::fix<1>)) : lmat(Slice(0, 1, Eigen::fix<1>), s);
-
-                if(rmat.cols() == v.cols() && rmat.rows() == v.rows())
-                    v = rmat;
-                else
-                    error(DIMENSION_MISMATCH, rhs);
+                assignSlice(v, rvalue, rhs);
             }else if(num_indices == 2){
                 ParseNode row_node = parse_tree.arg<1>(lhs);
                 Slice rows = readSubscript(row_node, lmat.rows());
@@ -583,10 +668,7 @@ void Interpreter::reassignSubscript(ParseNode lhs, ParseNode rhs){
                 Slice cols = readSubscript(col_node, lmat.cols());
                 if(status != NORMAL) return;
                 auto m = lmat(rows, cols);
-                if(rmat.cols() == m.cols() && rmat.rows() == m.rows())
-                    m = rmat;
-                else
-                    error(DIMENSION_MISMATCH, rhs);
+                assignSlice(m, rvalue, rhs);
             }else{
                 error(INDEX_OUT_OF_RANGE, lhs);
             }
@@ -622,27 +704,48 @@ void Interpreter::elementWiseAssignment(ParseNode pn){
 
     assert(lvalue.index() == MatrixXd_index);
 
-    Eigen::MatrixXd lmat = std::get<Eigen::MatrixXd>(lvalue);
-
     if(num_subscripts == 1){
-        if((lmat.rows() > 1) & (lmat.cols() > 1)){
+        const Eigen::MatrixXd& target = std::get<SharedMatrix>(lvalue).read();
+        if((target.rows() > 1) & (target.cols() > 1)){
             error(DIMENSION_MISMATCH, lhs);
             return;
         }
+    }
 
+    //Fill the stored matrix in place, unless the rhs reads the old values
+    const size_t strategy = parse_tree.getEwiseStrategy(pn);
+    const bool taken = (strategy != EWISE_COPY_TARGET);
+    Eigen::MatrixXd lmat = taken ?
+                           std::get<SharedMatrix>(lvalue).take() :
+                           std::get<SharedMatrix>(lvalue).read();
+
+    //A taken matrix is put back before an error, so the variable is not left empty
+    auto restore = [&](){
+        if(taken) read(lvalue_node) = std::move(lmat);
+    };
+
+    if(num_subscripts == 1){
         stack.push(0.0   DEBUG_STACK_ARG(parse_tree.str(parse_tree.arg<1>(lhs))));
-        for(Eigen::Index i = 0; i < lmat.size(); i++){
-            stack.back() = static_cast<double>(i);
-            Value rvalue = interpretExpr(rhs);
-            if(rvalue.index() != double_index){
-                error(TYPE_ERROR, rhs);
+        if(strategy == EWISE_VECTORISED && assignVectorised(rhs, lmat, false)){
+            if(status != NORMAL){
+                restore();
                 return;
             }
-            lmat(i) = std::get<double>(rvalue);
+        }else{
+            for(Eigen::Index i = 0; i < lmat.size(); i++){
+                stack.back() = static_cast<double>(i);
+                Value rvalue = interpretExpr(rhs);
+                if(rvalue.index() != double_index){
+                    restore();
+                    error(TYPE_ERROR, rhs);
+                    return;
+                }
+                lmat(i) = std::get<double>(rvalue);
+            }
         }
         stack.pop();
 
-        read(lvalue_node) = lmat;
+        read(lvalue_node) = std::move(lmat);
         return;
     }
 
@@ -656,11 +759,13 @@ void Interpreter::elementWiseAssignment(ParseNode pn){
                 stack.back() = static_cast<double>(i);
                 Value rvalue = interpretExpr(rhs);
                 if(rvalue.index() != MatrixXd_index){
+                    restore();
                     error(TYPE_ERROR, rhs);
                     return;
                 }
-                const Eigen::MatrixXd& rmat = std::get<Eigen::MatrixXd>(rvalue);
+                const Eigen::MatrixXd& rmat = std::get<SharedMatrix>(rvalue).read();
                 if(rmat.cols() != 1 || rmat.rows() != lmat.rows()){
+                    restore();
                     error(DIMENSION_MISMATCH, rhs);
                     return;
                 }
@@ -671,6 +776,7 @@ void Interpreter::elementWiseAssignment(ParseNode pn){
                 stack.back() = static_cast<double>(i);
                 Value rvalue = interpretExpr(rhs);
                 if(rvalue.index() != double_index){
+                    restore();
                     error(TYPE_ERROR, rhs);
                     return;
                 }
@@ -678,7 +784,7 @@ void Interpreter::elementWiseAssignment(ParseNode pn){
             }
         }
         stack.pop();
-        read(lvalue_node) = lmat;
+        read(lvalue_node) = std::move(lmat);
     }else if(type_col == OP_SLICE){
         stack.push(0.0   DEBUG_STACK_ARG(parse_tree.str(parse_tree.arg<1>(lhs))));
         if(lmat.cols() > 1){
@@ -686,11 +792,13 @@ void Interpreter::elementWiseAssignment(ParseNode pn){
                 stack.back() = static_cast<double>(i);
                 Value rvalue = interpretExpr(rhs);
                 if(rvalue.index() != MatrixXd_index){
+                    restore();
                     error(TYPE_ERROR, rhs);
                     return;
                 }
-                const Eigen::MatrixXd& rmat = std::get<Eigen::MatrixXd>(rvalue);
+                const Eigen::MatrixXd& rmat = std::get<SharedMatrix>(rvalue).read();
                 if(rmat.rows() != 1 || rmat.cols() != lmat.cols()){
+                    restore();
                     error(DIMENSION_MISMATCH, rhs);
                     return;
                 }
@@ -701,6 +809,7 @@ void Interpreter::elementWiseAssignment(ParseNode pn){
                 stack.back() = static_cast<double>(i);
                 Value rvalue = interpretExpr(rhs);
                 if(rvalue.index() != double_index){
+                    restore();
                     error(TYPE_ERROR, rhs);
                     return;
                 }
@@ -708,28 +817,212 @@ void Interpreter::elementWiseAssignment(ParseNode pn){
             }
         }
         stack.pop();
-        read(lvalue_node) = lmat;
+        read(lvalue_node) = std::move(lmat);
     }else{
         stack.push(0.0   DEBUG_STACK_ARG(parse_tree.str(parse_tree.arg<1>(lhs))));
         stack.push(0.0   DEBUG_STACK_ARG(parse_tree.str(parse_tree.arg<2>(lhs))));
-        for(Eigen::Index i = 0; i < lmat.rows(); i++){
-            stack[stack.size()-2] = static_cast<double>(i);
-            for(Eigen::Index j = 0; j < lmat.cols(); j++){
-                stack.back() = static_cast<double>(j);
-                Value rvalue = interpretExpr(rhs);
-                if(rvalue.index() != double_index){
-                    error(TYPE_ERROR, rhs);
-                    return;
+        if(strategy == EWISE_VECTORISED && assignVectorised(rhs, lmat, true)){
+            if(status != NORMAL){
+                restore();
+                return;
+            }
+        }else{
+            for(Eigen::Index i = 0; i < lmat.rows(); i++){
+                stack[stack.size()-2] = static_cast<double>(i);
+                for(Eigen::Index j = 0; j < lmat.cols(); j++){
+                    stack.back() = static_cast<double>(j);
+                    Value rvalue = interpretExpr(rhs);
+                    if(rvalue.index() != double_index){
+                        restore();
+                        error(TYPE_ERROR, rhs);
+                        return;
+                    }
+                    lmat(i,j) = std::get<double>(rvalue);
                 }
-                lmat(i,j) = std::get<double>(rvalue);
             }
         }
         stack.pop();
         stack.pop();
-        read(lvalue_node) = lmat;
+        read(lvalue_node) = std::move(lmat);
+    }
+}
+
+/// Straight-line code for an element-wise rhs, run over a whole column of indices at a time.
+/// Registers which do not depend on the indices are filled once, before the first column.
+struct Interpreter::ColumnTape {
+    static constexpr size_t ROW_INDEX = 0;
+    static constexpr size_t COL_INDEX = 1;
+    static constexpr size_t FAILED = std::numeric_limits<size_t>::max();
+
+    struct Instruction {
+        Op op;
+        ParseNode pn;
+        size_t a;
+        size_t b;
+        size_t out;
+    };
+
+    const Value* row_slot;
+    const Value* col_slot;
+    std::vector<Eigen::ArrayXd> registers;
+    std::vector<Instruction> instructions;
+
+    size_t addRegister(Eigen::Index rows, double val = 0){
+        registers.push_back(Eigen::ArrayXd::Constant(rows, val));
+        return registers.size()-1;
+    }
+};
+
+bool Interpreter::assignVectorised(ParseNode rhs, Eigen::MatrixXd& lmat, bool has_col){
+    const Eigen::Index rows = has_col ? lmat.rows() : lmat.size();
+    const Eigen::Index cols = has_col ? lmat.cols() : 1;
+
+    ColumnTape tape;
+    tape.row_slot = has_col ? &stack[stack.size()-2] : &stack.back();
+    tape.col_slot = has_col ? &stack.back() : nullptr;
+    tape.registers.push_back(Eigen::ArrayXd::LinSpaced(rows, 0, static_cast<double>(rows-1)));
+    tape.addRegister(rows);
+
+    //Fall back to interpreting each element if a variable turns out not to be scalar
+    const size_t result = compileColumn(tape, rhs);
+    if(result == ColumnTape::FAILED) return status != NORMAL;
+
+    for(Eigen::Index j = 0; j < cols; j++){
+        tape.registers[ColumnTape::COL_INDEX].setConstant(static_cast<double>(j));
+        if(!evaluateColumn(tape)) return true;
+        if(has_col) lmat.col(j) = tape.registers[result].matrix();
+        else lmat.reshaped() = tape.registers[result].matrix();
+    }
+
+    return true;
+}
+
+bool Interpreter::readsIndex(const ColumnTape& tape, ParseNode pn){
+    switch(parse_tree.getOp(pn)){
+        case OP_IDENTIFIER:
+        case OP_READ_GLOBAL:
+        case OP_READ_UPVALUE:{
+            const Value* v = &read(pn);
+            return v == tape.row_slot || v == tape.col_slot;
+        }
+        default:
+            for(size_t i = 0; i < parse_tree.getNumArgs(pn); i++)
+                if(readsIndex(tape, parse_tree.arg(pn, i))) return true;
+            return false;
+    }
+}
+
+size_t Interpreter::compileColumn(ColumnTape& tape, ParseNode pn){
+    const Eigen::Index rows = tape.registers[ColumnTape::ROW_INDEX].size();
+
+    //The linker only vectorises pure arithmetic, so an index-free subtree is evaluated just once
+    if(!readsIndex(tape, pn)){
+        Value v = interpretExpr(pn);
+        if(status != NORMAL || v.index() != double_index) return ColumnTape::FAILED;
+        return tape.addRegister(rows, std::get<double>(v));
+    }
+
+    const Op op = parse_tree.getOp(pn);
+    switch(op){
+        case OP_IDENTIFIER:
+        case OP_READ_GLOBAL:
+        case OP_READ_UPVALUE:
+            return &read(pn) == tape.row_slot ? ColumnTape::ROW_INDEX : ColumnTape::COL_INDEX;
+        case OP_GROUP_PAREN:
+        case OP_GROUP_BRACKET:
+        case OP_CHECK_SCALAR:
+            return compileColumn(tape, parse_tree.child(pn));
+        case OP_IMPLICIT_MULTIPLY:{
+            //Right fold, matching implicitMult
+            size_t b = compileColumn(tape, parse_tree.arg(pn, parse_tree.getNumArgs(pn)-1));
+            for(size_t i = parse_tree.getNumArgs(pn)-1; i-->0 && b != ColumnTape::FAILED;){
+                size_t a = compileColumn(tape, parse_tree.arg(pn, i));
+                if(a == ColumnTape::FAILED) return ColumnTape::FAILED;
+                tape.instructions.push_back({OP_MULTIPLICATION, pn, a, b, tape.addRegister(rows)});
+                b = tape.instructions.back().out;
+            }
+            return b;
+        }
+        case OP_ADDITION:
+        case OP_SUBTRACTION:
+        case OP_MULTIPLICATION:
+        case OP_DIVIDE:
+        case OP_FRACTION:
+        case OP_FORWARDSLASH:
+        case OP_POWER:{
+            size_t a = compileColumn(tape, parse_tree.lhs(pn));
+            if(a == ColumnTape::FAILED) return ColumnTape::FAILED;
+            size_t b = compileColumn(tape, parse_tree.rhs(pn));
+            if(b == ColumnTape::FAILED) return ColumnTape::FAILED;
+            tape.instructions.push_back({op, pn, a, b, tape.addRegister(rows)});
+            return tape.instructions.back().out;
+        }
+        case OP_UNARY_MINUS:
+        case OP_SQRT:
+        case OP_ABS:
+        case OP_SINE:
+        case OP_COSINE:
+        case OP_TANGENT:
+        case OP_EXP:
+        case OP_NATURAL_LOG:{
+            size_t a = compileColumn(tape, parse_tree.child(pn));
+            if(a == ColumnTape::FAILED) return ColumnTape::FAILED;
+            tape.instructions.push_back({op, pn, a, ColumnTape::FAILED, tape.addRegister(rows)});
+            return tape.instructions.back().out;
+        }
+        default:
+            return ColumnTape::FAILED;
     }
 }
 
+bool Interpreter::evaluateColumn(ColumnTape& tape){
+    for(const ColumnTape::Instruction& instruction : tape.instructions){
+        Eigen::ArrayXd& out = tape.registers[instruction.out];
+        const Eigen::ArrayXd& a = tape.registers[instruction.a];
+
+        switch(instruction.op){
+            case OP_ADDITION: out = a + tape.registers[instruction.b]; break;
+            case OP_SUBTRACTION: out = a - tape.registers[instruction.b]; break;
+            case OP_MULTIPLICATION: out = a * tape.registers[instruction.b]; break;
+            case OP_DIVIDE:
+            case OP_FRACTION:
+            case OP_FORWARDSLASH:{
+                const Eigen::ArrayXd& b = tape.registers[instruction.b];
+                if((b == 0).any()){
+                    error(DIV_BY_ZERO, instruction.pn);
+                    return false;
+                }
+                out = a / b;
+                break;
+            }
+            case OP_POWER: out = a.pow(tape.registers[instruction.b]); break;
+            case OP_UNARY_MINUS: out = -a; break;
+            case OP_SQRT:
+                if((a < 0).any()){
+                    error(IMAGINARY_RESULT, instruction.pn);
+                    return false;
+                }
+                out = a.sqrt();
+                break;
+            case OP_ABS: out = a.abs(); break;
+            case OP_SINE: out = a.sin(); break;
+            case OP_COSINE: out = a.cos(); break;
+            case OP_TANGENT: out = a.tan(); break;
+            case OP_EXP: out = a.exp(); break;
+            case OP_NATURAL_LOG:
+                if((a <= 0).any()){
+                    error(LOG_ARG, instruction.pn);
+                    return false;
+                }
+                out = a.log();
+                break;
+            default: assert(false);
+        }
+    }
+
+    return true;
+}
+
 Value& Interpreter::read(ParseNode pn) noexcept {
     //EVENTUALLY: this switch should be resolved at compile time
     switch (parse_tree.getOp(pn)) {
@@ -742,6 +1035,17 @@ Value& Interpreter::read(ParseNode pn) noexcept {
     }
 }
 
+bool Interpreter::isVariableRead(ParseNode pn) const noexcept {
+    switch (parse_tree.getOp(pn)) {
+        case OP_IDENTIFIER:
+        case OP_READ_GLOBAL:
+        case OP_READ_UPVALUE:
+            return true;
+        default:
+            return false;
+    }
+}
+
 static Value error_kludge;
 
 Value& Interpreter::readLocal(ParseNode pn) noexcept {
@@ -804,7 +1108,7 @@ Value Interpreter::matrix(ParseNode pn){
                 if(error_code != NO_ERROR_FOUND) return &error_code;
                 if(error_code != NO_ERROR_FOUND) return &error_code;
                 assert(e.index() == MatrixXd_index);
-                const Eigen::MatrixXd& e_mat = std::get<Eigen::MatrixXd>(e);
+                const Eigen::MatrixXd& e_mat = std::get<SharedMatrix>(e).read();
                 if(i==0) elem_cols[j] = e_mat.cols();
                 else if(elem_cols[j] != e_mat.cols()) return error(ErrorCode::DIMENSION_MISMATCH, pn);
                 if(j==0) elem_rows[i] = e_mat.rows();
@@ -830,7 +1134,7 @@ Value Interpreter::matrix(ParseNode pn){
             }else{
                 if(error_code != NO_ERROR_FOUND) return &error_code;
                 assert(e.index() == MatrixXd_index);
-                const Eigen::MatrixXd& e_mat = std::get<Eigen::MatrixXd>(e);
+                const Eigen::MatrixXd& e_mat = std::get<SharedMatrix>(e).read();
                 mat.block(row, col, e_mat.rows(), e_mat.cols()) = e_mat;
             }
 
@@ -871,11 +1175,6 @@ Value Interpreter::greater(ParseNode pn){
     return true;
 }
 
-Value Interpreter::str(ParseNode pn) const {
-    std::string s = parse_tree.str(pn);
-    return s.substr(1, s.size()-2);
-}
-
 Value Interpreter::anonFun(ParseNode pn){
     Lambda l(pn);
 
@@ -1010,7 +1309,7 @@ Value Interpreter::elementAccess(ParseNode pn){
     }else{
         assert(lhs.index() == MatrixXd_index);
 
-        const Eigen::MatrixXd& mat = std::get<Eigen::MatrixXd>(lhs);
+        const Eigen::MatrixXd& mat = std::get<SharedMatrix>(lhs).read();
         if(num_indices == 1){
             if(mat.rows() > 1 && mat.cols() > 1){
                 error(INDEX_OUT_OF_RANGE, pn);
@@ -1118,12 +1417,12 @@ void Interpreter::printNode(const ParseNode& pn){
         case bool_index: str = std::get<bool>(val) ? "true" : "false"; break;
 
         case string_index:
-            str = std::get<std::string>(val);
+            str = std::get<String>(val).str();
             removeEscapes(str);
             break;
 
         case MatrixXd_index:{
-            auto mat = std::get<Eigen::MatrixXd>(val);
+            const Eigen::MatrixXd& mat = std::get<SharedMatrix>(val).read();
             str += CONSTRUCT_STR "[";
             str += std::to_string(mat.rows());
             str += 'x';
@@ -1232,34 +1531,34 @@ Value Interpreter::finiteDiff(ParseNode pn){
             ans = (std::get<double>(f_incr) - std::get<double>(f)) / INCR;
         }else{
             assert(f.index() == MatrixXd_index);
-            ans = (std::get<Eigen::MatrixXd>(f_incr) - std::get<Eigen::MatrixXd>(f)) / INCR;
+            ans = (std::get<SharedMatrix>(f_incr).read() - std::get<SharedMatrix>(f).read()) / INCR;
         }
     }else{
         assert(val.index() == MatrixXd_index);
-        const Eigen::MatrixXd& v = std::get<Eigen::MatrixXd>(val);
+        const Eigen::MatrixXd& v = std::get<SharedMatrix>(val).read();
         if(v.cols() != 1) return error(DIMENSION_MISMATCH, val_pn);
 
         if(f.index() == double_index){
             Eigen::MatrixXd a(1, v.rows());
             for(Eigen::Index i = 0; i < v.rows(); i++){
-                double orig = std::get<Eigen::MatrixXd>(stack.back())(i);
-                std::get<Eigen::MatrixXd>(stack.back())(i) += INCR;
+                double orig = std::get<SharedMatrix>(stack.back()).read()(i);
+                std::get<SharedMatrix>(stack.back()).write()(i) += INCR;
                 Value f_incr = interpretExpr(expr);
                 a(i) = (std::get<double>(f_incr) - std::get<double>(f)) / INCR;
-                std::get<Eigen::MatrixXd>(stack.back())(i) = orig;
+                std::get<SharedMatrix>(stack.back()).write()(i) = orig;
             }
             ans = a;
         }else{
             assert(f.index() == MatrixXd_index);
-            const Eigen::MatrixXd& m = std::get<Eigen::MatrixXd>(f);
+            const Eigen::MatrixXd& m = std::get<SharedMatrix>(f).read();
             if(m.cols() != 1) return error(DIMENSION_MISMATCH, expr);
             Eigen::MatrixXd a(m.rows(), v.rows());
             for(Eigen::Index i = 0; i < v.rows(); i++){
-                double orig = std::get<Eigen::MatrixXd>(stack.back())(i);
-                std::get<Eigen::MatrixXd>(stack.back())(i) += INCR;
+                double orig = std::get<SharedMatrix>(stack.back()).read()(i);
+                std::get<SharedMatrix>(stack.back()).write()(i) += INCR;
                 Value f_incr = interpretExpr(expr);
-                a.col(i) = (std::get<Eigen::MatrixXd>(f_incr) - std::get<Eigen::MatrixXd>(f)) / INCR;
-                std::get<Eigen::MatrixXd>(stack.back())(i) = orig;
+                a.col(i) = (std::get<SharedMatrix>(f_incr).read() - std::get<SharedMatrix>(f).read()) / INCR;
+                std::get<SharedMatrix>(stack.back()).write()(i) = orig;
             }
             ans = a;
         }
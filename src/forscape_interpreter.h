@@ -1,6 +1,7 @@
 #ifndef FORSCAPE_INTERPRETER_H
 #define FORSCAPE_INTERPRETER_H
 
+#include "forscape_message.h"
 #include "forscape_parse_tree.h"
 #include "forscape_stack.h"
 #include "forscape_static_pass.h"
@@ -11,8 +12,6 @@
 
 namespace Forscape {
 
-class InterpreterOutput;
-
 namespace Code {
 
 class ParseTree;
@@ -50,26 +49,36 @@ public:
     void run(
         const ParseTree& parse_tree,
         const InstantiationLookup& inst_lookup,
-        const NumericSwitchMap& number_switch,
-        const StringSwitchMap& string_switch);
+        const SwitchTables& switch_tables,
+        std::shared_ptr<const StringTable> strings);
     void runThread(
         const ParseTree& parse_tree,
         const InstantiationLookup& inst_lookup,
-        const NumericSwitchMap& number_switch,
-        const StringSwitchMap& string_switch);
+        const SwitchTables& switch_tables,
+        std::shared_ptr<const StringTable> strings);
     void execute();
     void stop();
     Value error(ErrorCode code, ParseNode pn) noexcept;
 
 private:
     std::vector<size_t> frames;
+    std::vector<Value> saved_invariants; //Cached by enclosing activations of a loop which has been re-entered
     ParseTree parse_tree;
     InstantiationLookup inst_lookup;
-    NumericSwitchMap number_switch;
-    StringSwitchMap string_switch;
+    SwitchTables switch_tables;
+    std::shared_ptr<const StringTable> strings;
     Closure* active_closure = nullptr;
     Stack stack;
 
+    /// The series each plot statement last sent this run, so executing it again can stream onto the same plot
+    struct PlotStream {
+        size_t id;
+        PlotColumns sent;
+        bool scalar;
+    };
+    FORSCAPE_UNORDERED_MAP<ParseNode, PlotStream> plot_streams;
+    size_t plots_created = 0;
+
     void reset() noexcept;
     void interpretStmt(ParseNode pn);
     void interpretStmtIfNotNone(ParseNode pn);
@@ -79,6 +88,9 @@ private:
     void whileStmt(ParseNode pn);
     void forStmt(ParseNode pn);
     void rangedForStmt(ParseNode pn);
+    void enterLoop(ParseNode pn);
+    void exitLoop(ParseNode pn);
+    Value loopInvariant(ParseNode pn);
     void ifStmt(ParseNode pn);
     void ifElseStmt(ParseNode pn);
     void blockStmt(ParseNode pn);
@@ -89,6 +101,8 @@ private:
     void breakLocalClosureLinks(Closure& closure, ParseNode val_cap, ParseNode ref_cap);
     void returnStmt(ParseNode pn);
     void plotStmt(ParseNode pn);
+    static PlotColumns tail(const PlotColumns& data, size_t offset) alloc_except;
+    static bool extends(const PlotColumns& sent, const PlotColumns& data) noexcept;
     Value implicitMult(ParseNode pn, size_t start = 0);
     Value sum(ParseNode pn);
     Value prod(ParseNode pn);
@@ -101,15 +115,21 @@ private:
     Value binaryDispatch(Op type, const Value& lhs, const Value& rhs, ParseNode op_node);
     void reassign(ParseNode lhs, ParseNode rhs);
     void reassignSubscript(ParseNode lhs, ParseNode rhs);
+    template<typename SliceType> void assignSlice(SliceType& slice, const Value& rvalue, ParseNode rhs);
     void elementWiseAssignment(ParseNode pn);
+    struct ColumnTape;
+    bool assignVectorised(ParseNode rhs, Eigen::MatrixXd& lmat, bool has_col);
+    bool readsIndex(const ColumnTape& tape, ParseNode pn);
+    size_t compileColumn(ColumnTape& tape, ParseNode pn);
+    bool evaluateColumn(ColumnTape& tape);
     Value& read(ParseNode pn) noexcept;
+    bool isVariableRead(ParseNode pn) const noexcept;
     Value& readLocal(ParseNode pn) noexcept;
     Value& readGlobal(ParseNode pn) noexcept;
     Value& readClosedVar(ParseNode pn) const noexcept;
     Value matrix(ParseNode pn);
     Value less(ParseNode pn);
     Value greater(ParseNode pn);
-    Value str(ParseNode pn) const;
     Value anonFun(ParseNode pn);
     Value call(ParseNode pn);
     void callStmt(ParseNode pn);
@@ -1,8 +1,8 @@
 #ifndef FORSCAPE_MESSAGE_H
 #define FORSCAPE_MESSAGE_H
 
+#include <memory>
 #include <string>
-#include <vector>
 
 namespace Forscape {
 
@@ -10,6 +10,7 @@ class InterpreterOutput {
 public:
     enum MessageType {
         AddDiscreteSeries,
+        AppendDiscreteSeries,
         CreatePlot,
         Print,
     };
@@ -30,24 +31,37 @@ public:
     const std::string title;
     const std::string x_label;
     const std::string y_label;
+    const size_t id; //Names the plot for later appends
     virtual MessageType getType() const noexcept override { return CreatePlot; }
-    PlotCreate(const std::string& title, const std::string& x_label, const std::string& y_label) noexcept
-        : title(title), x_label(x_label), y_label(y_label) {}
+    PlotCreate(const std::string& title, const std::string& x_label, const std::string& y_label, size_t id) noexcept
+        : title(title), x_label(x_label), y_label(y_label), id(id) {}
+};
+
+/// Immutable x and y columns of a series. The columns share storage with the interpreter's matrices,
+/// which copy on write, so a series is handed to the GUI without copying its data.
+struct PlotColumns {
+    std::shared_ptr<const double> x;
+    std::shared_ptr<const double> y;
+    size_t size;
 };
 
 class PlotDiscreteSeries : public InterpreterOutput {
 public:
-    const std::vector<std::pair<double, double>> data;
+    const PlotColumns data;
     const std::string title;
     virtual MessageType getType() const noexcept override { return AddDiscreteSeries; }
-    PlotDiscreteSeries(const std::vector<std::pair<double, double>>& data, const std::string& title = "") noexcept
-        : data(data), title(title) {}
-    static PlotDiscreteSeries* FromArrays(const double* const x, const double* const y, size_t sze, const std::string& title = ""){
-        std::vector<std::pair<double, double>> data;
-        data.reserve(sze);
-        for(size_t i = 0; i < sze; i++) data.push_back(std::make_pair(x[i], y[i]));
-        return new PlotDiscreteSeries(data, title);
-    }
+    PlotDiscreteSeries(PlotColumns&& data, const std::string& title = "") noexcept
+        : data(std::move(data)), title(title) {}
+};
+
+/// Points continuing the last series of a plot which is already open
+class PlotAppend : public InterpreterOutput {
+public:
+    const PlotColumns data;
+    const size_t id;
+    virtual MessageType getType() const noexcept override { return AppendDiscreteSeries; }
+    PlotAppend(PlotColumns&& data, size_t id) noexcept
+        : data(std::move(data)), id(id) {}
 };
 
 }
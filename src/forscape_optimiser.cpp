@@ -0,0 +1,445 @@
+#include "forscape_optimiser.h"
+
+#include "forscape_symbol_table.h"
+#include <algorithm>
+
+namespace Forscape {
+
+namespace Code {
+
+Optimiser::Optimiser(ParseTree& parse_tree) noexcept
+    : parse_tree(parse_tree) {}
+
+void Optimiser::optimise(const InstantiationLookup& instantiations) alloc_except {
+    stats = OptimiserStats();
+    if(!enabled) return;
+
+    //Abstract function bodies never run, so only their instantiations are optimised
+    std::vector<ParseNode> functions;
+    for(const auto& entry : instantiations) functions.push_back(entry.second);
+    std::sort(functions.begin(), functions.end());
+    functions.erase(std::unique(functions.begin(), functions.end()), functions.end());
+
+    fold(parse_tree.root);
+    for(ParseNode fn : functions){
+        fold(parse_tree.paramList(fn));
+        fold(parse_tree.body(fn));
+    }
+
+    //Clones are linked by copying from their originals, so stack layouts may only change outside functions
+    eliminateDeadStores(parse_tree.root);
+
+    hoistStmt(parse_tree.root);
+    for(ParseNode fn : functions)
+        if(parse_tree.getOp(fn) == OP_ALGORITHM) hoistStmt(parse_tree.body(fn));
+}
+
+void Optimiser::fold(ParseNode pn) noexcept {
+    const Op op = parse_tree.getOp(pn);
+    switch(op){
+        case OP_ALGORITHM:
+        case OP_LAMBDA:
+        case OP_DECIMAL_LITERAL: //Children are the digit groups, which are not evaluated
+            return;
+        case OP_IMPORT:
+        case OP_FROM_IMPORT:
+            if(parse_tree.getFlag(pn) != NONE) fold(parse_tree.getFlag(pn));
+            return;
+        default: break;
+    }
+
+    const size_t num_args = parse_tree.getNumArgs(pn);
+    bool literal_args = true;
+    for(size_t i = 0; i < num_args; i++){
+        ParseNode arg = parse_tree.arg(pn, i);
+        if(arg == NONE){
+            literal_args = false;
+            continue;
+        }
+        fold(arg);
+        literal_args &= isLiteral(arg);
+    }
+
+    if(parse_tree.getType(pn) != StaticPass::NUMERIC || !literal_args) return;
+
+    double val;
+    switch(op){
+        case OP_GROUP_PAREN:
+        case OP_GROUP_BRACKET:
+            foldTo(pn, parse_tree.getDouble(parse_tree.child(pn)));
+            break;
+        case OP_IMPLICIT_MULTIPLY:
+            //Right fold, matching implicitMult
+            val = parse_tree.getDouble(parse_tree.arg(pn, num_args-1));
+            for(size_t i = num_args-1; i-->0;)
+                foldBinary(OP_MULTIPLICATION, parse_tree.getDouble(parse_tree.arg(pn, i)), val, val);
+            foldTo(pn, val);
+            break;
+        default:
+            if(num_args == 0 ? foldConstant(op, val) :
+               num_args == 1 ? foldUnary(op, parse_tree.getDouble(parse_tree.child(pn)), val) :
+               num_args == 2 && foldBinary(op, parse_tree.getDouble(parse_tree.lhs(pn)), parse_tree.getDouble(parse_tree.rhs(pn)), val))
+                foldTo(pn, val);
+    }
+}
+
+void Optimiser::foldTo(ParseNode pn, double val) noexcept {
+    parse_tree.setOp(pn, OP_DECIMAL_LITERAL);
+    parse_tree.setDouble(pn, val);
+    parse_tree.reduceNumArgs(pn, 0);
+    parse_tree.setScalar(pn);
+    stats.constants_folded++;
+}
+
+bool Optimiser::isLiteral(ParseNode pn) const noexcept {
+    switch(parse_tree.getOp(pn)){
+        case OP_INTEGER_LITERAL:
+        case OP_DECIMAL_LITERAL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void Optimiser::hoistStmt(ParseNode pn) alloc_except {
+    switch(parse_tree.getOp(pn)){
+        case OP_ASSERT:
+        case OP_EXPR_STMT:
+        case OP_RETURN:
+            parse_tree.setArg<0>(pn, hoistExpr(parse_tree.child(pn)));
+            break;
+        case OP_ASSIGN:
+        case OP_EQUAL:
+        case OP_REASSIGN:
+            parse_tree.setArg<1>(pn, hoistExpr(parse_tree.rhs(pn)));
+            break;
+        case OP_BLOCK:
+            for(size_t i = 0; i < parse_tree.getNumArgs(pn); i++)
+                hoistStmt(parse_tree.arg(pn, i));
+            break;
+        case OP_IF:
+            parse_tree.setArg<0>(pn, hoistExpr(parse_tree.arg<0>(pn)));
+            hoistStmt(parse_tree.arg<1>(pn));
+            break;
+        case OP_IF_ELSE:
+            parse_tree.setArg<0>(pn, hoistExpr(parse_tree.arg<0>(pn)));
+            hoistStmt(parse_tree.arg<1>(pn));
+            hoistStmt(parse_tree.arg<2>(pn));
+            break;
+        case OP_FOR:
+        case OP_RANGED_FOR:
+        case OP_WHILE:
+            hoistLoop(pn);
+            break;
+        case OP_IMPORT:
+        case OP_FROM_IMPORT:
+            if(parse_tree.getFlag(pn) != NONE) hoistStmt(parse_tree.getFlag(pn));
+            break;
+        case OP_NAMESPACE:
+            hoistStmt(parse_tree.rhs(pn));
+            break;
+        case OP_PLOT:
+        case OP_PRINT:
+            for(size_t i = 0; i < parse_tree.getNumArgs(pn); i++)
+                parse_tree.setArg(pn, i, hoistExpr(parse_tree.arg(pn, i)));
+            break;
+        case OP_SWITCH_NUMERIC:
+        case OP_SWITCH_STRING:
+            parse_tree.setArg<0>(pn, hoistExpr(parse_tree.arg<0>(pn)));
+            for(size_t i = 1; i < parse_tree.getNumArgs(pn); i++){
+                ParseNode stmt = parse_tree.rhs(parse_tree.arg(pn, i));
+                if(stmt != NONE) hoistStmt(stmt);
+            }
+            break;
+        default:
+            //Elementwise assignments are left alone, since the linker vectorises their rhs
+            break;
+    }
+}
+
+void Optimiser::hoistLoop(ParseNode pn) alloc_except {
+    Loop loop;
+    loop.pn = pn;
+    findWrites(pn, loop);
+
+    //The initialiser and range are evaluated once per entry, so they belong to the enclosing loop
+    const Op op = parse_tree.getOp(pn);
+    if(op == OP_FOR) hoistStmt(parse_tree.arg<0>(pn));
+    else if(op == OP_RANGED_FOR) parse_tree.setArg<1>(pn, hoistExpr(parse_tree.arg<1>(pn)));
+
+    loops.push_back(std::move(loop));
+    switch(op){
+        case OP_WHILE:
+            parse_tree.setArg<0>(pn, hoistExpr(parse_tree.arg<0>(pn)));
+            hoistStmt(parse_tree.arg<1>(pn));
+            break;
+        case OP_FOR:
+            parse_tree.setArg<1>(pn, hoistExpr(parse_tree.arg<1>(pn)));
+            hoistStmt(parse_tree.arg<2>(pn));
+            hoistStmt(parse_tree.arg<3>(pn));
+            break;
+        default:
+            hoistStmt(parse_tree.arg<2>(pn));
+    }
+
+    const std::vector<ParseNode>& invariants = loops.back().invariants;
+    if(!invariants.empty())
+        parse_tree.setLoopInvariants(pn, parse_tree.addNode(OP_LIST, parse_tree.getSelection(pn), invariants));
+    loops.pop_back();
+}
+
+ParseNode Optimiser::hoistExpr(ParseNode pn) alloc_except {
+    if(loops.empty()) return pn;
+    const Invariance inv = scan(pn);
+    return inv.pure && inv.level < loops.size() && parse_tree.getNumArgs(pn) != 0 ? wrap(pn, inv.level) : pn;
+}
+
+Optimiser::Invariance Optimiser::scan(ParseNode pn) alloc_except {
+    const Op op = parse_tree.getOp(pn);
+    const bool numeric = parse_tree.getType(pn) == StaticPass::NUMERIC;
+
+    switch(op){
+        case OP_IDENTIFIER:{
+            const Symbol* sym = canonical(parse_tree.getSymbol(pn));
+            size_t level = 0;
+            for(size_t i = 0; i < loops.size(); i++)
+                if(isWritten(sym, loops[i])) level = i+1;
+            return {numeric, level};
+        }
+        case OP_ALGORITHM:
+        case OP_LAMBDA:
+            //The body runs in its own frame, possibly long after the loop
+            return {false, loops.size()};
+        default: break;
+    }
+
+    const size_t num_args = parse_tree.getNumArgs(pn);
+    Invariance inv = {numeric && isHoistable(op), 0};
+    std::vector<Invariance> args;
+    args.reserve(num_args);
+    for(size_t i = 0; i < num_args; i++){
+        ParseNode arg = parse_tree.arg(pn, i);
+        args.push_back(arg == NONE ? Invariance{false, loops.size()} : scan(arg));
+        inv.pure &= args.back().pure;
+        inv.level = std::max(inv.level, args.back().level);
+    }
+
+    //Hoist the largest invariant subexpressions, which may still vary in loops where this expression does not
+    for(size_t i = 0; i < num_args; i++){
+        ParseNode arg = parse_tree.arg(pn, i);
+        const Invariance& arg_inv = args[i];
+        if(arg_inv.pure && arg_inv.level < loops.size() && parse_tree.getNumArgs(arg) != 0
+           && (!inv.pure || arg_inv.level < inv.level))
+            parse_tree.setArg(pn, i, wrap(arg, arg_inv.level));
+    }
+
+    return inv;
+}
+
+ParseNode Optimiser::wrap(ParseNode pn, size_t level) alloc_except {
+    ParseNode invariant = parse_tree.addUnary(OP_LOOP_INVARIANT, parse_tree.getSelection(pn), pn);
+    parse_tree.setType(invariant, parse_tree.getType(pn));
+    parse_tree.copyDims(invariant, pn);
+    parse_tree.setValue(invariant, Value()); //Empty until the interpreter caches the result
+    loops[level].invariants.push_back(invariant);
+    stats.invariants_hoisted++;
+
+    return invariant;
+}
+
+void Optimiser::findWrites(ParseNode pn, Loop& loop) const alloc_except {
+    switch(parse_tree.getOp(pn)){
+        case OP_DO_NOTHING:
+            return;
+        case OP_ASSIGN:
+        case OP_EQUAL:
+        case OP_REASSIGN:
+            if(parse_tree.getNumArgs(pn) == 2) addWrite(parse_tree.lhs(pn), loop);
+            break;
+        case OP_ELEMENTWISE_ASSIGNMENT:{
+            ParseNode lhs = parse_tree.lhs(pn);
+            for(size_t i = 0; i < parse_tree.getNumArgs(lhs); i++)
+                addWrite(parse_tree.arg(lhs, i), loop);
+            break;
+        }
+        case OP_RANGED_FOR:
+        case OP_DEFINITE_INTEGRAL:
+            addWrite(parse_tree.arg<0>(pn), loop);
+            break;
+        case OP_DERIVATIVE:
+        case OP_PARTIAL:
+            addWrite(parse_tree.arg<1>(pn), loop);
+            break;
+        case OP_ALGORITHM:
+            addWrite(parse_tree.algName(pn), loop);
+            [[fallthrough]];
+        case OP_LAMBDA:{
+            ParseNode params = parse_tree.paramList(pn);
+            for(size_t i = 0; i < parse_tree.getNumArgs(params); i++)
+                addWrite(parse_tree.arg(params, i), loop);
+            break;
+        }
+        case OP_CALL:
+        case OP_PLOT:
+            loop.has_call = true;
+            break;
+        case OP_IMPLICIT_MULTIPLY:
+            //A function value may be applied by juxtaposition
+            for(size_t i = 0; i < parse_tree.getNumArgs(pn); i++)
+                loop.has_call |= parse_tree.getType(parse_tree.arg(pn, i)) != StaticPass::NUMERIC;
+            break;
+        default: break;
+    }
+
+    for(size_t i = 0; i < parse_tree.getNumArgs(pn); i++){
+        ParseNode arg = parse_tree.arg(pn, i);
+        if(arg != NONE) findWrites(arg, loop);
+    }
+}
+
+void Optimiser::addWrite(ParseNode lvalue, Loop& loop) const alloc_except {
+    switch(parse_tree.getOp(lvalue)){
+        case OP_IDENTIFIER:
+            loop.written.push_back(canonical(parse_tree.getSymbol(lvalue)));
+            break;
+        case OP_SUBSCRIPT_ACCESS:
+            addWrite(parse_tree.arg<0>(lvalue), loop);
+            break;
+        default: break;
+    }
+}
+
+bool Optimiser::isWritten(const Symbol* sym, const Loop& loop) const noexcept {
+    return (loop.has_call && sym->is_reassigned) ||
+           std::find(loop.written.begin(), loop.written.end(), sym) != loop.written.end();
+}
+
+bool Optimiser::isHoistable(Op op) noexcept {
+    switch(op){
+        case OP_ABS:
+        case OP_ADDITION:
+        case OP_BACKSLASH:
+        case OP_CHECK_SCALAR:
+        case OP_COSINE:
+        case OP_CROSS:
+        case OP_DAGGER:
+        case OP_DECIMAL_LITERAL:
+        case OP_DIVIDE:
+        case OP_DOT:
+        case OP_EULERS_NUMBER:
+        case OP_EXP:
+        case OP_FORWARDSLASH:
+        case OP_FRACTION:
+        case OP_GROUP_BRACKET:
+        case OP_GROUP_PAREN:
+        case OP_IMPLICIT_MULTIPLY:
+        case OP_INNER_PRODUCT:
+        case OP_INTEGER_LITERAL:
+        case OP_INVERT:
+        case OP_LINEAR_SOLVE:
+        case OP_MATRIX:
+        case OP_MATRIX_LITERAL:
+        case OP_MULTIPLICATION:
+        case OP_NATURAL_LOG:
+        case OP_NORM:
+        case OP_NORM_1:
+        case OP_NORM_INFTY:
+        case OP_NORM_SQUARED:
+        case OP_ODOT:
+        case OP_PI:
+        case OP_POWER:
+        case OP_ROOT:
+        case OP_SINE:
+        case OP_SQRT:
+        case OP_SUBTRACTION:
+        case OP_TANGENT:
+        case OP_TRANSPOSE:
+        case OP_UNARY_MINUS:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void Optimiser::eliminateDeadStores(ParseNode pn) noexcept {
+    switch(parse_tree.getOp(pn)){
+        case OP_ASSIGN:
+        case OP_EQUAL:{
+            ParseNode lhs = parse_tree.lhs(pn);
+            if(isDead(lhs) && !canonical(parse_tree.getSymbol(lhs))->is_reassigned && isPureAndTotal(parse_tree.rhs(pn))){
+                parse_tree.setOp(pn, OP_DO_NOTHING);
+                stats.dead_stores_removed++;
+            }
+            break;
+        }
+        case OP_REASSIGN:{
+            ParseNode lhs = parse_tree.lhs(pn);
+            if(isDead(lhs) && isPureAndTotal(lhs) && isPureAndTotal(parse_tree.rhs(pn))){
+                parse_tree.setOp(pn, OP_DO_NOTHING);
+                stats.dead_stores_removed++;
+            }
+            break;
+        }
+        case OP_BLOCK:
+            for(size_t i = 0; i < parse_tree.getNumArgs(pn); i++)
+                eliminateDeadStores(parse_tree.arg(pn, i));
+            break;
+        case OP_IF:
+        case OP_WHILE:
+            eliminateDeadStores(parse_tree.arg<1>(pn));
+            break;
+        case OP_IF_ELSE:
+            eliminateDeadStores(parse_tree.arg<1>(pn));
+            eliminateDeadStores(parse_tree.arg<2>(pn));
+            break;
+        case OP_FOR:
+            eliminateDeadStores(parse_tree.arg<3>(pn));
+            break;
+        case OP_RANGED_FOR:
+            eliminateDeadStores(parse_tree.arg<2>(pn));
+            break;
+        default: break;
+    }
+}
+
+bool Optimiser::isDead(ParseNode lhs) const noexcept {
+    if(parse_tree.getOp(lhs) != OP_IDENTIFIER) return false;
+    const Symbol* sym = canonical(parse_tree.getSymbol(lhs));
+
+    return !sym->is_used && !sym->is_closure_nested && !sym->is_captured_by_value
+           && !sym->tied_to_file && sym->declaration_closure_depth == 0;
+}
+
+bool Optimiser::isPureAndTotal(ParseNode pn) const noexcept {
+    if(parse_tree.getType(pn) != StaticPass::NUMERIC || !parse_tree.definitelyScalar(pn)) return false;
+
+    switch(parse_tree.getOp(pn)){
+        case OP_DECIMAL_LITERAL:
+        case OP_INTEGER_LITERAL:
+        case OP_IDENTIFIER:
+        case OP_PI:
+        case OP_EULERS_NUMBER:
+            return true;
+        case OP_ADDITION:
+        case OP_SUBTRACTION:
+        case OP_MULTIPLICATION:
+        case OP_IMPLICIT_MULTIPLY:
+        case OP_UNARY_MINUS:
+        case OP_GROUP_PAREN:
+        case OP_GROUP_BRACKET:
+            for(size_t i = 0; i < parse_tree.getNumArgs(pn); i++)
+                if(!isPureAndTotal(parse_tree.arg(pn, i))) return false;
+            return true;
+        default:
+            return false;
+    }
+}
+
+const Symbol* Optimiser::canonical(const Symbol* sym) noexcept {
+    while(sym->type == StaticPass::ALIAS) sym = sym->shadowedVar();
+    return sym;
+}
+
+}
+
+}
@@ -0,0 +1,76 @@
+#ifndef FORSCAPE_OPTIMISER_H
+#define FORSCAPE_OPTIMISER_H
+
+#include "forscape_parse_tree.h"
+#include "forscape_static_pass.h"
+
+namespace Forscape {
+
+namespace Code {
+
+struct OptimiserStats {
+    size_t constants_folded = 0;
+    size_t invariants_hoisted = 0;
+    size_t dead_stores_removed = 0;
+};
+
+/// Rewrites the resolved tree between the static pass and the linker. Constant subtrees are folded to literals,
+/// loop-invariant pure expressions are cached once per loop entry, and stores which are never read are dropped.
+class Optimiser {
+public:
+    bool enabled = true;
+    OptimiserStats stats;
+
+    Optimiser(ParseTree& parse_tree) noexcept;
+    void optimise(const InstantiationLookup& instantiations) alloc_except;
+
+private:
+    /// A loop being hoisted into, with every symbol it might write to
+    struct Loop {
+        ParseNode pn;
+        std::vector<const Symbol*> written;
+        bool has_call = false;
+        std::vector<ParseNode> invariants;
+    };
+
+    /// Outcome of scanning an expression for hoisting
+    struct Invariance {
+        bool pure;
+        size_t level; //Outermost loop the expression is invariant in, or the loop depth if it varies in all of them
+    };
+
+    //Constant folding
+    void fold(ParseNode pn) noexcept;
+    void foldTo(ParseNode pn, double val) noexcept;
+    bool isLiteral(ParseNode pn) const noexcept;
+    static bool foldConstant(Op op, double& val) noexcept;
+    static bool foldUnary(Op op, double a, double& val) noexcept;
+    static bool foldBinary(Op op, double a, double b, double& val) noexcept;
+
+    //Loop-invariant code motion
+    void hoistStmt(ParseNode pn) alloc_except;
+    void hoistLoop(ParseNode pn) alloc_except;
+    ParseNode hoistExpr(ParseNode pn) alloc_except;
+    Invariance scan(ParseNode pn) alloc_except;
+    ParseNode wrap(ParseNode pn, size_t level) alloc_except;
+    void findWrites(ParseNode pn, Loop& loop) const alloc_except;
+    void addWrite(ParseNode lvalue, Loop& loop) const alloc_except;
+    bool isWritten(const Symbol* sym, const Loop& loop) const noexcept;
+    static bool isHoistable(Op op) noexcept;
+
+    //Dead store elimination
+    void eliminateDeadStores(ParseNode pn) noexcept;
+    bool isDead(ParseNode lhs) const noexcept;
+    bool isPureAndTotal(ParseNode pn) const noexcept;
+
+    static const Symbol* canonical(const Symbol* sym) noexcept;
+
+    ParseTree& parse_tree;
+    std::vector<Loop> loops;
+};
+
+}
+
+}
+
+#endif // FORSCAPE_OPTIMISER_H
@@ -4,6 +4,7 @@
 #include "forscape_common.h"
 #include "forscape_static_pass.h"
 #include "typeset_selection.h"
+#include <algorithm>
 
 #ifndef NDEBUG
 #include <code_parsenodegraphviz.h>
@@ -17,6 +18,7 @@ namespace Code {
 
 void ParseTree::clear() noexcept {
     data.clear();
+    clearSideTables();
     nary_construction_stack.clear();
     nary_start.clear();
     cloned_vars.clear();
@@ -31,43 +33,43 @@ bool ParseTree::empty() const noexcept {
 }
 
 const Typeset::Marker& ParseTree::getLeft(ParseNode pn) const noexcept {
-    assert(isNode(pn));
-    assert(reinterpret_cast<const Typeset::Marker*>(data.data()+pn+LEFT_MARKER_OFFSET)->inValidState());
-    return *reinterpret_cast<const Typeset::Marker*>(data.data()+pn+LEFT_MARKER_OFFSET);
+    assert(getSelection(pn).left.inValidState());
+    return getSelection(pn).left;
 }
 
 void ParseTree::setLeft(ParseNode pn, const Typeset::Marker& m) noexcept {
     assert(m.inValidState());
     assert(isNode(pn));
-    *reinterpret_cast<Typeset::Marker*>(data.data()+pn+LEFT_MARKER_OFFSET) = m;
+    assert(data[pn+SELECTION_OFFSET] != EMPTY_INDEX);
+    selection_table[data[pn+SELECTION_OFFSET]].left = m;
 }
 
 const Typeset::Marker& ParseTree::getRight(ParseNode pn) const noexcept {
-    assert(isNode(pn));
-    assert(reinterpret_cast<const Typeset::Marker*>(data.data()+pn+RIGHT_MARKER_OFFSET)->inValidState());
-    return *reinterpret_cast<const Typeset::Marker*>(data.data()+pn+RIGHT_MARKER_OFFSET);
+    assert(getSelection(pn).right.inValidState());
+    return getSelection(pn).right;
 }
 
 void ParseTree::setRight(ParseNode pn, const Typeset::Marker& m) noexcept {
     assert(m.inValidState());
     assert(isNode(pn));
-    *reinterpret_cast<Typeset::Marker*>(data.data()+pn+RIGHT_MARKER_OFFSET) = m;
+    assert(data[pn+SELECTION_OFFSET] != EMPTY_INDEX);
+    selection_table[data[pn+SELECTION_OFFSET]].right = m;
 }
 
 ParseNode ParseTree::arg(ParseNode pn, size_t index) const noexcept {
     assert(index < getNumArgs(pn));
-    return data[pn+FIXED_FIELDS+index];
+    return widen(data[pn+FIXED_FIELDS+index]);
 }
 
 template<size_t index>
 ParseNode ParseTree::arg(ParseNode pn) const noexcept {
     assert(index < getNumArgs(pn));
-    return data[pn+FIXED_FIELDS+index];
+    return widen(data[pn+FIXED_FIELDS+index]);
 }
 
 void ParseTree::setArg(ParseNode pn, size_t index, ParseNode val) noexcept {
     assert(index < getNumArgs(pn));
-    data[pn+FIXED_FIELDS+index] = val;
+    data[pn+FIXED_FIELDS+index] = narrow(val);
 }
 
 void ParseTree::reduceNumArgs(ParseNode pn, size_t sze) noexcept {
@@ -77,7 +79,7 @@ void ParseTree::reduceNumArgs(ParseNode pn, size_t sze) noexcept {
 
 template<size_t index> void ParseTree::setArg(ParseNode pn, ParseNode val) noexcept {
     assert(index < getNumArgs(pn) || (getOp(pn) == OP_ERROR) && index < 2);
-    data[pn+FIXED_FIELDS+index] = val;
+    data[pn+FIXED_FIELDS+index] = narrow(val);
 }
 
 double ParseTree::getDouble(ParseNode pn) const noexcept {
@@ -214,6 +216,7 @@ ParseNode ParseTree::addError(const Typeset::Selection& sel) alloc_except {
     created.insert(pn);
     #endif
     data.resize(data.size() + FIXED_FIELDS + 2);
+    resetSideIndices(pn);
     setOp(pn, OP_ERROR);
     setSelection(pn, sel);
     setFlag(pn, pn);
@@ -235,11 +238,12 @@ template<typename T> ParseNode ParseTree::addNode(Op type, const Selection& sel,
     created.insert(pn);
     #endif
     data.resize(data.size() + FIXED_FIELDS);
+    resetSideIndices(pn);
     setOp(pn, type);
     setSelection(pn, sel);
     setNumArgs(pn, children.size());
 
-    data.insert(data.end(), children.begin(), children.end());
+    for(ParseNode child : children) data.push_back(narrow(child));
 
     return pn;
 }
@@ -290,7 +294,10 @@ ParseNode ParseTree::clone(ParseNode pn) alloc_except {
             cloned_vars.push_back(std::make_pair(pn, cloned));
     }
 
-    data.insert(data.end(), data.data()+pn, data.data()+pn+FIXED_FIELDS);
+    data.resize(data.size() + FIXED_FIELDS);
+    std::copy_n(data.data()+pn, FIXED_FIELDS, data.data()+cloned);
+    resetSideIndices(cloned);
+    copySideFields(cloned, pn);
     size_t nargs = getNumArgs(pn);
     data.resize(data.size() + nargs);
     for(size_t i = 0; i < nargs; i++){
@@ -391,10 +398,12 @@ ParseNode ParseTree::finishNary(Op type, const Selection& sel) alloc_except {
     created.insert(pn);
     #endif
     data.resize(data.size() + FIXED_FIELDS);
+    resetSideIndices(pn);
     setOp(pn, type);
     setSelection(pn, sel);
     setNumArgs(pn, N);
-    data.insert(data.end(), nary_construction_stack.end()-N, nary_construction_stack.end());
+    for(auto it = nary_construction_stack.end()-N; it != nary_construction_stack.end(); it++)
+        data.push_back(narrow(*it));
 
     nary_construction_stack.resize(nary_start.back());
     nary_start.pop_back();
@@ -438,16 +447,18 @@ void ParseTree::patchClonedTypes() noexcept {
 size_t ParseTree::append(const ParseTree& other) {
     const size_t offset = data.size();
     data.insert(data.end(), other.data.cbegin(), other.data.cend());
+    appendSideTables(other);
     const size_t copied_root = other.root + offset;
-    shift(copied_root, offset);
+    shift(copied_root, offset, other);
 
     return copied_root;
 }
 
-void ParseTree::shift(ParseNode pn, size_t offset) {
+void ParseTree::shift(ParseNode pn, size_t offset, const ParseTree& appended) {
     #ifndef NDEBUG
     created.insert(pn);
     #endif
+    shiftSideIndices(pn, appended);
 
     //EVENTUALLY: the adhoc flag wrangling comes back to haunt you
     // (although it's haunting you during adhoc tree grafting)
@@ -459,7 +470,7 @@ void ParseTree::shift(ParseNode pn, size_t offset) {
         case OP_SINGLE_CHAR_MULT_PROXY:
         case OP_IMPORT:
             setFlag(pn, getFlag(pn)+offset);
-            shift(getFlag(pn), offset);
+            shift(getFlag(pn), offset, appended);
             break;
     }
 
@@ -468,7 +479,7 @@ void ParseTree::shift(ParseNode pn, size_t offset) {
         if(old_arg == NONE) continue;
         ParseNode new_arg = old_arg + offset;
         setArg(pn, i, new_arg);
-        shift(new_arg, offset);
+        shift(new_arg, offset, appended);
     }
 }
 
@@ -508,7 +519,7 @@ bool ParseTree::inFinalState() const noexcept {
 template<typename T> bool ParseTree::notAccessingDataWhileModifying(const T& obj) const noexcept {
     if(data.empty()) return true;
 
-    const auto potential_index = reinterpret_cast<const size_t*>(&obj) - &data[0];
+    const auto potential_index = reinterpret_cast<const uint32_t*>(&obj) - &data[0];
     return potential_index < 0 || static_cast<size_t>(potential_index) >= data.size();
 }
 
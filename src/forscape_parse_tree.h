@@ -4,6 +4,7 @@
 #include <code_ast_fields.h>
 #include <code_parsenode_ops.h>
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <string>
 #include <vector>
@@ -26,6 +27,13 @@ namespace Code {
 
 struct Symbol;
 
+/// How the interpreter evaluates an element-wise assignment, chosen by the symbol linker
+enum ElementWiseStrategy : size_t {
+    EWISE_IN_PLACE, //Interpret the rhs per element, writing straight into the target
+    EWISE_COPY_TARGET, //The rhs may read the target, so it must see the previous values
+    EWISE_VECTORISED, //The rhs is scalar arithmetic of the indices, so evaluate whole columns at once
+};
+
 class ParseTree {
 public:
     FORSCAPE_AST_FIELD_CODEGEN_DECLARATIONS
@@ -116,12 +124,14 @@ public:
     void patchClonedTypes() noexcept;
 
     size_t append(const ParseTree& other);
-    void shift(ParseNode pn, size_t offset);
+    void shift(ParseNode pn, size_t offset, const ParseTree& appended);
     size_t offset() const noexcept;
     bool hasChild(ParseNode pn, ParseNode child) const noexcept;
 
 private:
-    std::vector<size_t> data;
+    //Hot fields are packed into 32-bit words, args follow the fixed fields
+    std::vector<uint32_t> data;
+    FORSCAPE_AST_FIELD_CODEGEN_SIDE_TABLES
     std::vector<ParseNode> nary_construction_stack;
     std::vector<size_t> nary_start;
 
@@ -129,8 +139,17 @@ private:
     FORSCAPE_UNORDERED_SET<ParseNode> created;
     #endif
 
-    static constexpr size_t LEFT_MARKER_OFFSET = SELECTION_OFFSET + 2;
-    static constexpr size_t RIGHT_MARKER_OFFSET = SELECTION_OFFSET;
+    static constexpr uint32_t EMPTY_INDEX = std::numeric_limits<uint32_t>::max();
+
+    //Words are sign-extended so NONE and the sentinel types near it survive the round trip
+    static size_t widen(uint32_t word) noexcept {
+        return static_cast<size_t>(static_cast<int64_t>(static_cast<int32_t>(word)));
+    }
+
+    static uint32_t narrow(size_t val) noexcept {
+        assert(widen(static_cast<uint32_t>(val)) == val);
+        return static_cast<uint32_t>(val);
+    }
 
     #ifndef NDEBUG
     void graphvizHelper(std::string& src, ParseNode n, size_t& size) const;
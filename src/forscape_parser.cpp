@@ -167,7 +167,10 @@ ParseNode Parser::whileStatement() alloc_except {
     Typeset::Marker right = rMark();
     Typeset::Selection c(left, right);
 
-    return parse_tree.addNode<2>(OP_WHILE, c, {condition, body});
+    ParseNode pn = parse_tree.addNode<2>(OP_WHILE, c, {condition, body});
+    parse_tree.setLoopInvariants(pn, NONE);
+
+    return pn;
 }
 
 ParseNode Parser::forStatement() alloc_except {
@@ -197,7 +200,10 @@ ParseNode Parser::forStatement() alloc_except {
     Typeset::Marker right = rMark();
     Typeset::Selection c(left, right);
 
-    return parse_tree.addNode<4>(OP_FOR, c, {initializer, condition, update, body});
+    ParseNode pn = parse_tree.addNode<4>(OP_FOR, c, {initializer, condition, update, body});
+    parse_tree.setLoopInvariants(pn, NONE);
+
+    return pn;
 }
 
 ParseNode Parser::rangedFor(Typeset::Marker stmt_left, Typeset::Marker paren_left, ParseNode initialiser) alloc_except {
@@ -216,7 +222,10 @@ ParseNode Parser::rangedFor(Typeset::Marker stmt_left, Typeset::Marker paren_lef
     Typeset::Marker stmt_right = rMark();
     Typeset::Selection c(stmt_left, stmt_right);
 
-    return parse_tree.addNode<3>(OP_RANGED_FOR, c, {initialiser, collection, body});
+    ParseNode pn = parse_tree.addNode<3>(OP_RANGED_FOR, c, {initialiser, collection, body});
+    parse_tree.setLoopInvariants(pn, NONE);
+
+    return pn;
 }
 
 ParseNode Parser::enumStatement() alloc_except {
@@ -0,0 +1,53 @@
+#ifndef FORSCAPE_PERFECT_HASH_H
+#define FORSCAPE_PERFECT_HASH_H
+
+#include <array>
+#include <inttypes.h>
+#include <string_view>
+#include <utility>
+
+namespace Forscape {
+
+//These must match meta/utils/perfect_hash.py, which chooses the displacements at build time
+constexpr uint32_t perfectHashBase(std::string_view key) noexcept {
+    uint32_t h = 2166136261u;
+    for(char ch : key) h = (h ^ static_cast<uint8_t>(ch)) * 16777619u;
+    return h;
+}
+
+constexpr uint32_t perfectHashRange(uint32_t h, size_t n) noexcept {
+    return static_cast<uint32_t>((static_cast<uint64_t>(h) * n) >> 32);
+}
+
+constexpr uint32_t perfectHashSlot(uint32_t h, uint16_t displacement, size_t n) noexcept {
+    uint32_t x = (h ^ displacement) * 0x9E3779B1u;
+    x ^= x >> 15;
+    return perfectHashRange(x, n);
+}
+
+/// Minimal perfect hash map over a key set fixed by codegen. A key is hashed once, the displacement
+/// of its bucket gives it a slot of its own, and a single compare confirms the hit.
+template<typename T, size_t N>
+struct PerfectHashMap {
+    typedef std::pair<std::string_view, T> Entry;
+
+    std::array<uint16_t, N> displacements;
+    std::array<Entry, N> entries;
+
+    constexpr const T* find(std::string_view key) const noexcept {
+        const uint32_t h = perfectHashBase(key);
+        const Entry& entry = entries[perfectHashSlot(h, displacements[perfectHashRange(h, N)], N)];
+        return entry.first == key ? &entry.second : nullptr;
+    }
+
+    constexpr bool contains(std::string_view key) const noexcept {
+        return find(key) != nullptr;
+    }
+
+    constexpr auto begin() const noexcept { return entries.begin(); }
+    constexpr auto end() const noexcept { return entries.end(); }
+};
+
+}
+
+#endif // FORSCAPE_PERFECT_HASH_H
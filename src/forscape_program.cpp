@@ -2,9 +2,8 @@
 
 #include "forscape_message.h"
 #include "forscape_serial.h"
+#include "forscape_document_file.h"
 #include "typeset_model.h"
-#include <fstream>
-#include <sstream>
 
 namespace Forscape {
 
@@ -42,8 +41,8 @@ Program::ptr_or_code Program::openFromAbsolutePath(const std::filesystem::path&
     auto& entry = result.first;
     if(!result.second) return reinterpret_cast<ptr_or_code>(entry->second);
 
-    std::ifstream in(path);
-    if(!in.is_open()) return FILE_NOT_FOUND;
+    DocumentFile in(path);
+    if(!in.isOpen()) return FILE_NOT_FOUND;
 
     //The path is required to be lexically normal, which is the same as canonical except
     //that symlinks are not resolved, which requires reading from disk. We only pay this
@@ -61,15 +60,9 @@ Program::ptr_or_code Program::openFromAbsolutePath(const std::filesystem::path&
         }
     }
 
-    std::stringstream buffer;
-    buffer << in.rdbuf();
+    if(!Forscape::isValidSerial(in.serial())) return FILE_CORRUPTED;
 
-    std::string src = buffer.str();
-    src.erase( std::remove(src.begin(), src.end(), '\r'), src.end() );
-
-    if(!Forscape::isValidSerial(src)) return FILE_CORRUPTED;
-
-    Typeset::Model* model = Typeset::Model::fromSerial(src);
+    Typeset::Model* model = Typeset::Model::fromSerial(in.serial());
     all_files.push_back(model);
     model->path = canonical_path;
     entry->second = model;
@@ -190,6 +183,11 @@ void Program::removeFile(Typeset::Model* model) noexcept {
     all_files.erase(std::remove(all_files.begin(), all_files.end(), model), all_files.end());
 }
 
+void Program::search(const std::string& str, std::vector<Typeset::Selection>& hits, bool use_case, bool word) const {
+    //Each file checks its trigram index first, so files without the string are skipped without a scan
+    for(Typeset::Model* model : all_files) model->search(str, hits, use_case, word);
+}
+
 Program::ptr_or_code Program::openFromRelativePathSpecifiedExtension(std::filesystem::path rel_path){
     for(const std::filesystem::path& path_entry : project_path){
         std::filesystem::path abs_path = (path_entry / rel_path).lexically_normal();
@@ -213,14 +211,21 @@ Program::ptr_or_code Program::openFromRelativePathAutoExtension(std::filesystem:
     return FILE_NOT_FOUND;
 }
 
+void Program::optimise(){
+    //The editor reads parse_tree for hover and navigation, so the optimiser only rewrites the copy which is run
+    executable_tree = parse_tree;
+    optimiser.optimise(static_pass.instantiation_lookup);
+}
+
 std::string Program::run(){
     assert(error_stream.noErrors());
 
+    optimise();
     interpreter.run(
-        parse_tree,
+        executable_tree,
         static_pass.instantiation_lookup,
-        static_pass.number_switch,
-        static_pass.string_switch);
+        static_pass.switch_tables,
+        static_pass.strings);
 
     std::string str;
 
@@ -235,7 +240,8 @@ std::string Program::run(){
                 //EVENTUALLY: maybe do something here?
                 delete msg;
                 break;
-            case Forscape::InterpreterOutput::AddDiscreteSeries:{
+            case Forscape::InterpreterOutput::AddDiscreteSeries:
+            case Forscape::InterpreterOutput::AppendDiscreteSeries:{
                 delete msg;
                 break;
             }
@@ -243,7 +249,7 @@ std::string Program::run(){
         }
 
     if(interpreter.error_code != Code::ErrorCode::NO_ERROR_FOUND){
-        const Typeset::Selection& sel = parse_tree.getSelection(interpreter.error_node);
+        const Typeset::Selection& sel = executable_tree.getSelection(interpreter.error_node);
         const std::string msg(getMessage(interpreter.error_code));
 
         str += "\nLine " + sel.getStartLineAsString() + " - " + msg;
@@ -255,11 +261,12 @@ std::string Program::run(){
 
 void Program::runThread(){
     assert(error_stream.noErrors());
+    optimise();
     interpreter.runThread(
-        parse_tree,
+        executable_tree,
         static_pass.instantiation_lookup,
-        static_pass.number_switch,
-        static_pass.string_switch);
+        static_pass.switch_tables,
+        static_pass.strings);
 }
 
 void Program::stop(){
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "forscape_interpreter.h"
+#include "forscape_optimiser.h"
 
 namespace Forscape {
 
@@ -32,14 +33,17 @@ public:
     void getFileSuggestions(std::vector<std::string>& suggestions, Typeset::Model* active) const;
     void getFileSuggestions(std::vector<std::string>& suggestions, std::string_view input, Typeset::Model* active) const;
     void removeFile(Typeset::Model* model) noexcept;
+    void search(const std::string& str, std::vector<Typeset::Selection>& hits, bool use_case, bool word) const;
     std::string run();
     void runThread();
     void stop();
 
     Code::Settings settings;
     Code::ErrorStream error_stream;
-    Code::ParseTree parse_tree;
+    Code::ParseTree parse_tree; //Resolved by the static pass on each edit
+    Code::ParseTree executable_tree; //Copy of the parse_tree which is optimised for each run
     Code::StaticPass static_pass = Code::StaticPass(parse_tree, error_stream);
+    Code::Optimiser optimiser = Code::Optimiser(executable_tree);
     Code::Interpreter interpreter;
 
     FORSCAPE_UNORDERED_MAP<std::filesystem::path, Typeset::Model*> source_files; //May contain multiple entries per model
@@ -52,6 +56,7 @@ private:
     Program() = default;
     ptr_or_code openFromRelativePathSpecifiedExtension(std::filesystem::path file_name);
     ptr_or_code openFromRelativePathAutoExtension(std::filesystem::path file_name);
+    void optimise();
 
     std::vector<Typeset::Model*> all_files;
     std::vector<Typeset::Model*> pending_project_browser_updates;
@@ -92,19 +92,17 @@ void Scanner::scanNumber() alloc_except {
     createToken(INTEGER);
 }
 
-FORSCAPE_STATIC_MAP<std::string_view, ForscapeTokenType> Scanner::keywords {
-    FORSCAPE_KEYWORD_MAP
-};
+const PerfectHashMap<ForscapeTokenType, FORSCAPE_KEYWORD_MAP_SIZE> Scanner::keywords FORSCAPE_KEYWORD_MAP;
 
 void Scanner::scanIdentifier() alloc_except {
     controller->selectToIdentifierEnd();
 
-    auto lookup = keywords.find(controller->selectedFlatText());
-    if(lookup == keywords.end()){
+    const ForscapeTokenType* lookup = keywords.find(controller->selectedFlatText());
+    if(lookup == nullptr){
         controller->formatBasicIdentifier();
         createToken(IDENTIFIER);
     }else{
-        ForscapeTokenType type = lookup->second;
+        ForscapeTokenType type = *lookup;
         controller->formatKeyword();
         createToken(type);
 
@@ -21,7 +21,7 @@ public:
     void scanToken() alloc_except;
 
     std::vector<Token> tokens;
-    static FORSCAPE_STATIC_MAP<std::string_view, ForscapeTokenType> keywords; //EVENTUALLY: look at keyword perfect hashing
+    static const PerfectHashMap<ForscapeTokenType, FORSCAPE_KEYWORD_MAP_SIZE> keywords;
 
 private:
     void scanString() alloc_except;
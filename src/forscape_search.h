@@ -0,0 +1,145 @@
+#ifndef FORSCAPE_SEARCH_H
+#define FORSCAPE_SEARCH_H
+
+#include "forscape_serial.h"
+#include <vector>
+
+namespace Forscape {
+
+/// Case-insensitive search folds ASCII letters only. Or-ing 0x20 maps exactly the upper and lower case
+/// forms of a letter onto the lower case form, so a folded byte compare never misses a letter.
+inline bool isAsciiLetter(char ch) noexcept {
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+inline char foldCase(char ch) noexcept {
+    return isAsciiLetter(ch) ? (ch | 0x20) : ch;
+}
+
+/// Returns the first index in [index, stop] where the first and last bytes of target line up with str,
+/// or stop+1 if there is none. Candidates still need a full compare, but most positions are rejected
+/// a vector at a time.
+inline size_t findSearchCandidate(std::string_view str, size_t index, size_t stop, std::string_view target, bool use_case) noexcept {
+    assert(!target.empty());
+    assert(stop + target.size() <= str.size());
+    const char* const data = str.data();
+    const size_t last_offset = target.size()-1;
+    const bool fold_first = !use_case && isAsciiLetter(target.front());
+    const bool fold_last = !use_case && isAsciiLetter(target.back());
+    const char first = fold_first ? foldCase(target.front()) : target.front();
+    const char last = fold_last ? foldCase(target.back()) : target.back();
+
+    #if defined(__AVX2__)
+    const __m256i first_32 = _mm256_set1_epi8(first);
+    const __m256i last_32 = _mm256_set1_epi8(last);
+    const __m256i fold_first_32 = _mm256_set1_epi8(fold_first ? 0x20 : 0);
+    const __m256i fold_last_32 = _mm256_set1_epi8(fold_last ? 0x20 : 0);
+    for(; index + 32 <= stop + 1; index += 32){
+        const __m256i front = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));
+        const __m256i back = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index + last_offset));
+        const __m256i hits = _mm256_and_si256(
+            _mm256_cmpeq_epi8(_mm256_or_si256(front, fold_first_32), first_32),
+            _mm256_cmpeq_epi8(_mm256_or_si256(back, fold_last_32), last_32));
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(hits));
+        if(mask) return index + countTrailingZeros(mask);
+    }
+    #endif
+
+    #if defined(__SSE2__) || defined(_M_X64)
+    const __m128i first_16 = _mm_set1_epi8(first);
+    const __m128i last_16 = _mm_set1_epi8(last);
+    const __m128i fold_first_16 = _mm_set1_epi8(fold_first ? 0x20 : 0);
+    const __m128i fold_last_16 = _mm_set1_epi8(fold_last ? 0x20 : 0);
+    for(; index + 16 <= stop + 1; index += 16){
+        const __m128i front = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+        const __m128i back = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index + last_offset));
+        const __m128i hits = _mm_and_si128(
+            _mm_cmpeq_epi8(_mm_or_si128(front, fold_first_16), first_16),
+            _mm_cmpeq_epi8(_mm_or_si128(back, fold_last_16), last_16));
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hits));
+        if(mask) return index + countTrailingZeros(mask);
+    }
+    #endif
+
+    for(; index <= stop; index++){
+        const char front = fold_first ? (data[index] | 0x20) : data[index];
+        const char back = fold_last ? (data[index + last_offset] | 0x20) : data[index + last_offset];
+        if(front == first && back == last) return index;
+    }
+
+    return stop+1;
+}
+
+/// Whether target occurs anywhere in str, regardless of word boundaries.
+inline bool containsMatch(std::string_view str, std::string_view target, bool use_case) noexcept {
+    if(target.size() > str.size()) return false;
+    const size_t stop = str.size() - target.size();
+    for(size_t index = 0; (index = findSearchCandidate(str, index, stop, target, use_case)) <= stop; index++){
+        size_t i = 0;
+        while(i < target.size() && (use_case ? str[index+i] == target[i] : foldCase(str[index+i]) == foldCase(target[i]))) i++;
+        if(i == target.size()) return true;
+    }
+    return false;
+}
+
+/// Set of the case-folded byte trigrams appearing in a document, hashed into a bitset sized to the document.
+/// A query missing any of its trigrams cannot occur in the document, so the document is skipped without a scan.
+/// False positives only cost a search. The bitset is empty until the index is first built.
+class TrigramIndex {
+public:
+    void build(std::string_view str) alloc_except {
+        //About eight bits per trigram keeps false positives rare
+        size_t num_bits = MIN_BITS;
+        shift = 32 - MIN_LOG2_BITS;
+        while(num_bits < 8*str.size() && num_bits < MAX_BITS){
+            num_bits *= 2;
+            shift--;
+        }
+        bits.assign(num_bits / 64, 0);
+
+        if(str.size() < 3) return;
+        uint32_t trigram = (static_cast<uint8_t>(foldCase(str[0])) << 8) | static_cast<uint8_t>(foldCase(str[1]));
+        for(size_t i = 2; i < str.size(); i++){
+            trigram = ((trigram << 8) | static_cast<uint8_t>(foldCase(str[i]))) & 0xFFFFFF;
+            const uint32_t h = hash(trigram);
+            bits[h / 64] |= uint64_t(1) << (h % 64);
+        }
+    }
+
+    void clear() noexcept {
+        bits.clear();
+        bits.shrink_to_fit();
+    }
+
+    bool mayContain(std::string_view target) const noexcept {
+        assert(!bits.empty());
+        if(target.size() < 3) return true;
+        uint32_t trigram = (static_cast<uint8_t>(foldCase(target[0])) << 8) | static_cast<uint8_t>(foldCase(target[1]));
+        for(size_t i = 2; i < target.size(); i++){
+            trigram = ((trigram << 8) | static_cast<uint8_t>(foldCase(target[i]))) & 0xFFFFFF;
+            const uint32_t h = hash(trigram);
+            if(!(bits[h / 64] & (uint64_t(1) << (h % 64)))) return false;
+        }
+        return true;
+    }
+
+    size_t numBits() const noexcept {
+        return 64*bits.size();
+    }
+
+private:
+    static constexpr size_t MIN_LOG2_BITS = 9;
+    static constexpr size_t MIN_BITS = 1 << MIN_LOG2_BITS;
+    static constexpr size_t MAX_BITS = 1 << 20;
+
+    uint32_t hash(uint32_t trigram) const noexcept {
+        return (trigram * 0x9E3779B1u) >> shift;
+    }
+
+    std::vector<uint64_t> bits;
+    uint32_t shift = 32 - MIN_LOG2_BITS;
+};
+
+}
+
+#endif // FORSCAPE_SEARCH_H
@@ -7,9 +7,54 @@
 #include <inttypes.h>
 #include <limits>
 #include <string>
+#include <string_view>
 
 namespace Forscape {
 
+/// Returns the index of the next byte which may start a construct code, open or close marker or newline,
+/// or src.size() if there is none. Plain text is skipped a vector at a time.
+inline size_t findSerialControl(std::string_view src, size_t index) noexcept {
+    const char* const data = src.data();
+    const size_t size = src.size();
+
+    #if defined(__AVX2__)
+    const __m256i con_32 = _mm256_set1_epi8(CON_0);
+    const __m256i open_32 = _mm256_set1_epi8(OPEN_0);
+    const __m256i close_32 = _mm256_set1_epi8(CLOSE_0);
+    const __m256i newline_32 = _mm256_set1_epi8('\n');
+    for(; index + 32 <= size; index += 32){
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));
+        const __m256i hits = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, con_32), _mm256_cmpeq_epi8(chunk, open_32)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, close_32), _mm256_cmpeq_epi8(chunk, newline_32)));
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(hits));
+        if(mask) return index + countTrailingZeros(mask);
+    }
+    #endif
+
+    #if defined(__SSE2__) || defined(_M_X64)
+    const __m128i con_16 = _mm_set1_epi8(CON_0);
+    const __m128i open_16 = _mm_set1_epi8(OPEN_0);
+    const __m128i close_16 = _mm_set1_epi8(CLOSE_0);
+    const __m128i newline_16 = _mm_set1_epi8('\n');
+    for(; index + 16 <= size; index += 16){
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+        const __m128i hits = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, con_16), _mm_cmpeq_epi8(chunk, open_16)),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, close_16), _mm_cmpeq_epi8(chunk, newline_16)));
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hits));
+        if(mask) return index + countTrailingZeros(mask);
+    }
+    #endif
+
+    for(; index < size; index++){
+        const char ch = data[index];
+        if(ch == CON_0 || ch == OPEN_0 || ch == CLOSE_0 || ch == '\n') return index;
+    }
+
+    return size;
+}
+
 #define PARSE_DIM(name, terminator) \
     uint16_t name;\
     {\
@@ -23,12 +68,12 @@ namespace Forscape {
         }\
     }
 
-inline bool isValidSerial(const std::string& src) noexcept {
+inline bool isValidSerial(std::string_view src) noexcept {
     assert(!isIllFormedUtf8(src));
 
     uint32_t depth = 0;
     size_t index = 0;
-    while(index < src.size()){
+    while((index = findSerialControl(src, index)) < src.size()){
         if(isUnicodeChar<CONSTRUCT_STRVIEW>(&src[index])){
             index += codepointSize(CON_0);
             if(index >= src.size()) return false;
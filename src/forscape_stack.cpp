@@ -27,6 +27,13 @@ void Stack::push(const Value& value   DEBUG_STACK_NAME){
     #endif
 }
 
+void Stack::push(Value&& value   DEBUG_STACK_NAME){
+    std::vector<Value>::push_back(std::move(value));
+    #ifndef NDEBUG
+    stack_names.push_back( name );
+    #endif
+}
+
 void Stack::pop() noexcept {
     std::vector<Value>::pop_back();
     #ifndef NDEBUG
@@ -21,6 +21,7 @@ public:
     size_t size() const noexcept;
     void clear() noexcept;
     void push(const Value& value  DEBUG_STACK_NAME); //EVENTUALLY: running out of memory in the user program is a real possibility
+    void push(Value&& value  DEBUG_STACK_NAME);
     void pop() noexcept;
     Value& read(size_t offset  DEBUG_STACK_NAME) noexcept;
     Value& readReturn() noexcept;
@@ -5,6 +5,7 @@
 #include "forscape_program.h"
 #include "forscape_symbol_table.h"
 #include "typeset_model.h"
+#include <cmath>
 
 namespace Forscape {
 
@@ -61,8 +62,8 @@ void StaticPass::reset() noexcept {
     called_func_map.clear();
     instantiation_lookup.clear();
     all_calls.clear();
-    number_switch.clear();
-    string_switch.clear();
+    switch_tables.clear();
+    strings = std::make_shared<StringTable>();
     imported_models.clear();
     assert(return_types.empty());
     assert(retry_at_recursion == false);
@@ -597,7 +598,6 @@ ParseNode StaticPass::resolveExpr(size_t pn, size_t rows_expected, size_t cols_e
                 encountered_autosize = true;
                 return pn;
             }else{
-                //EVENTUALLY: writing dynamic data in the parse tree vector is UB
                 const Value& v = parse_tree.getValue(child);
                 if(v.index() != Unitialized_index && std::get<double>(v) >= entries)
                     return error(pn, child, INDEX_OUT_OF_RANGE);
@@ -816,7 +816,8 @@ ParseNode StaticPass::resolveExpr(size_t pn, size_t rows_expected, size_t cols_e
                 return pn;
             }else{
                 parse_tree.setArg<0>(pn, child);
-                if(parse_tree.getType(child) != NUMERIC) return error(pn, child);
+                Type type = parse_tree.getType(child);
+                if(type != NUMERIC && type != STRING) return error(pn, child);
                 return pn;
             }
         }
@@ -1056,6 +1057,7 @@ ParseNode StaticPass::resolveExpr(size_t pn, size_t rows_expected, size_t cols_e
             return pn;
         case OP_STRING:
             parse_tree.setType(pn, STRING);
+            parse_tree.setValue(pn, internLiteral(pn));
             return pn;
         case OP_LINEAR_SOLVE:
             parse_tree.setArg<0>(pn, resolveExpr(parse_tree.lhs(pn)));
@@ -1337,15 +1339,8 @@ ParseNode StaticPass::resolveSwitch(ParseNode pn) {
     ParseNode switch_key = resolveExprTop(parse_tree.arg<0>(pn));
     parse_tree.setArg<0>(pn, switch_key);
 
-    switch (parse_tree.getType(switch_key)) {
-        case NUMERIC: return resolveSwitchNumeric(pn, switch_key);
-        case STRING: return resolveSwitchString(pn, switch_key); //EVENTUALLY: generalise to templated function
-        default: return error(pn, switch_key, UNSUPPORTED_SWITCH_TYPE);
-    }
-}
-
-ParseNode StaticPass::resolveSwitchNumeric(ParseNode pn, ParseNode switch_key) {
-    parse_tree.setFlag(pn, NONE);
+    Type key_type = parse_tree.getType(switch_key);
+    if(key_type != NUMERIC && key_type != STRING) return error(pn, switch_key, UNSUPPORTED_SWITCH_TYPE);
 
     //Resolve codepaths, supporting fallthrough
     ParseNode last_codepath = NONE;
@@ -1358,6 +1353,9 @@ ParseNode StaticPass::resolveSwitchNumeric(ParseNode pn, ParseNode switch_key) {
     }
 
     //Resolve keys
+    std::vector<std::pair<double, ParseNode>> cases;
+    ParseNode default_codepath = NONE;
+    bool has_default = false;
     for(size_t i = 1; i < parse_tree.getNumArgs(pn); i++){
         ParseNode case_node = parse_tree.arg(pn, i);
 
@@ -1366,66 +1364,57 @@ ParseNode StaticPass::resolveSwitchNumeric(ParseNode pn, ParseNode switch_key) {
         if(parse_tree.getOp(case_node) == OP_CASE){
             ParseNode case_key = resolveExpr(parse_tree.lhs(case_node));
             auto type = parse_tree.getType(case_key);
-            if(type != NUMERIC) return error(pn, case_key, TYPE_ERROR);
-            double val = parse_tree.getDouble(case_key);
-            auto result = number_switch.insert({{pn, val}, codepath});
-            if(!result.second) return error(pn, case_key, REDUNDANT_CASE);
+            if(type != key_type) return error(pn, case_key, TYPE_ERROR);
+            const Value& key = parse_tree.getValue(case_key);
+            if(key.index() != (key_type == NUMERIC ? double_index : string_index)) return error(pn, case_key, TYPE_ERROR);
+            double val = key_type == NUMERIC ? std::get<double>(key) : std::get<String>(key).getAtom();
+            for(const auto& entry : cases)
+                if(entry.first == val) return error(pn, case_key, REDUNDANT_CASE);
+            cases.push_back({val, codepath});
         }else{
             assert(parse_tree.getOp(case_node) == OP_DEFAULT);
-            if(parse_tree.getFlag(pn) != NONE){
+            if(has_default){
                 return error(pn, parse_tree.lhs(case_node), REDUNDANT_CASE);
             }
-            parse_tree.setFlag(pn, case_node);
+            has_default = true;
+            default_codepath = codepath;
         }
     }
 
-    parse_tree.setOp(pn, OP_SWITCH_NUMERIC);
+    parse_tree.setFlag(pn, switch_tables.size());
+    switch_tables.emplace_back(cases, default_codepath);
+
+    parse_tree.setOp(pn, key_type == NUMERIC ? OP_SWITCH_NUMERIC : OP_SWITCH_STRING);
 
     return pn;
 }
 
-ParseNode StaticPass::resolveSwitchString(ParseNode pn, ParseNode switch_key){
-    parse_tree.setFlag(pn, NONE);
-
-    //Resolve codepaths, supporting fallthrough
-    ParseNode last_codepath = NONE;
-    for(size_t i = parse_tree.getNumArgs(pn); i-->1;){
-        ParseNode case_node = parse_tree.arg(pn, i);
-        ParseNode case_codepath = parse_tree.rhs(case_node);
-        if(case_codepath != NONE)
-            last_codepath = resolveStmt(case_codepath);
-        parse_tree.setArg<1>(case_node, last_codepath);
-    }
-
-    //Resolve keys
-    for(size_t i = 1; i < parse_tree.getNumArgs(pn); i++){
-        ParseNode case_node = parse_tree.arg(pn, i);
-
-        ParseNode codepath = parse_tree.rhs(case_node);
-
-        if(parse_tree.getOp(case_node) == OP_CASE){
-            ParseNode case_key = resolveExpr(parse_tree.lhs(case_node));
-            auto type = parse_tree.getType(case_key);
-            if(type != STRING) return error(pn, case_key, TYPE_ERROR);
-            //EVENTUALLY: this should use actual string values
-            Typeset::Selection sel = parse_tree.getSelection(case_key);
-            sel.left.index++;
-            sel.right.index--;
-            std::string val = sel.str();
-            auto result = string_switch.insert({{pn, val}, codepath});
-            if(!result.second) return error(pn, case_key, REDUNDANT_CASE);
-        }else{
-            assert(parse_tree.getOp(case_node) == OP_DEFAULT);
-            if(parse_tree.getFlag(pn) != NONE){
-                return error(pn, parse_tree.lhs(case_node), REDUNDANT_CASE);
-            }
-            parse_tree.setFlag(pn, case_node);
-        }
+String StaticPass::internLiteral(ParseNode pn) alloc_except {
+    Typeset::Selection sel = parse_tree.getSelection(pn);
+    sel.left.index++;
+    sel.right.index--;
+    return sel.isTextSelection() ? strings->intern(sel.strView()) : strings->intern(sel.str());
+}
+
+SwitchTable::SwitchTable(std::vector<std::pair<double, ParseNode>>& cases, ParseNode default_codepath) alloc_except
+    : default_codepath(default_codepath) {
+    cases.erase(std::remove_if(cases.begin(), cases.end(), [](const auto& entry){ return std::isnan(entry.first); }), cases.end());
+    if(cases.empty()) return;
+    std::sort(cases.begin(), cases.end());
+
+    //Small integer keys, such as string atoms or the states of a state machine, index a table directly
+    const double lo = cases.front().first;
+    const double hi = cases.back().first;
+    const bool integral = std::all_of(cases.begin(), cases.end(), [](const auto& entry){
+        return entry.first == std::trunc(entry.first);
+    });
+    if(integral && lo >= -MAX_DENSE_KEY && hi <= MAX_DENSE_KEY && hi - lo < 2*cases.size() + 8){
+        base = lo;
+        codepaths.resize(static_cast<size_t>(hi - lo) + 1, default_codepath);
+        for(const auto& entry : cases) codepaths[static_cast<size_t>(entry.first - lo)] = entry.second;
+    }else{
+        sorted_cases = std::move(cases);
     }
-
-    parse_tree.setOp(pn, OP_SWITCH_STRING);
-
-    return pn;
 }
 
 ParseNode StaticPass::resolveDeriv(ParseNode pn){
@@ -5,6 +5,7 @@
 #include <code_error_types.h>
 #include <forscape_common.h>
 #include <forscape_dynamic_settings.h>
+#include <forscape_value.h>
 #include <limits>
 #include <set>
 #include <stack>
@@ -26,9 +27,30 @@ struct PairHash{
 };
 typedef FORSCAPE_UNORDERED_MAP<std::pair<ParseNode, ParseNode>, ParseNode, PairHash> InstantiationLookup;
 
-//EVENTUALLY: should generalise these to any supported Value type
-typedef FORSCAPE_UNORDERED_MAP<std::pair<ParseNode, double>, ParseNode> NumericSwitchMap;
-typedef FORSCAPE_UNORDERED_MAP<std::pair<ParseNode, std::string>, ParseNode> StringSwitchMap;
+/// Jump table of a switch statement, found by the flag of the switch node. String keys switch on their atoms.
+struct SwitchTable {
+    static constexpr double MAX_DENSE_KEY = 1u << 31;
+
+    ParseNode default_codepath = NONE;
+    double base = 0;
+    std::vector<ParseNode> codepaths; //Dense over [base, base + size), with the default codepath in the gaps
+    std::vector<std::pair<double, ParseNode>> sorted_cases; //Searched when the keys are sparse or fractional
+
+    SwitchTable(std::vector<std::pair<double, ParseNode>>& cases, ParseNode default_codepath) alloc_except;
+
+    ParseNode find(double key) const noexcept {
+        const double offset = key - base;
+        if(offset >= 0 && offset < codepaths.size()){
+            const size_t index = static_cast<size_t>(offset);
+            return index == offset ? codepaths[index] : default_codepath;
+        }
+
+        auto lookup = std::lower_bound(sorted_cases.begin(), sorted_cases.end(), key,
+            [](const std::pair<double, ParseNode>& entry, double key){ return entry.first < key; });
+        return lookup != sorted_cases.end() && lookup->first == key ? lookup->second : default_codepath;
+    }
+};
+typedef std::vector<SwitchTable> SwitchTables;
 
 class ErrorStream;
 class ParseTree;
@@ -40,8 +62,8 @@ class StaticPass : private std::vector<size_t>{
 
 public:
     InstantiationLookup instantiation_lookup;
-    NumericSwitchMap number_switch;
-    StringSwitchMap string_switch;
+    SwitchTables switch_tables;
+    std::shared_ptr<StringTable> strings; //Replaced by each pass, so a running script keeps the table it started with
     typedef std::vector<size_t> DeclareSignature;
     typedef std::vector<size_t> CallSignature;
     static constexpr Type UNINITIALISED = std::numeric_limits<size_t>::max();
@@ -149,8 +171,7 @@ private:
         ParseNode getFuncFromDeclSig(const DeclareSignature& sig) const noexcept;
         ParseNode resolveAlg(ParseNode pn);
         ParseNode resolveSwitch(ParseNode pn);
-        ParseNode resolveSwitchNumeric(ParseNode pn, ParseNode switch_key);
-        ParseNode resolveSwitchString(ParseNode pn, ParseNode switch_key);
+        String internLiteral(ParseNode pn) alloc_except;
         ParseNode resolveDeriv(ParseNode pn);
         ParseNode resolveIdentity(ParseNode pn);
         ParseNode resolveInverse(ParseNode pn);
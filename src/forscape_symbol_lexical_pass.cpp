@@ -17,37 +17,10 @@ namespace Forscape {
 
 namespace Code {
 
-FORSCAPE_STATIC_MAP<std::string_view, Op> SymbolLexicalPass::predef {
-    {"π", OP_PI},
-    {"e", OP_EULERS_NUMBER},
-    {"φ", OP_GOLDEN_RATIO},
-    {"c", OP_SPEED_OF_LIGHT},
-    {"ℎ", OP_PLANCK_CONSTANT},
-    {"ℏ", OP_REDUCED_PLANCK_CONSTANT},
-    {"σ", OP_STEFAN_BOLTZMANN_CONSTANT},
-    {"I", OP_IDENTITY_AUTOSIZE},
-    //{"i", OP_IMAGINARY}, //EVENTUALLY - support complex numbers
-    {"g", OP_GRAVITY},
-    {"Γ", OP_GAMMA_FUNCTION},
-
-    //EVENTUALLY: how do units work? conversions?
-    //{"m", OP_METERS},
-    //{"s", OP_SECONDS},
-    //{"kg", OP_KILOGRAMS},
-    //{"N", OP_NEWTONS},
-    //{"Pa", OP_PASCALS},
-    //{"Hz", OP_HERTZ},
-    //{"l", OP_LITERS},
-    //{"rad", OP_RADIANS},
-    //{"deg", OP_DEGREES},
-
-    //{"ft", OP_FEET},
-    //{"in", OP_INCHES},
-    //{"lb", OP_POUND_MASS},
-    //{"lbf", OP_POUND_FORCE},
-
-    {"T", OP_MAYBE_TRANSPOSE},
-};
+//Predefined identifiers are listed in meta/predefined.csv
+//EVENTUALLY: support complex numbers with an imaginary unit "i"
+//EVENTUALLY: how do units work? conversions?
+const PerfectHashMap<Op, FORSCAPE_PREDEFINED_MAP_SIZE> SymbolLexicalPass::predef FORSCAPE_PREDEFINED_MAP;
 
 SymbolLexicalPass::SymbolLexicalPass(ParseTree& parse_tree, Typeset::Model* model) noexcept
     : error_stream(Program::instance()->error_stream),
@@ -341,9 +314,9 @@ void SymbolLexicalPass::resolveReference(ParseNode pn) alloc_except {
 
     auto lookup = lexical_map.find(c);
     if(lookup == lexical_map.end()){
-        auto lookup = predef.find(c.isTextSelection() ? c.strView() : c.str());
-        if(lookup != predef.end()){
-            Op read_type = lookup->second;
+        const Op* lookup = predef.find(c.isTextSelection() ? c.strView() : c.str());
+        if(lookup != nullptr){
+            Op read_type = *lookup;
             parse_tree.setOp(pn, read_type);
             c.format(SEM_PREDEF);
             return;
@@ -387,8 +360,7 @@ void SymbolLexicalPass::resolveIdMult(ParseNode pn, Typeset::Marker left, Typese
                 return;
             }
 
-            auto predef_lookup = predef.find(sel.strView());
-            if(predef_lookup == predef.end()){
+            if(!predef.contains(sel.strView())){
                 error(pn, BAD_READ);
                 parse_tree.setOp(pn, OP_ERROR);
                 return;
@@ -432,7 +404,7 @@ void SymbolLexicalPass::resolveIdMult(ParseNode pn, Typeset::Marker left, Typese
         if(lookup != lexical_map.end()){
             resolveReference(pn, lookup->second);
         }else{
-            parse_tree.setOp(pn, predef.find(sel.strView())->second);
+            parse_tree.setOp(pn, *predef.find(sel.strView()));
             sel.format(SEM_PREDEF);
         }
         parse_tree.addNaryChild(pn);
@@ -451,7 +423,7 @@ void SymbolLexicalPass::resolveScriptMult(ParseNode pn, Typeset::Marker left, Ty
     Typeset::Marker end(m.text, m.text->numChars());
     Typeset::Marker new_right = end;
     end.decrementGrapheme();
-    if(left == end || predef.find(Typeset::Selection(end, new_right).strView()) != predef.end()){
+    if(left == end || predef.contains(Typeset::Selection(end, new_right).strView())){
         error(pn, BAD_READ);
         parse_tree.setOp(pn, OP_ERROR);
         return;
@@ -463,8 +435,7 @@ void SymbolLexicalPass::resolveScriptMult(ParseNode pn, Typeset::Marker left, Ty
         Typeset::Selection sel(left, m);
         auto lookup = lexical_map.find(sel);
         if(lookup == lexical_map.end()){
-            auto predef_lookup = predef.find(sel.strView());
-            if(predef_lookup == predef.end()){
+            if(!predef.contains(sel.strView())){
                 error(pn, BAD_READ);
                 parse_tree.setOp(pn, OP_ERROR);
                 return;
@@ -503,7 +474,7 @@ void SymbolLexicalPass::resolveScriptMult(ParseNode pn, Typeset::Marker left, Ty
         if(lookup != lexical_map.end()){
             resolveReference(pn, lookup->second);
         }else{
-            parse_tree.setOp(pn, predef.find(sel.strView())->second);
+            parse_tree.setOp(pn, *predef.find(sel.strView()));
             sel.format(SEM_PREDEF);
         }
         parse_tree.addNaryChild(pn);
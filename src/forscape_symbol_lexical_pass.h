@@ -1,6 +1,7 @@
 #ifndef FORSCAPE_SYMBOL_LEXICAL_PASS_H
 #define FORSCAPE_SYMBOL_LEXICAL_PASS_H
 
+#include "code_predefined.h"
 #include "forscape_common.h"
 #include "forscape_error.h"
 #include "forscape_parse_tree.h"
@@ -23,7 +24,7 @@ public:
     SymbolLexicalPass(ParseTree& parse_tree, Typeset::Model* model) noexcept;
     void resolveSymbols() alloc_except;
     SymbolTable symbol_table;
-    static FORSCAPE_STATIC_MAP<std::string_view, Op> predef;
+    static const PerfectHashMap<Op, FORSCAPE_PREDEFINED_MAP_SIZE> predef;
 
 private:
     std::vector<Symbol>& symbols;
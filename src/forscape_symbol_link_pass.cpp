@@ -51,6 +51,7 @@ void SymbolTableLinker::resolveStmt(ParseNode pn) noexcept {
         case OP_SWITCH_NUMERIC:
         case OP_SWITCH_STRING:
             resolveSwitch(pn); break;
+        case OP_WHILE: resolveIf(pn); break;
         default: assert(false);
     }
 }
@@ -115,6 +116,16 @@ void SymbolTableLinker::resolveEWiseAssignment(ParseNode pn) noexcept {
     ParseNode lhs = parse_tree.lhs(pn);
     ParseNode rhs = parse_tree.rhs(pn);
     ParseNode id = parse_tree.arg<0>(lhs);
+
+    //The interpreter writes the target in place unless the rhs might observe it mid-assignment
+    const Symbol* target = parse_tree.getSymbol(id);
+    while(target->type == StaticPass::ALIAS) target = target->shadowedVar();
+    const bool target_is_shared = target->is_closure_nested || target->declaration_closure_depth == 0;
+    parse_tree.setEwiseStrategy(pn,
+        mayRead(rhs, target, target_is_shared) ? EWISE_COPY_TARGET :
+        isScalarArithmetic(rhs) ? EWISE_VECTORISED :
+        EWISE_IN_PLACE);
+
     resolveReference(id);
 
     increaseLexicalDepth();
@@ -133,6 +144,68 @@ void SymbolTableLinker::resolveEWiseAssignment(ParseNode pn) noexcept {
     decreaseLexicalDepth();
 }
 
+bool SymbolTableLinker::mayRead(ParseNode pn, const Symbol* target, bool target_is_shared) const noexcept {
+    switch(parse_tree.getOp(pn)){
+        case OP_IDENTIFIER:{
+            const Symbol* sym = parse_tree.getSymbol(pn);
+            while(sym->type == StaticPass::ALIAS) sym = sym->shadowedVar();
+            return sym == target;
+        }
+        case OP_LAMBDA:
+            //Captures may copy the target while it is partly assigned
+            return true;
+        case OP_CALL:
+            //Globals and upvalues are visible to the callee
+            if(target_is_shared) return true;
+            break;
+        default: break;
+    }
+
+    for(size_t i = 0; i < parse_tree.getNumArgs(pn); i++){
+        ParseNode arg = parse_tree.arg(pn, i);
+        if(arg != NONE && mayRead(arg, target, target_is_shared)) return true;
+    }
+
+    return false;
+}
+
+bool SymbolTableLinker::isScalarArithmetic(ParseNode pn) const noexcept {
+    if(parse_tree.getType(pn) != StaticPass::NUMERIC) return false;
+
+    switch(parse_tree.getOp(pn)){
+        case OP_IDENTIFIER:
+        case OP_INTEGER_LITERAL:
+        case OP_DECIMAL_LITERAL:
+        case OP_PI:
+        case OP_EULERS_NUMBER:
+            return true;
+        case OP_ADDITION:
+        case OP_SUBTRACTION:
+        case OP_MULTIPLICATION:
+        case OP_IMPLICIT_MULTIPLY:
+        case OP_DIVIDE:
+        case OP_FRACTION:
+        case OP_FORWARDSLASH:
+        case OP_POWER:
+        case OP_UNARY_MINUS:
+        case OP_GROUP_PAREN:
+        case OP_GROUP_BRACKET:
+        case OP_CHECK_SCALAR:
+        case OP_SQRT:
+        case OP_ABS:
+        case OP_SINE:
+        case OP_COSINE:
+        case OP_TANGENT:
+        case OP_EXP:
+        case OP_NATURAL_LOG:
+            for(size_t i = 0; i < parse_tree.getNumArgs(pn); i++)
+                if(!isScalarArithmetic(parse_tree.arg(pn, i))) return false;
+            return true;
+        default:
+            return false;
+    }
+}
+
 void SymbolTableLinker::resolveFor(ParseNode pn) noexcept {
     assert(parse_tree.getOp(pn) == OP_FOR);
     ParseNode initialiser = parse_tree.arg<0>(pn);
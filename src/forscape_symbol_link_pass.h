@@ -45,6 +45,8 @@ private:
     //Helper
     void resolveDeclaration(ParseNode pn) noexcept;
     void resolveReference(ParseNode pn) noexcept;
+    bool mayRead(ParseNode pn, const Symbol* target, bool target_is_shared) const noexcept;
+    bool isScalarArithmetic(ParseNode pn) const noexcept;
     void resolveAllChildrenAsExpressions(ParseNode pn) noexcept;
     void increaseLexicalDepth() noexcept;
     void decreaseLexicalDepth() noexcept;
@@ -128,9 +128,24 @@ size_t SymbolTable::containingScope(const Typeset::Marker& m) const noexcept {
     return lookup - scope_segments.begin() - (lookup != scope_segments.begin());
 }
 
-void SymbolTable::getSuggestions(const Typeset::Marker& loc, std::vector<std::string>& suggestions) const {
-    FORSCAPE_UNORDERED_SET<std::string> suggestion_set;
+template<typename Map>
+static std::vector<std::string_view> sortedKeys(const Map& map) {
+    std::vector<std::string_view> keys;
+    for(const auto& entry : map) keys.push_back(entry.first);
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+static bool hasPrefix(std::string_view str, std::string_view prefix) noexcept {
+    return str.size() >= prefix.size() && str.substr(0, prefix.size()) == prefix;
+}
+
+static void addPrefixMatches(const std::vector<std::string_view>& sorted, std::string_view prefix, std::vector<std::string>& suggestions) {
+    for(auto it = std::lower_bound(sorted.begin(), sorted.end(), prefix); it != sorted.end() && hasPrefix(*it, prefix); it++)
+        suggestions.push_back(std::string(*it));
+}
 
+void SymbolTable::getSuggestions(const Typeset::Marker& loc, std::vector<std::string>& suggestions) const {
     Typeset::Marker left = loc;
     while(left.atTextStart()){
         if(left.atFirstTextInPhrase()) return;
@@ -139,47 +154,82 @@ void SymbolTable::getSuggestions(const Typeset::Marker& loc, std::vector<std::st
     }
     left.decrementToPrevWord();
     Typeset::Selection typed(left, loc);
-
-    //Add matching words in scope
-    for(size_t i = containingScope(loc); i != NONE; i = scope_segments[i].parent_lexical_segment_index){
-        for(size_t j = i; j != NONE; j = scope_segments[j].prev_lexical_segment_index){
-            const ScopeSegment& seg = scope_segments[j];
-            const size_t end = (&seg == &scope_segments.back()) ? symbols.size() : scope_segments[j+1].first_sym_index;
-            for(size_t k = seg.first_sym_index; k < end; k++){
-                const Typeset::Selection& candidate = symbols[k].sel();
-                if(candidate.startsWith(typed) && candidate.right.precedesInclusive(loc) && candidate.right != loc)
-                    suggestion_set.insert(candidate.str());
-
-                //EVENTUALLY: filter suggestions based on type so suggestions are always context appropriate
-                //            don't use a trie or more specialised data structure unless necessary
-            }
+    const std::string prefix = typed.str();
+    if(suggestion_index_stale) buildSuggestionIndex();
+
+    //Add matching words in scope, ranked from the innermost scope outwards
+    const ScopeSegmentIndex scope = containingScope(loc);
+    std::vector<const SuggestionEntry*> matches;
+    auto lookup = std::lower_bound(suggestion_index.begin(), suggestion_index.end(), std::string_view(prefix),
+        [this](const SuggestionEntry& entry, std::string_view prefix){ return name(entry) < prefix; });
+    for(; lookup != suggestion_index.end() && hasPrefix(name(*lookup), prefix); lookup++){
+        if(scope < lookup->scope_begin || scope >= lookup->scope_end) continue;
+        //A symbol's selection is its last usage, which may come after the cursor, so test the declaration
+        const Typeset::Selection& declaration = symbols[lookup->symbol_index].firstOccurence();
+        if(!declaration.right.precedesInclusive(loc) || name(*lookup) == prefix) continue;
+        if(!matches.empty() && name(*matches.back()) == name(*lookup)){
+            if(lookup->depth > matches.back()->depth) matches.back() = &*lookup;
+        }else{
+            matches.push_back(&*lookup);
         }
+
+        //EVENTUALLY: filter suggestions based on type so suggestions are always context appropriate
     }
+    std::stable_sort(matches.begin(), matches.end(),
+        [](const SuggestionEntry* a, const SuggestionEntry* b){ return a->depth > b->depth; });
+    for(const SuggestionEntry* match : matches) suggestions.push_back(std::string(name(*match)));
+
+    if(!typed.isTextSelection()) return;
+
+    //Add predefined variables, then matching keywords
+    static const std::vector<std::string_view> predefined = sortedKeys(SymbolLexicalPass::predef);
+    static const std::vector<std::string_view> keywords = sortedKeys(Scanner::keywords);
+    const size_t num_symbols = suggestions.size();
+    for(auto it = std::lower_bound(predefined.begin(), predefined.end(), std::string_view(prefix));
+        it != predefined.end() && hasPrefix(*it, prefix); it++)
+        if(std::find(suggestions.begin(), suggestions.begin() + num_symbols, *it) == suggestions.begin() + num_symbols)
+            suggestions.push_back(std::string(*it));
+    addPrefixMatches(keywords, prefix, suggestions);
+}
 
-    //Add predefined variables
-    if(typed.isTextSelection()){
-        const std::string_view typed_view = typed.strView();
-        for(const auto& entry : SymbolLexicalPass::predef){
-            const auto& keyword = entry.first;
-            if(keyword.size() >= typed_view.size() && std::string_view(keyword.data(), typed_view.size()) == typed_view)
-                suggestion_set.insert(std::string(keyword));
+void SymbolTable::buildSuggestionIndex() const alloc_except {
+    suggestion_index_stale = false;
+    suggestion_index.clear();
+    suggestion_names.clear();
+    if(scope_segments.empty()) return;
+
+    //A scope is continued by a new segment after each nested scope closes, and its descendants'
+    //segments all come before the segment continuing its parent
+    std::vector<ScopeSegmentIndex> owner(scope_segments.size());
+    std::vector<ScopeSegmentIndex> scope_end(scope_segments.size(), scope_segments.size());
+    std::vector<size_t> depth(scope_segments.size(), 0);
+    for(ScopeSegmentIndex i = 0; i < scope_segments.size(); i++){
+        const ScopeSegment& seg = scope_segments[i];
+        if(seg.isStartOfScope()){
+            owner[i] = i;
+            if(seg.parent_lexical_segment_index != NONE)
+                depth[i] = depth[owner[seg.parent_lexical_segment_index]] + 1;
+        }else{
+            owner[i] = owner[seg.prev_lexical_segment_index];
+            scope_end[owner[i-1]] = i;
         }
     }
 
-    suggestions.insert(suggestions.end(), suggestion_set.cbegin(), suggestion_set.cend());
-    std::sort(suggestions.begin(), suggestions.end());
-
-    //Add matching keywords
-    if(typed.isTextSelection()){
-        const size_t sorted_size_prior = suggestions.size();
-        const std::string_view typed_view = typed.strView();
-        for(const auto& entry : Scanner::keywords){
-            const auto& keyword = entry.first;
-            if(keyword.size() >= typed_view.size() && std::string_view(keyword.data(), typed_view.size()) == typed_view)
-                suggestions.push_back(std::string(keyword));
+    suggestion_index.reserve(symbols.size());
+    for(ScopeSegmentIndex i = 0; i < scope_segments.size(); i++){
+        const SymbolIndex end = (i+1 == scope_segments.size()) ? symbols.size() : scope_segments[i+1].first_sym_index;
+        const ScopeSegmentIndex scope = owner[i];
+        for(SymbolIndex k = scope_segments[i].first_sym_index; k < end; k++){
+            const Typeset::Selection& sel = symbols[k].sel();
+            const size_t name_start = suggestion_names.size();
+            if(sel.isTextSelection()) suggestion_names += sel.strView();
+            else suggestion_names += sel.str();
+            suggestion_index.push_back(SuggestionEntry{name_start, suggestion_names.size() - name_start, k, scope, scope_end[scope], depth[scope]});
         }
-        std::sort(suggestions.begin()+sorted_size_prior, suggestions.end());
     }
+
+    std::sort(suggestion_index.begin(), suggestion_index.end(),
+        [this](const SuggestionEntry& a, const SuggestionEntry& b){ return name(a) < name(b); });
 }
 
 const Typeset::Selection& SymbolTable::getSel(size_t sym_index) const noexcept {
@@ -192,6 +242,7 @@ void SymbolTable::reset(const Typeset::Marker& doc_start) noexcept {
     #endif
 
     scope_segments.clear();
+    suggestion_index_stale = true;
     symbols.clear();
     symbol_usages.clear();
     scoped_vars.clear();
@@ -141,6 +141,7 @@ public:
     size_t containingScope(const Typeset::Marker& m) const noexcept;
     void getSuggestions(const Typeset::Marker& loc, std::vector<std::string>& suggestions) const;
     const Typeset::Selection& getSel(size_t sym_index) const noexcept;
+    void buildSuggestionIndex() const alloc_except;
 
     void reset(const Typeset::Marker& doc_start) noexcept;
     void addScope(
@@ -169,6 +170,23 @@ public:
     };
     FORSCAPE_UNORDERED_MAP<ScopedVarKey, SymbolIndex, HashScopedVarKey> scoped_vars;
 
+    /// A symbol name sorted for prefix lookup. Scope segments are numbered in document order,
+    /// so the symbol is in scope at segments [scope_begin, scope_end).
+    struct SuggestionEntry {
+        size_t name_start;
+        size_t name_size;
+        SymbolIndex symbol_index;
+        ScopeSegmentIndex scope_begin;
+        ScopeSegmentIndex scope_end;
+        size_t depth;
+    };
+    mutable std::vector<SuggestionEntry> suggestion_index;
+    mutable std::string suggestion_names;
+    mutable bool suggestion_index_stale = true; //Set by every resolve, and the index is rebuilt by the next completion
+    std::string_view name(const SuggestionEntry& entry) const noexcept {
+        return std::string_view(suggestion_names.data() + entry.name_start, entry.name_size);
+    }
+
     void resolveReference(ParseNode pn, size_t sym_id, size_t closure_depth) alloc_except;
 };
 
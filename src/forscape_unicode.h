@@ -4,12 +4,66 @@
 #include <cassert>
 #include <inttypes.h>
 #include <string>
+#include <string_view>
 #include <unicode_zerowidth.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 #define SCANNER_NUMBER_END_CONSTRUCT 3
 
 namespace Forscape {
 
+inline uint32_t countTrailingZeros(uint32_t mask) noexcept {
+    assert(mask != 0);
+    #ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+    #else
+    return __builtin_ctz(mask);
+    #endif
+}
+
+inline uint32_t countBits(uint32_t mask) noexcept {
+    #ifdef _MSC_VER
+    return __popcnt(mask);
+    #else
+    return __builtin_popcount(mask);
+    #endif
+}
+
+/// Returns the index of the first byte at or after index which is not ASCII, or size if there is none.
+/// Plain text is skipped a vector at a time.
+inline size_t asciiPrefixEnd(const char* data, size_t index, size_t size) noexcept {
+    #if defined(__AVX2__)
+    for(; index + 32 <= size; index += 32){
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));
+        const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(chunk));
+        if(mask) return index + countTrailingZeros(mask);
+    }
+    #endif
+
+    #if defined(__SSE2__) || defined(_M_X64)
+    for(; index + 16 <= size; index += 16){
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(chunk));
+        if(mask) return index + countTrailingZeros(mask);
+    }
+    #endif
+
+    while(index < size && (static_cast<uint8_t>(data[index]) >> 7) == 0) index++;
+
+    return index;
+}
+
 inline constexpr size_t codepointSize(uint8_t ch) noexcept {
     if(ch >> 7 == 0) return 1;
     assert((ch & (1 << 6)) != 0);
@@ -76,7 +130,7 @@ static constexpr uint32_t expand(char ch) noexcept {
 }
 
 template<typename StringType>
-inline uint32_t codepointInt(StringType str, size_t index = 0) noexcept {
+inline uint32_t codepointInt(const StringType& str, size_t index = 0) noexcept {
     assert(index < str.size());
 
     uint8_t ch = str[index];
@@ -196,7 +250,7 @@ inline constexpr uint32_t firstBits(uint8_t ch) noexcept {
 //Found perfect hash of unicode numbers, but using full uint32_t bytes was better
 /*
 template<typename StringType>
-inline uint32_t codepoint(StringType str, size_t index) noexcept {
+inline uint32_t codepoint(const StringType& str, size_t index) noexcept {
     assert(index < str.size());
 
     uint32_t first = static_cast<uint8_t>(str[index]);
@@ -219,24 +273,39 @@ inline uint32_t codepoint(StringType str, size_t index) noexcept {
 */
 
 template<typename StringType>
-inline size_t countGraphemes(StringType str) noexcept {
+inline size_t countGraphemes(const StringType& str) noexcept {
+    //Every byte which does not continue a codepoint starts one. Zero-width codepoints all lie at
+    //U+0300 or above, so only lead bytes from 0xCC up need the table lookup.
     size_t num_graphemes = 0;
     size_t index = 0;
-    while(index < str.size()){
-        if(isAscii(str[index])){
-            index++;
-            num_graphemes++;
-        }else{
-            num_graphemes += !isZeroWidth(codepointInt(str, index));
-            index += codepointSize(str[index]);
+
+    #if defined(__SSE2__) || defined(_M_X64)
+    const __m128i continuation_end = _mm_set1_epi8(static_cast<char>(0xC0));
+    const __m128i zero_width_lead = _mm_set1_epi8(static_cast<char>(0xCC - 1));
+    const __m128i zero = _mm_setzero_si128();
+    for(; index + 16 <= str.size(); index += 16){
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + index));
+        const uint32_t continuation = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(chunk, continuation_end)));
+        num_graphemes += 16 - countBits(continuation);
+        uint32_t candidates = static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpgt_epi8(chunk, zero_width_lead), _mm_cmplt_epi8(chunk, zero))));
+        while(candidates){
+            num_graphemes -= isZeroWidth(codepointInt(str, index + countTrailingZeros(candidates)));
+            candidates &= candidates - 1;
         }
     }
+    #endif
+
+    for(; index < str.size(); index++){
+        if(isContinuationCharacter(str[index])) continue;
+        num_graphemes += isAscii(str[index]) || !isZeroWidth(codepointInt(str, index));
+    }
 
     return num_graphemes;
 }
 
 template<typename StringType>
-inline size_t charIndexOfGrapheme(StringType str, size_t grapheme_index, size_t index = 0) noexcept {
+inline size_t charIndexOfGrapheme(const StringType& str, size_t grapheme_index, size_t index = 0) noexcept {
     size_t num_graphemes = 0;
     while(index < str.size() && num_graphemes < grapheme_index){
         if(isAscii(str[index])){
@@ -253,7 +322,7 @@ inline size_t charIndexOfGrapheme(StringType str, size_t grapheme_index, size_t
 
 //Note: This should only be actively checked where external inputs are supplied.
 //      Internally, strings are known to be valid UTF-8, which may be verified by assertions.
-inline bool isIllFormedUtf8(const std::string& str) noexcept {
+inline bool isIllFormedUtf8(std::string_view str) noexcept {
     size_t index = 0;
     while(index < str.size()){
         const char ch = str[index++];
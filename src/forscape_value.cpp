@@ -6,6 +6,29 @@ namespace Forscape {
 
 namespace Code {
 
+String String::operator+(const String& other) const alloc_except {
+    std::string str;
+    str.reserve(text->size() + other.text->size());
+    str += *text;
+    str += *other.text;
+    return String(std::make_shared<const std::string>(std::move(str)));
+}
+
+String StringTable::intern(std::string_view str) alloc_except {
+    auto lookup = atoms.find(str);
+    if(lookup != atoms.end()) return String(strings[lookup->second], lookup->second);
+
+    const uint32_t atom = static_cast<uint32_t>(strings.size());
+    strings.push_back(std::make_shared<const std::string>(str));
+    atoms.emplace(*strings.back(), atom);
+    return String(strings.back(), atom);
+}
+
+uint32_t StringTable::find(std::string_view str) const noexcept {
+    auto lookup = atoms.find(str);
+    return lookup == atoms.end() ? String::NO_ATOM : lookup->second;
+}
+
 ParseNode Lambda::valCap(const ParseTree& parse_tree) const noexcept {
     return parse_tree.valCapList(def);
 }
@@ -3,7 +3,11 @@
 
 #include <forscape_common.h>
 #include "forscape_error.h"
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 #ifdef USE_CONAN_EIGEN
@@ -45,11 +49,91 @@ struct Algorithm{
         : def(def){}
 };
 
+/// Matrix data shared between Values. Copying a Value only bumps a reference count,
+/// and the data is duplicated on the first write through a handle which does not own it alone.
+class SharedMatrix {
+public:
+    SharedMatrix(Eigen::MatrixXd&& mat)
+        : data(std::make_shared<Eigen::MatrixXd>(std::move(mat))) {}
+
+    template<typename Derived>
+    SharedMatrix(const Eigen::EigenBase<Derived>& expr)
+        : data(std::make_shared<Eigen::MatrixXd>(expr.derived())) {}
+
+    const Eigen::MatrixXd& read() const noexcept {
+        return *data;
+    }
+
+    Eigen::MatrixXd& write() {
+        if(!unique()) data = std::make_shared<Eigen::MatrixXd>(*data);
+        return *data;
+    }
+
+    /// Shares the coefficients read-only. Later writes through this matrix will copy while the share is held.
+    std::shared_ptr<const double> share() const noexcept {
+        return std::shared_ptr<const double>(data, data->data());
+    }
+
+    /// Moves the data out if this is the only owner, leaving an empty matrix behind
+    Eigen::MatrixXd take() {
+        if(!unique()) return *data;
+        else return std::move(*data);
+    }
+
+private:
+    /// Shares are only made on the interpreter thread, so a count of one cannot rise while the data is written.
+    /// use_count() is a relaxed load, while plots on the GUI thread drop their shares with a release decrement.
+    /// The acquire fence orders the last reads of those plots before any write through this matrix.
+    bool unique() const noexcept {
+        if(data.use_count() > 1) return false;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+
+    std::shared_ptr<Eigen::MatrixXd> data;
+};
+
+/// A string value. Literals are interned by the static pass, so equal literals share their text and an atom
+/// which string switches dispatch on. Strings built at runtime own their text, and are freed with their last value.
+class String {
+public:
+    static constexpr uint32_t NO_ATOM = std::numeric_limits<uint32_t>::max();
+
+    String(std::shared_ptr<const std::string> text, uint32_t atom = NO_ATOM) noexcept
+        : text(std::move(text)), atom(atom) {}
+
+    std::string_view str() const noexcept { return *text; }
+    uint32_t getAtom() const noexcept { return atom; }
+
+    bool operator==(const String& other) const noexcept {
+        if(atom != NO_ATOM && other.atom != NO_ATOM) return atom == other.atom;
+        return text == other.text || *text == *other.text;
+    }
+    bool operator!=(const String& other) const noexcept { return !(*this == other); }
+    String operator+(const String& other) const alloc_except;
+
+private:
+    std::shared_ptr<const std::string> text;
+    uint32_t atom;
+};
+
+/// Interns the string literals of a program. Each static pass builds a new table, which runs share
+/// read-only, so a run never copies the table and never adds to it.
+class StringTable {
+public:
+    String intern(std::string_view str) alloc_except;
+    uint32_t find(std::string_view str) const noexcept;
+
+private:
+    std::vector<std::shared_ptr<const std::string>> strings;
+    FORSCAPE_UNORDERED_MAP<std::string_view, uint32_t> atoms; //Keys view the text held by strings
+};
+
 typedef std::variant<
     Code::Error*,
     double,
-    Eigen::MatrixXd,
-    std::string, //This is the biggest member
+    SharedMatrix,
+    String,
     bool,
     Lambda,
     Algorithm,
@@ -0,0 +1,193 @@
+#include "forscape_parse_tree.h"
+
+#include "typeset_selection.h"
+#include <cstring>
+
+namespace Forscape {
+
+namespace Code {
+
+static const Typeset::Selection empty_selection = Typeset::Selection();
+
+static const Value empty_value = Value();
+
+size_t ParseTree::getOp(ParseNode pn) const noexcept {
+    assert(isNode(pn));
+    return widen(data[pn+OP_OFFSET]);
+}
+
+void ParseTree::setOp(ParseNode pn, size_t op) noexcept {
+    assert(isNode(pn));
+    data[pn+OP_OFFSET] = narrow(op);
+}
+
+size_t ParseTree::getFlag(ParseNode pn) const noexcept {
+    assert(isNode(pn));
+    size_t flag;
+    std::memcpy(&flag, data.data()+pn+FLAG_OFFSET, sizeof(flag));
+    return flag;
+}
+
+void ParseTree::setFlag(ParseNode pn, size_t flag) noexcept {
+    assert(isNode(pn));
+    std::memcpy(data.data()+pn+FLAG_OFFSET, &flag, sizeof(flag));
+}
+
+size_t ParseTree::getType(ParseNode pn) const noexcept {
+    assert(isNode(pn));
+    return widen(data[pn+TYPE_OFFSET]);
+}
+
+void ParseTree::setType(ParseNode pn, size_t type) noexcept {
+    assert(isNode(pn));
+    data[pn+TYPE_OFFSET] = narrow(type);
+}
+
+size_t ParseTree::getRows(ParseNode pn) const noexcept {
+    assert(isNode(pn));
+    return widen(data[pn+ROWS_OFFSET]);
+}
+
+void ParseTree::setRows(ParseNode pn, size_t rows) noexcept {
+    assert(isNode(pn));
+    data[pn+ROWS_OFFSET] = narrow(rows);
+}
+
+size_t ParseTree::getCols(ParseNode pn) const noexcept {
+    assert(isNode(pn));
+    return widen(data[pn+COLS_OFFSET]);
+}
+
+void ParseTree::setCols(ParseNode pn, size_t cols) noexcept {
+    assert(isNode(pn));
+    data[pn+COLS_OFFSET] = narrow(cols);
+}
+
+const Typeset::Selection& ParseTree::getSelection(ParseNode pn) const noexcept {
+    assert(isNode(pn));
+    const uint32_t index = data[pn+SELECTION_OFFSET];
+    const Typeset::Selection& selection = (index == EMPTY_INDEX) ? empty_selection : selection_table[index];
+    assert(selection.inValidState());
+    return selection;
+}
+
+void ParseTree::setSelection(ParseNode pn, const Typeset::Selection& selection) alloc_except {
+    assert(selection.inValidState(false));
+    assert(isNode(pn));
+    uint32_t& index = data[pn+SELECTION_OFFSET];
+    if(index == EMPTY_INDEX){
+        index = narrow(selection_table.size());
+        selection_table.push_back(selection);
+    }else{
+        selection_table[index] = selection;
+    }
+}
+
+const Value& ParseTree::getValue(ParseNode pn) const noexcept {
+    assert(isNode(pn));
+    const uint32_t index = data[pn+VALUE_OFFSET];
+    const Value& value = (index == EMPTY_INDEX) ? empty_value : value_table[index];
+    return value;
+}
+
+void ParseTree::setValue(ParseNode pn, const Value& value) alloc_except {
+    assert(isNode(pn));
+    uint32_t& index = data[pn+VALUE_OFFSET];
+    if(index == EMPTY_INDEX){
+        index = narrow(value_table.size());
+        value_table.push_back(value);
+    }else{
+        value_table[index] = value;
+    }
+}
+
+size_t ParseTree::getNumArgs(ParseNode pn) const noexcept {
+    assert(isNode(pn));
+    return widen(data[pn+NUM_ARGS_OFFSET]);
+}
+
+void ParseTree::setNumArgs(ParseNode pn, size_t num_args) noexcept {
+    assert(isNode(pn));
+    data[pn+NUM_ARGS_OFFSET] = narrow(num_args);
+}
+
+size_t ParseTree::getStackOffset(ParseNode pn) const noexcept {
+    assert(getOp(pn) == OP_IDENTIFIER);
+    return getFlag(pn);
+}
+
+void ParseTree::setStackOffset(ParseNode pn, size_t value) noexcept {
+    assert(getOp(pn) == OP_IDENTIFIER);
+    setFlag(pn, value);
+}
+
+size_t ParseTree::getGlobalIndex(ParseNode pn) const noexcept {
+    assert(getOp(pn) == OP_READ_GLOBAL);
+    return getFlag(pn);
+}
+
+void ParseTree::setGlobalIndex(ParseNode pn, size_t value) noexcept {
+    assert(getOp(pn) == OP_READ_GLOBAL);
+    setFlag(pn, value);
+}
+
+size_t ParseTree::getClosureIndex(ParseNode pn) const noexcept {
+    assert(getOp(pn) == OP_READ_UPVALUE);
+    return getFlag(pn);
+}
+
+void ParseTree::setClosureIndex(ParseNode pn, size_t value) noexcept {
+    assert(getOp(pn) == OP_READ_UPVALUE);
+    setFlag(pn, value);
+}
+
+size_t ParseTree::getLoopInvariants(ParseNode pn) const noexcept {
+    assert(getOp(pn) == OP_WHILE || getOp(pn) == OP_FOR || getOp(pn) == OP_RANGED_FOR);
+    return getFlag(pn);
+}
+
+void ParseTree::setLoopInvariants(ParseNode pn, size_t value) noexcept {
+    assert(getOp(pn) == OP_WHILE || getOp(pn) == OP_FOR || getOp(pn) == OP_RANGED_FOR);
+    setFlag(pn, value);
+}
+
+size_t ParseTree::getEwiseStrategy(ParseNode pn) const noexcept {
+    assert(getOp(pn) == OP_ELEMENTWISE_ASSIGNMENT);
+    return getFlag(pn);
+}
+
+void ParseTree::setEwiseStrategy(ParseNode pn, size_t value) noexcept {
+    assert(getOp(pn) == OP_ELEMENTWISE_ASSIGNMENT);
+    setFlag(pn, value);
+}
+
+void ParseTree::clearSideTables() noexcept {
+    selection_table.clear();
+    value_table.clear();
+}
+
+void ParseTree::resetSideIndices(ParseNode pn) noexcept {
+    data[pn+SELECTION_OFFSET] = EMPTY_INDEX;
+    data[pn+VALUE_OFFSET] = EMPTY_INDEX;
+}
+
+void ParseTree::copySideFields(ParseNode dest, ParseNode src) alloc_except {
+    if(data[src+SELECTION_OFFSET] != EMPTY_INDEX) setSelection(dest, selection_table[data[src+SELECTION_OFFSET]]);
+    if(data[src+VALUE_OFFSET] != EMPTY_INDEX) setValue(dest, value_table[data[src+VALUE_OFFSET]]);
+}
+
+void ParseTree::appendSideTables(const ParseTree& other) alloc_except {
+    selection_table.insert(selection_table.end(), other.selection_table.cbegin(), other.selection_table.cend());
+    value_table.insert(value_table.end(), other.value_table.cbegin(), other.value_table.cend());
+}
+
+void ParseTree::shiftSideIndices(ParseNode pn, const ParseTree& appended) noexcept {
+    if(data[pn+SELECTION_OFFSET] != EMPTY_INDEX)
+        data[pn+SELECTION_OFFSET] += narrow(selection_table.size() - appended.selection_table.size());
+    if(data[pn+VALUE_OFFSET] != EMPTY_INDEX)
+        data[pn+VALUE_OFFSET] += narrow(value_table.size() - appended.value_table.size());
+}
+
+}
+
+}
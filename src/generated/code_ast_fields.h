@@ -0,0 +1,63 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_CODE_AST_FIELDS_H
+#define FORSCAPE_CODE_AST_FIELDS_H
+
+#include <forscape_value.h>
+#include <typeset_selection.h>
+
+namespace Forscape {
+
+namespace Code {
+
+#define FORSCAPE_AST_FIELD_CODEGEN_DECLARATIONS \
+    static constexpr size_t OP_OFFSET = 0; \
+    size_t getOp(ParseNode pn) const noexcept; \
+    void setOp(ParseNode pn, size_t op) noexcept;  \
+    static constexpr size_t FLAG_OFFSET = OP_OFFSET + 1; \
+    size_t getFlag(ParseNode pn) const noexcept; \
+    void setFlag(ParseNode pn, size_t flag) noexcept;  \
+    static constexpr size_t TYPE_OFFSET = FLAG_OFFSET + 2; \
+    size_t getType(ParseNode pn) const noexcept; \
+    void setType(ParseNode pn, size_t type) noexcept;  \
+    static constexpr size_t ROWS_OFFSET = TYPE_OFFSET + 1; \
+    size_t getRows(ParseNode pn) const noexcept; \
+    void setRows(ParseNode pn, size_t rows) noexcept;  \
+    static constexpr size_t COLS_OFFSET = ROWS_OFFSET + 1; \
+    size_t getCols(ParseNode pn) const noexcept; \
+    void setCols(ParseNode pn, size_t cols) noexcept;  \
+    static constexpr size_t SELECTION_OFFSET = COLS_OFFSET + 1; \
+    const Typeset::Selection& getSelection(ParseNode pn) const noexcept; \
+    void setSelection(ParseNode pn, const Typeset::Selection& selection) alloc_except;  \
+    static constexpr size_t VALUE_OFFSET = SELECTION_OFFSET + 1; \
+    const Value& getValue(ParseNode pn) const noexcept; \
+    void setValue(ParseNode pn, const Value& value) alloc_except;  \
+    static constexpr size_t NUM_ARGS_OFFSET = VALUE_OFFSET + 1; \
+    size_t getNumArgs(ParseNode pn) const noexcept; \
+    void setNumArgs(ParseNode pn, size_t num_args) noexcept;  \
+    size_t getStackOffset(ParseNode pn) const noexcept; \
+    void setStackOffset(ParseNode pn, size_t value) noexcept;  \
+    size_t getGlobalIndex(ParseNode pn) const noexcept; \
+    void setGlobalIndex(ParseNode pn, size_t value) noexcept;  \
+    size_t getClosureIndex(ParseNode pn) const noexcept; \
+    void setClosureIndex(ParseNode pn, size_t value) noexcept;  \
+    size_t getLoopInvariants(ParseNode pn) const noexcept; \
+    void setLoopInvariants(ParseNode pn, size_t value) noexcept;  \
+    size_t getEwiseStrategy(ParseNode pn) const noexcept; \
+    void setEwiseStrategy(ParseNode pn, size_t value) noexcept;  \
+    static constexpr size_t FIXED_FIELDS = NUM_ARGS_OFFSET + 1;
+
+#define FORSCAPE_AST_FIELD_CODEGEN_SIDE_TABLES \
+    std::vector<Typeset::Selection> selection_table; \
+    std::vector<Value> value_table; \
+    void clearSideTables() noexcept; \
+    void resetSideIndices(ParseNode pn) noexcept; \
+    void copySideFields(ParseNode dest, ParseNode src) alloc_except; \
+    void appendSideTables(const ParseTree& other) alloc_except; \
+    void shiftSideIndices(ParseNode pn, const ParseTree& appended) noexcept;
+
+} // namespace Code
+
+} // namespace Forscape
+
+#endif // FORSCAPE_CODE_AST_FIELDS_H
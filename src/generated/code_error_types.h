@@ -0,0 +1,215 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_CODE_ERROR_TYPES_H
+#define FORSCAPE_CODE_ERROR_TYPES_H
+
+#include <cassert>
+#include <string>
+
+namespace Forscape {
+
+namespace Code {
+
+enum ErrorCode{
+    NO_ERROR_FOUND,
+    USER_STOP,
+    EXPECTED_PRIMARY,
+    UNTERMINATED_STRING,
+    ASSIGN_EXPRESSION,
+    TRAILING_CONSTANT,
+    TRAILING_DOT,
+    LEADING_ZEROES,
+    BAD_READ_OR_SUBSCRIPT,
+    UNRECOGNIZED_STMT,
+    UNRECOGNIZED_EXPR,
+    TYPE_NOT_ADDABLE,
+    SUBTRACT_NON_SCALAR,
+    SUBTRACT_NON_MATRIX,
+    DIMENSION_MISMATCH,
+    SUBTRACT_NON_NUMERIC,
+    NON_NUMERIC_TYPE,
+    NON_SCALAR_TYPE,
+    STRING_CONVERSION,
+    IMAGINARY_RESULT,
+    EIGEN_UNSUPPORTED,
+    TYPE_ERROR,
+    DIV_BY_ZERO,
+    UNUSED_VAR,
+    INFINITE_LOOP,
+    NONTERMINATING_SLICE,
+    INVALID_PARAMETER,
+    NOT_CALLABLE,
+    INVALID_ARGS,
+    NO_RETURN,
+    UNUSED_EXPRESSION,
+    EXPECT_DEFAULT_ARG,
+    BAD_BREAK,
+    BAD_CONTINUE,
+    AMBIGIOUS_TRIG_POWER,
+    LOG_ARG,
+    LOG_BASE,
+    EMPTY_BIG_SYMBOL,
+    BIG_SYMBOL_ARG,
+    BIG_SYMBOL_RANGE,
+    EMPTY_CASES,
+    OVERLAPPING_CASES,
+    SCALAR_MATRIX,
+    UNUSED_ELEM_AGN_INDEX,
+    INTERRUPT,
+    EXPECT_LPAREN,
+    EXPECT_RPAREN,
+    EXPECT_RBRACE,
+    EXPECT_LBRACKET,
+    EXPECT_DOUBLEBAR,
+    EXPECT_RANGLE,
+    RECURSIVE_TYPE,
+    CALL_BEFORE_DEFINE,
+    TOO_MANY_ARGS,
+    TOO_FEW_ARGS,
+    SHADOWING_VAR,
+    EXPECT_BOOLEAN,
+    EXPECT_SCALAR,
+    AUTOSIZE,
+    RETURN_OUTSIDE_FUNCTION,
+    EXPECT_POSITIVE_INT,
+    EXPECT_NATURAL_NUMBER,
+    CALC_OVERFLOW,
+    BINOM_K_EXCEED_N,
+    LIMIT_NOT_SUPPORTED,
+    BAD_RANGED_FOR_VAR,
+    TYPE_NOT_ITERABLE,
+    COMPLEMENT_C,
+    TRANSPOSE_T,
+    EXPECTED_FILEPATH,
+    FILE_CORRUPTED,
+    SELF_IMPORT,
+    NOT_IMPLEMENTED,
+    ERROR_IN_LOADED_FILE,
+    NOT_A_SCOPE,
+    EXPECT_GROUPING_CLOSE,
+    EXPECT_CASE,
+    UNSUPPORTED_SWITCH_TYPE,
+    VALUE_NOT_DETERMINED,
+    REDUNDANT_CASE,
+    UNRECOGNIZED_SYMBOL,
+    CONSUME,
+    REASSIGN_CONSTANT,
+    REDEFINE_PARAMETER,
+    MUTABLE_CONST_ASSIGN,
+    BAD_READ,
+    INDEX_OUT_OF_RANGE,
+    NON_LVALUE,
+    USE_BEFORE_DEFINE,
+    ASSERT_FAIL,
+    BAD_DEFAULT_ARG,
+    FILE_NOT_FOUND,
+    MODULE_FIELD_NOT_FOUND,
+};
+
+inline std::string_view getMessage(ErrorCode code){
+    switch(code){
+        case NO_ERROR_FOUND: return "";
+        case USER_STOP: return "Script terminated by user";
+        case EXPECTED_PRIMARY: return "Expected value";
+        case UNTERMINATED_STRING: return "Unterminated string";
+        case ASSIGN_EXPRESSION: return "Cannot assign to expression";
+        case TRAILING_CONSTANT: return "Constant must lead implicit mult";
+        case TRAILING_DOT: return "Decimal number must have trailing digits";
+        case LEADING_ZEROES: return "Number cannot have leading zeros";
+        case BAD_READ_OR_SUBSCRIPT: return "Undeclared variable (subscript not suitable for implicit loop assignment)";
+        case UNRECOGNIZED_STMT: return "Unrecognized statement";
+        case UNRECOGNIZED_EXPR: return "Unrecognized expression";
+        case TYPE_NOT_ADDABLE: return "Type is not addable";
+        case SUBTRACT_NON_SCALAR: return "Subtract non-scalar";
+        case SUBTRACT_NON_MATRIX: return "Subtract non-matrix";
+        case DIMENSION_MISMATCH: return "Dimension mismatch";
+        case SUBTRACT_NON_NUMERIC: return "Subtracting non-numeric type";
+        case NON_NUMERIC_TYPE: return "Numeric operation on non-numeric type";
+        case NON_SCALAR_TYPE: return "Scalar operation with non-scalar type";
+        case STRING_CONVERSION: return "Cannot convert to string";
+        case IMAGINARY_RESULT: return "Result is imaginary";
+        case EIGEN_UNSUPPORTED: return "Not compiled with Eigen unsupported features";
+        case TYPE_ERROR: return "Type error";
+        case DIV_BY_ZERO: return "Divided by zero";
+        case UNUSED_VAR: return "Variable is unused";
+        case INFINITE_LOOP: return "Loop does not terminate";
+        case NONTERMINATING_SLICE: return "Slice steps in wrong direction";
+        case INVALID_PARAMETER: return "Invalid parameter";
+        case NOT_CALLABLE: return "Expression is not callable";
+        case INVALID_ARGS: return "Arguments do not match parameters";
+        case NO_RETURN: return "Function did not give a return value";
+        case UNUSED_EXPRESSION: return "Expression unused";
+        case EXPECT_DEFAULT_ARG: return "Expected default arg";
+        case BAD_BREAK: return "Break statement not in loop";
+        case BAD_CONTINUE: return "Continue statement not in loop";
+        case AMBIGIOUS_TRIG_POWER: return "Negative trig power is ambiguous. Use explicit power (sin(x)^-1 or csc(x)) or explicit inverse function (arcsin(x))";
+        case LOG_ARG: return "Logarithm argument must be positive";
+        case LOG_BASE: return "Logarithm base must be positive";
+        case EMPTY_BIG_SYMBOL: return "Big symbol must have 2 arguments";
+        case BIG_SYMBOL_ARG: return "Big symbol argument must be an integer";
+        case BIG_SYMBOL_RANGE: return "Big symbol range must increase";
+        case EMPTY_CASES: return "Incomplete case coverage";
+        case OVERLAPPING_CASES: return "Cases are not mutually exclusive";
+        case SCALAR_MATRIX: return "1×1 matrix is ambiguous";
+        case UNUSED_ELEM_AGN_INDEX: return "Undeclared variable\n(an element assignment index must be used in rhs to prevent ambiguity)";
+        case INTERRUPT: return "Execution stopped by user";
+        case EXPECT_LPAREN: return "Expected ‘(‘";
+        case EXPECT_RPAREN: return "Expected ‘)’";
+        case EXPECT_RBRACE: return "Expected ‘]’";
+        case EXPECT_LBRACKET: return "Expected ‘}’";
+        case EXPECT_DOUBLEBAR: return "Expected ‘‖’";
+        case EXPECT_RANGLE: return "Expected ‘⟩’";
+        case RECURSIVE_TYPE: return "Type cannot be deduced due to recursion";
+        case CALL_BEFORE_DEFINE: return "Algorithm called before being defined";
+        case TOO_MANY_ARGS: return "Too many arguments at call site";
+        case TOO_FEW_ARGS: return "Too few arguments at call site";
+        case SHADOWING_VAR: return "Declaration here shadows a variable in an outer scope";
+        case EXPECT_BOOLEAN: return "Expected boolean in conditional";
+        case EXPECT_SCALAR: return "Expected scalar";
+        case AUTOSIZE: return "Failed to deduce dimensions of auto-size variable";
+        case RETURN_OUTSIDE_FUNCTION: return "Cannot return from outside of function";
+        case EXPECT_POSITIVE_INT: return "Expect semipositive integer";
+        case EXPECT_NATURAL_NUMBER: return "Expect natural number";
+        case CALC_OVERFLOW: return "Calculation overflows";
+        case BINOM_K_EXCEED_N: return "Binomial coefficient options must exceed choices";
+        case LIMIT_NOT_SUPPORTED: return "Limits are not supported yet";
+        case BAD_RANGED_FOR_VAR: return "Ranged-for iterator must be a variable name";
+        case TYPE_NOT_ITERABLE: return "Type is not iterable";
+        case COMPLEMENT_C: return "The letter ‘c’ is not advised for set complements. Use the complement symbol ‘∁’ to avoid ambiguity.";
+        case TRANSPOSE_T: return "The letter ‘T’ is not advised for matrix transpose. Use the transpose symbol ‘⊤’ to avoid ambiguity.";
+        case EXPECTED_FILEPATH: return "Expected filepath";
+        case FILE_CORRUPTED: return "File contains invalid encoding";
+        case SELF_IMPORT: return "Self import not allowed";
+        case NOT_IMPLEMENTED: return "This parse rule is not fully supported yet";
+        case ERROR_IN_LOADED_FILE: return "Imported file contains an error";
+        case NOT_A_SCOPE: return "Scope does not exist";
+        case EXPECT_GROUPING_CLOSE: return "Expected grouping close";
+        case EXPECT_CASE: return "Expected switch case";
+        case UNSUPPORTED_SWITCH_TYPE: return "Switch is not supported on this type";
+        case VALUE_NOT_DETERMINED: return "Value could not be determined at compile time";
+        case REDUNDANT_CASE: return "Case value is already used";
+        case UNRECOGNIZED_SYMBOL: return "Scanner error – unrecognized symbol";
+        case CONSUME: return "Unexpected token";
+        case REASSIGN_CONSTANT: return "Reassigning to constant";
+        case REDEFINE_PARAMETER: return "Parameter is already defined";
+        case MUTABLE_CONST_ASSIGN: return "Assigning constant to pre-existing mutable var";
+        case BAD_READ: return "Undeclared variable";
+        case INDEX_OUT_OF_RANGE: return "Index out of range";
+        case NON_LVALUE: return "Expression cannot be used as lvalue";
+        case USE_BEFORE_DEFINE: return "Variable is used before it is defined";
+        case ASSERT_FAIL: return "Assertion failed";
+        case BAD_DEFAULT_ARG: return "Previous parameter cannot be used in default arg";
+        case FILE_NOT_FOUND: return "File not found on compiler search path";
+        case MODULE_FIELD_NOT_FOUND: return "Variable does not exist in global scope of file";
+        default: assert(false); return "";
+    }
+}
+
+inline bool shouldQuote(ErrorCode code){
+    return code >= UNRECOGNIZED_SYMBOL;
+}
+} // namespace Code
+
+} // namespace Forscape
+
+#endif // FORSCAPE_CODE_ERROR_TYPES_H
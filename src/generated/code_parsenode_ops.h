@@ -0,0 +1,267 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_CODE_PARSENODE_OPS_H
+#define FORSCAPE_CODE_PARSENODE_OPS_H
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace Forscape {
+
+namespace Code {
+
+typedef size_t Op;
+
+constexpr size_t OP_FALSE = 0;
+constexpr size_t OP_EQUAL = 1;
+constexpr size_t OP_NOT_EQUAL = 2;
+constexpr size_t OP_APPROX = 3;
+constexpr size_t OP_NOT_APPROX = 4;
+constexpr size_t OP_NOT_IN = 5;
+constexpr size_t OP_GREATER = 6;
+constexpr size_t OP_LESS = 7;
+constexpr size_t OP_LOGICAL_AND = 8;
+constexpr size_t OP_LOGICAL_NOT = 9;
+constexpr size_t OP_LOGICAL_OR = 10;
+constexpr size_t OP_TRUE = 11;
+constexpr size_t OP_ABS = 12;
+constexpr size_t OP_ADDITION = 13;
+constexpr size_t OP_BINOMIAL = 14;
+constexpr size_t OP_CEIL = 15;
+constexpr size_t OP_CLOSED_SURFACE_INTEGRAL = 16;
+constexpr size_t OP_CLOSED_VOLUME_INTEGRAL = 17;
+constexpr size_t OP_COMMENT = 18;
+constexpr size_t OP_CONTOUR_INTEGRAL = 19;
+constexpr size_t OP_CROSS = 20;
+constexpr size_t OP_CURL = 21;
+constexpr size_t OP_CURRENCY_DOLLARS = 22;
+constexpr size_t OP_CURRENCY_EUROS = 23;
+constexpr size_t OP_CURRENCY_POUNDS = 24;
+constexpr size_t OP_DAGGER = 25;
+constexpr size_t OP_DECREMENT = 26;
+constexpr size_t OP_DERIVATIVE = 27;
+constexpr size_t OP_DIVERGENCE = 28;
+constexpr size_t OP_DIVIDE = 29;
+constexpr size_t OP_DOT = 30;
+constexpr size_t OP_DOUBLE_INTEGRAL = 31;
+constexpr size_t OP_FACTORIAL = 32;
+constexpr size_t OP_FLOOR = 33;
+constexpr size_t OP_FORWARDSLASH = 34;
+constexpr size_t OP_FRACTION = 35;
+constexpr size_t OP_GRADIENT = 36;
+constexpr size_t OP_IMPLICIT_MULTIPLY = 37;
+constexpr size_t OP_INCREMENT = 38;
+constexpr size_t OP_INFIMUM = 39;
+constexpr size_t OP_INFTY = 40;
+constexpr size_t OP_INNER_PRODUCT = 41;
+constexpr size_t OP_INTEGRAL = 42;
+constexpr size_t OP_DEFINITE_INTEGRAL = 43;
+constexpr size_t OP_FLOAT = 44;
+constexpr size_t OP_LIMIT = 45;
+constexpr size_t OP_MATRIX = 46;
+constexpr size_t OP_MAX = 47;
+constexpr size_t OP_MIN = 48;
+constexpr size_t OP_MODULUS = 49;
+constexpr size_t OP_MULTIPLICATION = 50;
+constexpr size_t OP_NORM = 51;
+constexpr size_t OP_NORM_INFTY = 52;
+constexpr size_t OP_NORM_1 = 53;
+constexpr size_t OP_NORM_p = 54;
+constexpr size_t OP_INTEGER_LITERAL = 55;
+constexpr size_t OP_DECIMAL_LITERAL = 56;
+constexpr size_t OP_ODOT = 57;
+constexpr size_t OP_OUTER_PRODUCT = 58;
+constexpr size_t OP_PARTIAL = 59;
+constexpr size_t OP_POWER = 60;
+constexpr size_t OP_PRODUCT = 61;
+constexpr size_t OP_ROOT = 62;
+constexpr size_t OP_SQRT = 63;
+constexpr size_t OP_SUBSCRIPT_PARTIAL = 64;
+constexpr size_t OP_SUMMATION = 65;
+constexpr size_t OP_TRANSPOSE = 66;
+constexpr size_t OP_TRIPLE_INTEGRAL = 67;
+constexpr size_t OP_UINT_PARSED = 68;
+constexpr size_t OP_UNARY_MINUS = 69;
+constexpr size_t OP_VEE = 70;
+constexpr size_t OP_WEDGE = 71;
+constexpr size_t OP_SEQUENCE_ENUMERATED = 72;
+constexpr size_t OP_BOOLEANS = 73;
+constexpr size_t OP_COMPLEX_NUMS = 74;
+constexpr size_t OP_INTEGERS = 75;
+constexpr size_t OP_INTERSECTION = 76;
+constexpr size_t OP_INTERVAL_CLOSE_CLOSE = 77;
+constexpr size_t OP_INTERVAL_CLOSE_OPEN = 78;
+constexpr size_t OP_INTERVAL_INTEGER = 79;
+constexpr size_t OP_INTERVAL_OPEN_CLOSE = 80;
+constexpr size_t OP_INTERVAL_OPEN_OPEN = 81;
+constexpr size_t OP_NARY_INTERSECTION = 82;
+constexpr size_t OP_NARY_UNION = 83;
+constexpr size_t OP_NARY_UNIONPLUS = 84;
+constexpr size_t OP_NATURALS = 85;
+constexpr size_t OP_NEGATIVE_RATIONALS = 86;
+constexpr size_t OP_NEGATIVE_REALS = 87;
+constexpr size_t OP_POSITIVE_RATIONALS = 88;
+constexpr size_t OP_POSITIVE_REALS = 89;
+constexpr size_t OP_QUATERNIONS = 90;
+constexpr size_t OP_RATIONALS = 91;
+constexpr size_t OP_REALS = 92;
+constexpr size_t OP_PRIMES = 93;
+constexpr size_t OP_SPECIAL_ORTHOGONAL = 94;
+constexpr size_t OP_SET_BUILDER = 95;
+constexpr size_t OP_SET_ENUMERATED = 96;
+constexpr size_t OP_UNION = 97;
+constexpr size_t OP_STRING = 98;
+constexpr size_t OP_ALEPH = 99;
+constexpr size_t OP_BACKSLASH = 100;
+constexpr size_t OP_BETH = 101;
+constexpr size_t OP_CALL = 102;
+constexpr size_t OP_CARDINALITY = 103;
+constexpr size_t OP_CASES = 104;
+constexpr size_t OP_CONDITIONAL_PROBABLITY = 105;
+constexpr size_t OP_EMPTY_SET = 106;
+constexpr size_t OP_ERROR = 107;
+constexpr size_t OP_EVAL = 108;
+constexpr size_t OP_FUN_SIGNATURE = 109;
+constexpr size_t OP_GROUP_BRACKET = 110;
+constexpr size_t OP_GROUP_PAREN = 111;
+constexpr size_t OP_IDENTIFIER = 112;
+constexpr size_t OP_IN = 113;
+constexpr size_t OP_MINUS_PLUS_BINARY = 114;
+constexpr size_t OP_MINUS_PLUS_UNARY = 115;
+constexpr size_t OP_PLUS_MINUS_BINARY = 116;
+constexpr size_t OP_PLUS_MINUS_UNARY = 117;
+constexpr size_t OP_PROPORTIONAL = 118;
+constexpr size_t OP_SET_LITERAL_DIMENSIONS = 119;
+constexpr size_t OP_SUBSCRIPT_ACCESS = 120;
+constexpr size_t OP_SUBTRACTION = 121;
+constexpr size_t OP_SUPREMUM = 122;
+constexpr size_t OP_TICK_DERIVATIVE = 123;
+constexpr size_t OP_LAMBDA = 124;
+constexpr size_t OP_LIST = 125;
+constexpr size_t OP_READ_GLOBAL = 126;
+constexpr size_t OP_READ_UPVALUE = 127;
+constexpr size_t OP_SINE = 128;
+constexpr size_t OP_COSINE = 129;
+constexpr size_t OP_TANGENT = 130;
+constexpr size_t OP_ARCSINE = 131;
+constexpr size_t OP_ARCCOSINE = 132;
+constexpr size_t OP_ARCTANGENT = 133;
+constexpr size_t OP_ARCTANGENT2 = 134;
+constexpr size_t OP_COSECANT = 135;
+constexpr size_t OP_SECANT = 136;
+constexpr size_t OP_COTANGENT = 137;
+constexpr size_t OP_ARCCOSECANT = 138;
+constexpr size_t OP_ARCSECANT = 139;
+constexpr size_t OP_ARCCOTANGENT = 140;
+constexpr size_t OP_HYPERBOLIC_SINE = 141;
+constexpr size_t OP_HYPERBOLIC_COSINE = 142;
+constexpr size_t OP_HYPERBOLIC_TANGENT = 143;
+constexpr size_t OP_HYPERBOLIC_ARCSINE = 144;
+constexpr size_t OP_HYPERBOLIC_ARCCOSINE = 145;
+constexpr size_t OP_HYPERBOLIC_ARCTANGENT = 146;
+constexpr size_t OP_HYPERBOLIC_COSECANT = 147;
+constexpr size_t OP_HYPERBOLIC_SECANT = 148;
+constexpr size_t OP_HYPERBOLIC_COTANGENT = 149;
+constexpr size_t OP_HYPERBOLIC_ARCCOSECANT = 150;
+constexpr size_t OP_HYPERBOLIC_ARCSECANT = 151;
+constexpr size_t OP_HYPERBOLIC_ARCCOTANGENT = 152;
+constexpr size_t OP_EXP = 153;
+constexpr size_t OP_NATURAL_LOG = 154;
+constexpr size_t OP_LOGARITHM = 155;
+constexpr size_t OP_LOGARITHM_BASE = 156;
+constexpr size_t OP_ALGORITHM = 157;
+constexpr size_t OP_ASSIGN = 158;
+constexpr size_t OP_REASSIGN = 159;
+constexpr size_t OP_BLOCK = 160;
+constexpr size_t OP_DEFINE_EQUALS = 161;
+constexpr size_t OP_EXPR_STMT = 162;
+constexpr size_t OP_FUN_DEF = 163;
+constexpr size_t OP_IF = 164;
+constexpr size_t OP_IF_ELSE = 165;
+constexpr size_t OP_PRINT = 166;
+constexpr size_t OP_RETURN = 167;
+constexpr size_t OP_RETURN_EMPTY = 168;
+constexpr size_t OP_WHILE = 169;
+constexpr size_t OP_ZERO_MATRIX = 170;
+constexpr size_t OP_ONES_MATRIX = 171;
+constexpr size_t OP_IDENTITY_MATRIX = 172;
+constexpr size_t OP_IDENTITY_AUTOSIZE = 173;
+constexpr size_t OP_UNIT_VECTOR = 174;
+constexpr size_t OP_UNIT_VECTOR_AUTOSIZE = 175;
+constexpr size_t OP_LENGTH = 176;
+constexpr size_t OP_BREAK = 177;
+constexpr size_t OP_CONTINUE = 178;
+constexpr size_t OP_FOR = 179;
+constexpr size_t OP_RANGED_FOR = 180;
+constexpr size_t OP_NAUGHT = 181;
+constexpr size_t OP_PSEUDO_INVERSE = 182;
+constexpr size_t OP_ASSERT = 183;
+constexpr size_t OP_ERROR_FUNCTION = 184;
+constexpr size_t OP_COMP_ERR_FUNC = 185;
+constexpr size_t OP_PI = 186;
+constexpr size_t OP_EULERS_NUMBER = 187;
+constexpr size_t OP_GOLDEN_RATIO = 188;
+constexpr size_t OP_SPEED_OF_LIGHT = 189;
+constexpr size_t OP_PLANCK_CONSTANT = 190;
+constexpr size_t OP_REDUCED_PLANCK_CONSTANT = 191;
+constexpr size_t OP_STEFAN_BOLTZMANN_CONSTANT = 192;
+constexpr size_t OP_GRAVITY = 193;
+constexpr size_t OP_ACCENT_HAT = 194;
+constexpr size_t OP_ELEMENTWISE_ASSIGNMENT = 195;
+constexpr size_t OP_SLICE_STEPPED = 196;
+constexpr size_t OP_SLICE = 197;
+constexpr size_t OP_SLICE_ALL = 198;
+constexpr size_t OP_SINGLE_CHAR_MULT_PROXY = 199;
+constexpr size_t OP_BIJECTIVE_MAPPING = 200;
+constexpr size_t OP_LINEAR_SOLVE = 201;
+constexpr size_t OP_INVERT = 202;
+constexpr size_t OP_NORM_SQUARED = 203;
+constexpr size_t OP_DO_NOTHING = 204;
+constexpr size_t OP_REASSIGN_SUBSCRIPT = 205;
+constexpr size_t OP_CHECK_ONE_ROW = 206;
+constexpr size_t OP_CHECK_ONE_COL = 207;
+constexpr size_t OP_CHECK_SCALAR = 208;
+constexpr size_t OP_CHECK_ZERO = 209;
+constexpr size_t OP_CHECK_NAT = 210;
+constexpr size_t OP_CHECK_POSITIVE_INT = 211;
+constexpr size_t OP_MATRIX_LITERAL = 212;
+constexpr size_t OP_IDENTITY_OF_SIZE = 213;
+constexpr size_t OP_ZERO_OF_SIZE = 214;
+constexpr size_t OP_PLOT = 215;
+constexpr size_t OP_ROWS = 216;
+constexpr size_t OP_COLS = 217;
+constexpr size_t OP_AMBIGUOUS_PARENTHETICAL = 218;
+constexpr size_t OP_IMAGINARY = 219;
+constexpr size_t OP_SIGN_FUNCTION = 220;
+constexpr size_t OP_SUBSET = 221;
+constexpr size_t OP_SUBSET_EQ = 222;
+constexpr size_t OP_NOT_MEMBER = 223;
+constexpr size_t OP_ACCENT_BAR = 224;
+constexpr size_t OP_COMPLEMENT = 225;
+constexpr size_t OP_MAYBE_TRANSPOSE = 226;
+constexpr size_t OP_UNDEFINED = 227;
+constexpr size_t OP_GAMMA_FUNCTION = 228;
+constexpr size_t OP_COMPOSITION = 229;
+constexpr size_t OP_UNKNOWN_LIST = 230;
+constexpr size_t OP_IMPORT = 231;
+constexpr size_t OP_FROM_IMPORT = 232;
+constexpr size_t OP_FILE_REF = 233;
+constexpr size_t OP_SCOPE_ACCESS = 234;
+constexpr size_t OP_NAMESPACE = 235;
+constexpr size_t OP_CLASS = 236;
+constexpr size_t OP_CASE = 237;
+constexpr size_t OP_DEFAULT = 238;
+constexpr size_t OP_SWITCH = 239;
+constexpr size_t OP_SWITCH_NUMERIC = 240;
+constexpr size_t OP_SWITCH_STRING = 241;
+constexpr size_t OP_ENUM = 242;
+constexpr size_t OP_LEXICAL_SCOPE = 243;
+constexpr size_t OP_SETTINGS_UPDATE = 244;
+constexpr size_t OP_LOOP_INVARIANT = 245;
+
+
+} // namespace Code
+
+} // namespace Forscape
+
+#endif // FORSCAPE_CODE_PARSENODE_OPS_H
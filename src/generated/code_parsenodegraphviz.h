@@ -0,0 +1,267 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_CODE_PARSENODEGRAPHVIZ_H
+#define FORSCAPE_CODE_PARSENODEGRAPHVIZ_H
+
+#include <forscape_parse_tree.h>
+
+namespace Forscape {
+
+namespace Code {
+
+void ParseTree::writeType(std::string& src, ParseNode n) const{
+    switch(getOp(n)){
+        case OP_FALSE: src += "\"false\""; break;
+        case OP_EQUAL: src += "\"=\""; break;
+        case OP_NOT_EQUAL: src += "\"≠\""; break;
+        case OP_APPROX: src += "\"≈\""; break;
+        case OP_NOT_APPROX: src += "\"≉\""; break;
+        case OP_NOT_IN: src += "\"∉\""; break;
+        case OP_GREATER: src += "\">\""; break;
+        case OP_LESS: src += "\"<\""; break;
+        case OP_LOGICAL_AND: src += "\"∧\""; break;
+        case OP_LOGICAL_NOT: src += "\"¬\""; break;
+        case OP_LOGICAL_OR: src += "\"∨\""; break;
+        case OP_TRUE: src += "\"true\""; break;
+        case OP_ABS: src += "\"| |\""; break;
+        case OP_ADDITION: src += "\"+\""; break;
+        case OP_BINOMIAL: src += "\"⁜b\""; break;
+        case OP_CEIL: src += "\"⌈ ⌉\""; break;
+        case OP_CLOSED_SURFACE_INTEGRAL: src += "\"∯\""; break;
+        case OP_CLOSED_VOLUME_INTEGRAL: src += "\"∰\""; break;
+        case OP_COMMENT: src += "\"//\""; break;
+        case OP_CONTOUR_INTEGRAL: src += "\"∮\""; break;
+        case OP_CROSS: src += "\"×\""; break;
+        case OP_CURL: src += "\"∇×\""; break;
+        case OP_CURRENCY_DOLLARS: src += "\"$\""; break;
+        case OP_CURRENCY_EUROS: src += "\"€\""; break;
+        case OP_CURRENCY_POUNDS: src += "\"£\""; break;
+        case OP_DAGGER: src += "\"†\""; break;
+        case OP_DECREMENT: src += "\"x⁻\""; break;
+        case OP_DERIVATIVE: src += "\"ⅆy/ⅆx\""; break;
+        case OP_DIVERGENCE: src += "\"∇⋅\""; break;
+        case OP_DIVIDE: src += "\"÷\""; break;
+        case OP_DOT: src += "\"⋅\""; break;
+        case OP_DOUBLE_INTEGRAL: src += "\"∬\""; break;
+        case OP_FACTORIAL: src += "\"!\""; break;
+        case OP_FLOOR: src += "\"⌊ ⌋\""; break;
+        case OP_FORWARDSLASH: src += "\"/\""; break;
+        case OP_FRACTION: src += "\"⁜f\""; break;
+        case OP_GRADIENT: src += "\"∇\""; break;
+        case OP_IMPLICIT_MULTIPLY: src += "\"*imp\""; break;
+        case OP_INCREMENT: src += "\"x⁺\""; break;
+        case OP_INFIMUM: src += "\"inf\""; break;
+        case OP_INFTY: src += "\"∞\""; break;
+        case OP_INNER_PRODUCT: src += "\"⟨ | ⟩\""; break;
+        case OP_INTEGRAL: src += "\"∫\""; break;
+        case OP_DEFINITE_INTEGRAL: src += "\"∫\""; break;
+        case OP_FLOAT: src += "\"float\""; break;
+        case OP_LIMIT: src += "\"lim\""; break;
+        case OP_MATRIX: src += "\"⁜⊞\""; break;
+        case OP_MAX: src += "\"max\""; break;
+        case OP_MIN: src += "\"min\""; break;
+        case OP_MODULUS: src += "\"%\""; break;
+        case OP_MULTIPLICATION: src += "\"*\""; break;
+        case OP_NORM: src += "\"‖ ‖\""; break;
+        case OP_NORM_INFTY: src += "\"‖ ‖∞\""; break;
+        case OP_NORM_1: src += "\"‖ ‖1\""; break;
+        case OP_NORM_p: src += "\"‖ ‖p\""; break;
+        case OP_INTEGER_LITERAL: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_DECIMAL_LITERAL: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_ODOT: src += "\"⨀\""; break;
+        case OP_OUTER_PRODUCT: src += "\"⊗\""; break;
+        case OP_PARTIAL: src += "\"∂y/∂x\""; break;
+        case OP_POWER: src += "\"^\""; break;
+        case OP_PRODUCT: src += "\"∏\""; break;
+        case OP_ROOT: src += "\"⁜∛\""; break;
+        case OP_SQRT: src += "\"⁜√\""; break;
+        case OP_SUBSCRIPT_PARTIAL: src += "\"∂\""; break;
+        case OP_SUMMATION: src += "\"Σ\""; break;
+        case OP_TRANSPOSE: src += "\"⊤\""; break;
+        case OP_TRIPLE_INTEGRAL: src += "\"∭\""; break;
+        case OP_UINT_PARSED: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_UNARY_MINUS: src += "\"-\""; break;
+        case OP_VEE: src += "\"∨\""; break;
+        case OP_WEDGE: src += "\"∧\""; break;
+        case OP_SEQUENCE_ENUMERATED: src += "\"(,,,)\""; break;
+        case OP_BOOLEANS: src += "\"𝔹\""; break;
+        case OP_COMPLEX_NUMS: src += "\"ℂ \""; break;
+        case OP_INTEGERS: src += "\"ℤ\""; break;
+        case OP_INTERSECTION: src += "\"∩\""; break;
+        case OP_INTERVAL_CLOSE_CLOSE: src += "\"[,]\""; break;
+        case OP_INTERVAL_CLOSE_OPEN: src += "\"[,)\""; break;
+        case OP_INTERVAL_INTEGER: src += "\"⟦,⟧\""; break;
+        case OP_INTERVAL_OPEN_CLOSE: src += "\"(,]\""; break;
+        case OP_INTERVAL_OPEN_OPEN: src += "\"(,)\""; break;
+        case OP_NARY_INTERSECTION: src += "\"⁜⋂\""; break;
+        case OP_NARY_UNION: src += "\"⁜⋃\""; break;
+        case OP_NARY_UNIONPLUS: src += "\"⁜⨄\""; break;
+        case OP_NATURALS: src += "\"ℕ\""; break;
+        case OP_NEGATIVE_RATIONALS: src += "\"ℚ⁻\""; break;
+        case OP_NEGATIVE_REALS: src += "\"ℝ⁻\""; break;
+        case OP_POSITIVE_RATIONALS: src += "\"ℚ⁺\""; break;
+        case OP_POSITIVE_REALS: src += "\"ℝ⁺\""; break;
+        case OP_QUATERNIONS: src += "\"ℍ\""; break;
+        case OP_RATIONALS: src += "\"ℚ\""; break;
+        case OP_REALS: src += "\"ℝ\""; break;
+        case OP_PRIMES: src += "\"ℙ\""; break;
+        case OP_SPECIAL_ORTHOGONAL: src += "\"SO\""; break;
+        case OP_SET_BUILDER: src += "\"{ | }\""; break;
+        case OP_SET_ENUMERATED: src += "\"{,,,}\""; break;
+        case OP_UNION: src += "\"∪\""; break;
+        case OP_STRING: src += "\"\\\""; src += str(n).substr(1, str(n).size()-2); src += "\\\"\", fillcolor=green, style=filled"; break;
+        case OP_ALEPH: src += "\"ℵ\""; break;
+        case OP_BACKSLASH: src += "\"\\\\\""; break;
+        case OP_BETH: src += "\"ℶ\""; break;
+        case OP_CALL: src += "\"f( )\""; break;
+        case OP_CARDINALITY: src += "\"#\""; break;
+        case OP_CASES: src += "\"⁜c\""; break;
+        case OP_CONDITIONAL_PROBABLITY: src += "\"P( | )\""; break;
+        case OP_EMPTY_SET: src += "\"∅\""; break;
+        case OP_ERROR: src += "\"err\""; break;
+        case OP_EVAL: src += "\"⁜_|\""; break;
+        case OP_FUN_SIGNATURE: src += "\"f:×→\""; break;
+        case OP_GROUP_BRACKET: src += "\"[ ]\""; break;
+        case OP_GROUP_PAREN: src += "\"( )\""; break;
+        case OP_IDENTIFIER: src += '"'; src += str(n); src += "\", fillcolor=cyan, style=filled"; break;
+        case OP_IN: src += "\"∈\""; break;
+        case OP_MINUS_PLUS_BINARY: src += "\"∓\""; break;
+        case OP_MINUS_PLUS_UNARY: src += "\"∓\""; break;
+        case OP_PLUS_MINUS_BINARY: src += "\"±\""; break;
+        case OP_PLUS_MINUS_UNARY: src += "\"±\""; break;
+        case OP_PROPORTIONAL: src += "\"∝\""; break;
+        case OP_SET_LITERAL_DIMENSIONS: src += "\"dim\""; break;
+        case OP_SUBSCRIPT_ACCESS: src += "\"xᵢ\""; break;
+        case OP_SUBTRACTION: src += "\"-\""; break;
+        case OP_SUPREMUM: src += "\"sup\""; break;
+        case OP_TICK_DERIVATIVE: src += "\"'\""; break;
+        case OP_LAMBDA: src += "\"λ-fun\""; break;
+        case OP_LIST: src += "\"list\""; break;
+        case OP_READ_GLOBAL: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_READ_UPVALUE: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_SINE: src += "\"sin\""; break;
+        case OP_COSINE: src += "\"cos\""; break;
+        case OP_TANGENT: src += "\"tan\""; break;
+        case OP_ARCSINE: src += "\"arcsin\""; break;
+        case OP_ARCCOSINE: src += "\"arccos\""; break;
+        case OP_ARCTANGENT: src += "\"arctan\""; break;
+        case OP_ARCTANGENT2: src += "\"arctan2\""; break;
+        case OP_COSECANT: src += "\"csc\""; break;
+        case OP_SECANT: src += "\"sec\""; break;
+        case OP_COTANGENT: src += "\"cot\""; break;
+        case OP_ARCCOSECANT: src += "\"arccsc\""; break;
+        case OP_ARCSECANT: src += "\"arcsec\""; break;
+        case OP_ARCCOTANGENT: src += "\"arccot\""; break;
+        case OP_HYPERBOLIC_SINE: src += "\"sinh\""; break;
+        case OP_HYPERBOLIC_COSINE: src += "\"cosh\""; break;
+        case OP_HYPERBOLIC_TANGENT: src += "\"tanh\""; break;
+        case OP_HYPERBOLIC_ARCSINE: src += "\"asinh\""; break;
+        case OP_HYPERBOLIC_ARCCOSINE: src += "\"acosh\""; break;
+        case OP_HYPERBOLIC_ARCTANGENT: src += "\"atanh\""; break;
+        case OP_HYPERBOLIC_COSECANT: src += "\"csch\""; break;
+        case OP_HYPERBOLIC_SECANT: src += "\"sech\""; break;
+        case OP_HYPERBOLIC_COTANGENT: src += "\"coth\""; break;
+        case OP_HYPERBOLIC_ARCCOSECANT: src += "\"acsch\""; break;
+        case OP_HYPERBOLIC_ARCSECANT: src += "\"asech\""; break;
+        case OP_HYPERBOLIC_ARCCOTANGENT: src += "\"acoth\""; break;
+        case OP_EXP: src += "\"exp\""; break;
+        case OP_NATURAL_LOG: src += "\"ln\""; break;
+        case OP_LOGARITHM: src += "\"log\""; break;
+        case OP_LOGARITHM_BASE: src += "\"log\""; break;
+        case OP_ALGORITHM: src += "\"alg\""; break;
+        case OP_ASSIGN: src += "\"←\""; break;
+        case OP_REASSIGN: src += "\"←\""; break;
+        case OP_BLOCK: src += "\"block\""; break;
+        case OP_DEFINE_EQUALS: src += "\"≔\""; break;
+        case OP_EXPR_STMT: src += "\"expr\\nstmt\""; break;
+        case OP_FUN_DEF: src += "\"f:()↦\""; break;
+        case OP_IF: src += "\"if\""; break;
+        case OP_IF_ELSE: src += "\"if/else\""; break;
+        case OP_PRINT: src += "\"print\""; break;
+        case OP_RETURN: src += "\"return\""; break;
+        case OP_RETURN_EMPTY: src += "\"return\""; break;
+        case OP_WHILE: src += "\"while\""; break;
+        case OP_ZERO_MATRIX: src += "\"0_mat\""; break;
+        case OP_ONES_MATRIX: src += "\"1_mat\""; break;
+        case OP_IDENTITY_MATRIX: src += "\"I_mat\""; break;
+        case OP_IDENTITY_AUTOSIZE: src += "\"I_auto\""; break;
+        case OP_UNIT_VECTOR: src += "\"e_vec\""; break;
+        case OP_UNIT_VECTOR_AUTOSIZE: src += "\"e_vec\""; break;
+        case OP_LENGTH: src += "\"len\""; break;
+        case OP_BREAK: src += "\"break\""; break;
+        case OP_CONTINUE: src += "\"continue\""; break;
+        case OP_FOR: src += "\"for\""; break;
+        case OP_RANGED_FOR: src += "\"for each\""; break;
+        case OP_NAUGHT: src += "\"*\""; break;
+        case OP_PSEUDO_INVERSE: src += "\"+\""; break;
+        case OP_ASSERT: src += "\"assert\""; break;
+        case OP_ERROR_FUNCTION: src += "\"erf\""; break;
+        case OP_COMP_ERR_FUNC: src += "\"erfc\""; break;
+        case OP_PI: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_EULERS_NUMBER: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_GOLDEN_RATIO: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_SPEED_OF_LIGHT: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_PLANCK_CONSTANT: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_REDUCED_PLANCK_CONSTANT: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_STEFAN_BOLTZMANN_CONSTANT: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_GRAVITY: src += "\"g\""; break;
+        case OP_ACCENT_HAT: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_ELEMENTWISE_ASSIGNMENT: src += "\"←\""; break;
+        case OP_SLICE_STEPPED: src += "\"a:b:c\""; break;
+        case OP_SLICE: src += "\"a:b\""; break;
+        case OP_SLICE_ALL: src += "\":\""; break;
+        case OP_SINGLE_CHAR_MULT_PROXY: src += "\"⟳\""; break;
+        case OP_BIJECTIVE_MAPPING: src += "\"^∨\""; break;
+        case OP_LINEAR_SOLVE: src += "\"A⁻¹b\""; break;
+        case OP_INVERT: src += "\"⁻¹\""; break;
+        case OP_NORM_SQUARED: src += "\"‖x‖²\""; break;
+        case OP_DO_NOTHING: src += "\"-DN-\""; break;
+        case OP_REASSIGN_SUBSCRIPT: src += "\"xₙ ← y\""; break;
+        case OP_CHECK_ONE_ROW: src += "\"Rows=1\""; break;
+        case OP_CHECK_ONE_COL: src += "\"Cols=1\""; break;
+        case OP_CHECK_SCALAR: src += "\"∈ℝ\""; break;
+        case OP_CHECK_ZERO: src += "\"Assert=0\""; break;
+        case OP_CHECK_NAT: src += "\"∈ℕ\""; break;
+        case OP_CHECK_POSITIVE_INT: src += "\"∈ℤ⁺\""; break;
+        case OP_MATRIX_LITERAL: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_IDENTITY_OF_SIZE: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_ZERO_OF_SIZE: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_PLOT: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_ROWS: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_COLS: src += '"'; src += str(n); src += "\", fillcolor=orange, style=filled"; break;
+        case OP_AMBIGUOUS_PARENTHETICAL: src += "\"f(x)?\""; break;
+        case OP_IMAGINARY: src += "\"i\""; break;
+        case OP_SIGN_FUNCTION: src += "\"sgn\""; break;
+        case OP_SUBSET: src += "\"⊂\""; break;
+        case OP_SUBSET_EQ: src += "\"⊆\""; break;
+        case OP_NOT_MEMBER: src += "\"∉\""; break;
+        case OP_ACCENT_BAR: src += "\"x̅\""; break;
+        case OP_COMPLEMENT: src += "\"∁\""; break;
+        case OP_MAYBE_TRANSPOSE: src += "\"Aᵀ\""; break;
+        case OP_UNDEFINED: src += "\"undefined\""; break;
+        case OP_GAMMA_FUNCTION: src += "\"Γ(…)\""; break;
+        case OP_COMPOSITION: src += "\"f ∘ g\""; break;
+        case OP_UNKNOWN_LIST: src += "\"unk\""; break;
+        case OP_IMPORT: src += "\"import\""; break;
+        case OP_FROM_IMPORT: src += "\"import_from\""; break;
+        case OP_FILE_REF: src += "\"file_ref\""; break;
+        case OP_SCOPE_ACCESS: src += "\"a.b\""; break;
+        case OP_NAMESPACE: src += "\"namespace\""; break;
+        case OP_CLASS: src += "\"class\""; break;
+        case OP_CASE: src += "\"case\""; break;
+        case OP_DEFAULT: src += "\"default\""; break;
+        case OP_SWITCH: src += "\"switch\""; break;
+        case OP_SWITCH_NUMERIC: src += "\"switch\""; break;
+        case OP_SWITCH_STRING: src += "\"switch\""; break;
+        case OP_ENUM: src += "\"enum\""; break;
+        case OP_LEXICAL_SCOPE: src += "\"lex\""; break;
+        case OP_SETTINGS_UPDATE: src += "\"🛠\""; break;
+        case OP_LOOP_INVARIANT: src += "\"-LI-\""; break;
+    }
+}
+
+} // namespace Code
+
+} // namespace Forscape
+
+#endif // FORSCAPE_CODE_PARSENODEGRAPHVIZ_H
@@ -0,0 +1,36 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_CODE_PREDEFINED_H
+#define FORSCAPE_CODE_PREDEFINED_H
+
+#include <code_parsenode_ops.h>
+#include <forscape_perfect_hash.h>
+
+namespace Forscape {
+
+namespace Code {
+
+constexpr size_t FORSCAPE_PREDEFINED_MAP_SIZE = 11;
+
+#define FORSCAPE_PREDEFINED_MAP { \
+    {{0, 0, 0, 0, 393, 0, 0, 0, 0, 0, 0}}, \
+    {{ \
+        {"T", OP_MAYBE_TRANSPOSE}, \
+        {"ℎ", OP_PLANCK_CONSTANT}, \
+        {"I", OP_IDENTITY_AUTOSIZE}, \
+        {"π", OP_PI}, \
+        {"e", OP_EULERS_NUMBER}, \
+        {"σ", OP_STEFAN_BOLTZMANN_CONSTANT}, \
+        {"ℏ", OP_REDUCED_PLANCK_CONSTANT}, \
+        {"φ", OP_GOLDEN_RATIO}, \
+        {"Γ", OP_GAMMA_FUNCTION}, \
+        {"g", OP_GRAVITY}, \
+        {"c", OP_SPEED_OF_LIGHT}, \
+    }} \
+}
+
+} // namespace Code
+
+} // namespace Forscape
+
+#endif // FORSCAPE_CODE_PREDEFINED_H
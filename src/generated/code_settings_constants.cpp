@@ -0,0 +1,31 @@
+//CODEGEN
+
+#include "code_settings_constants.h"
+
+#include "forscape_common.h"
+
+namespace Forscape {
+
+const FORSCAPE_UNORDERED_MAP<std::string_view, SettingId> setting_map {
+    {setting_names[WARN_UNUSED_VARIABLE], WARN_UNUSED_VARIABLE},
+    {setting_names[WARN_SHADOWING], WARN_SHADOWING},
+    {setting_names[WARN_TRANSPOSE_T], WARN_TRANSPOSE_T},
+};
+
+SettingId settingFromStr(std::string_view str) noexcept {
+    const auto result = setting_map.find(str);
+    return result==setting_map.end() ? SETTING_NONE : result->second;
+}
+
+const FORSCAPE_UNORDERED_MAP<std::string_view, WarningLevel> warning_map {
+    {warning_names[NO_WARNING], NO_WARNING},
+    {warning_names[WARN], WARN},
+    {warning_names[ERROR], ERROR},
+};
+
+WarningLevel warningFromStr(std::string_view str) noexcept {
+    const auto result = warning_map.find(str);
+    return result==warning_map.end() ? WARNING_NONE : result->second;
+}
+
+} // namespace Forscape
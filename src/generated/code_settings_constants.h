@@ -0,0 +1,82 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_CODE_SETTINGS_CONSTANTS_H
+#define FORSCAPE_CODE_SETTINGS_CONSTANTS_H
+
+#include <array>
+#include <stdint.h>
+#include <string_view>
+
+namespace Forscape {
+
+#define NUM_CODE_SETTINGS 3
+
+enum SettingId {
+    WARN_UNUSED_VARIABLE,  // Variable is set but never referenced
+    WARN_SHADOWING,  // Variable name matches one from an outer scope
+    WARN_TRANSPOSE_T,  // Transpose with letter 'T' instead of symbol '⊤'
+    SETTING_NONE
+};
+
+inline constexpr std::array<std::string_view, NUM_CODE_SETTINGS> setting_names = {
+    "UNUSED_VARIABLE",
+    "SHADOWING",
+    "TRANSPOSE_T",
+};
+
+inline constexpr std::array<std::string_view, NUM_CODE_SETTINGS> setting_id_labels = {
+    "Unused Variable",
+    "Shadowing",
+    "Transpose ‘T’",
+};
+
+inline constexpr std::array<std::string_view, NUM_CODE_SETTINGS> setting_descriptions = {
+    "Variable is set but never referenced",
+    "Variable name matches one from an outer scope",
+    "Transpose with letter 'T' instead of symbol '⊤'",
+};
+
+#define NUM_WARNING_LEVELS 3
+
+enum WarningLevel {
+    NO_WARNING,
+    WARN,
+    ERROR,
+    WARNING_NONE
+};
+
+inline constexpr std::array<std::string_view, NUM_WARNING_LEVELS> warning_names = {
+    "NO_WARNING",
+    "WARN",
+    "ERROR",
+};
+
+inline constexpr std::array<std::string_view, NUM_WARNING_LEVELS> warning_labels = {
+    "Ignore",
+    "Warning",
+    "Error",
+};
+
+inline constexpr std::array<std::string_view, NUM_WARNING_LEVELS> warning_descriptions = {
+    "Ignore the condition",
+    "Warn if the condition is encountered",
+    "Fail if the condition is encountered",
+};
+
+#define COMMA_SEPARATED_WARNING_LABELS "Ignore", "Warning", "Error"
+
+typedef uint8_t SettingValue;
+
+inline constexpr std::array<SettingValue, NUM_CODE_SETTINGS> DEFAULT_CODE_SETTINGS = {
+    WARN,  // UNUSED_VARIABLE
+    NO_WARNING,  // SHADOWING
+    WARN,  // TRANSPOSE_T
+};
+
+SettingId settingFromStr(std::string_view str) noexcept;
+
+WarningLevel warningFromStr(std::string_view str) noexcept;
+
+} // namespace Forscape
+
+#endif // FORSCAPE_CODE_SETTINGS_CONSTANTS_H
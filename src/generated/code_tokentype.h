@@ -0,0 +1,743 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_CODE_TOKENTYPE_H
+#define FORSCAPE_CODE_TOKENTYPE_H
+
+#include <forscape_perfect_hash.h>
+
+namespace Forscape {
+
+namespace Code {
+
+enum ForscapeTokenType {
+    ALEPH,
+    ALGORITHM,
+    APPROX,
+    ARGCLOSE,
+    AS,
+    AT,
+    BACKSLASH,
+    BAR,
+    BECAUSE,
+    BETH,
+    CASE,
+    CAP,
+    CARET,
+    CLASS,
+    COLON,
+    COMMA,
+    COMMENT,
+    COMPLEMENT,
+    CONJUNCTION,
+    CONTOURINTEGRAL,
+    CUP,
+    DAGGER,
+    DEFAULT,
+    DEFEQUALS,
+    DEGREE,
+    DISJUNCTION,
+    DIVIDE,
+    DOLLAR,
+    DOTPRODUCT,
+    DOUBLEBAR,
+    DOUBLEDAGGER,
+    DOUBLEEXCLAM,
+    DOUBLEGREATER,
+    DOUBLELESS,
+    DOUBLESTRUCK_B,
+    DOUBLESTRUCK_C,
+    DOUBLESTRUCK_D,
+    DOUBLESTRUCK_H,
+    DOUBLESTRUCK_I,
+    DOUBLESTRUCK_J,
+    DOUBLESTRUCK_N,
+    DOUBLESTRUCK_P,
+    DOUBLESTRUCK_Q,
+    DOUBLESTRUCK_R,
+    DOUBLESTRUCK_S,
+    DOUBLESTRUCK_W,
+    DOUBLESTRUCK_Z,
+    ELSE,
+    EMPTYSET,
+    ENDOFFILE,
+    ENUM,
+    EQUALS,
+    EQUIVALENT,
+    SCANNER_ERROR,
+    EURO,
+    EXCLAM,
+    EXISTS,
+    FALSELITERAL,
+    FILEPATH,
+    FOR,
+    FORALL,
+    FORWARDSLASH,
+    GREATER,
+    GREATEREQUAL,
+    HAMILTONIAN,
+    IDENTIFIER,
+    IF,
+    MEMBER,
+    INFTY,
+    INTEGER,
+    INTEGRAL,
+    LAPLACE,
+    LEFTANGLE,
+    LEFTARROW,
+    LEFTBRACE,
+    LEFTBRACKET,
+    LEFTCEIL,
+    LEFTDOUBLEANGLE,
+    LEFTDOUBLEBRACE,
+    LEFTFLOOR,
+    LEFTPAREN,
+    LESS,
+    LESSEQUAL,
+    MAPSTO,
+    MINUS,
+    MINUSPLUS,
+    MULTIPLY,
+    NABLA,
+    NAMESPACE,
+    NEWLINE,
+    NI,
+    NOT,
+    NOTAPPROX,
+    NOTEQUAL,
+    NOTEXIST,
+    NOTGREATER,
+    NOTIN,
+    NOTLESS,
+    NOTNI,
+    NOTSUBSET,
+    NOTSUBSETEQ,
+    OCIRC,
+    ODOT,
+    OPERATOR,
+    OUTERPRODUCT,
+    PARTIAL,
+    PERCENT,
+    PERIOD,
+    PERP,
+    PLANCKCONST,
+    PLUS,
+    PLUSMINUS,
+    POUND,
+    POUNDSTERLING,
+    PREC,
+    PRINT,
+    PRIVATE,
+    ASSERT,
+    PROPORTIONAL,
+    PUBLIC,
+    QED,
+    RETURN,
+    RIGHTANGLE,
+    RIGHTARROW,
+    RIGHTARROWDOUBLE,
+    RIGHTBRACE,
+    RIGHTBRACKET,
+    RIGHTCEIL,
+    RIGHTDOUBLEANGLE,
+    RIGHTDOUBLEBRACE,
+    RIGHTFLOOR,
+    RIGHTPAREN,
+    SEMICOLON,
+    SGN,
+    STATIC,
+    STATICASSERT,
+    STRING,
+    STRUCT,
+    SUBSCRIPTIDENTIFIER,
+    SUBSCRIPTLEFTPAREN,
+    SUBSCRIPTMINUS,
+    SUBSCRIPTNUMBER,
+    SUBSCRIPTPLUS,
+    SUBSCRIPTRIGHTPAREN,
+    SUBSET,
+    SUBSETEQ,
+    SUCC,
+    SUPERSCRIPTIDENTIFIER,
+    SUPERSCRIPTLEFTPAREN,
+    SUPERSCRIPTMINUS,
+    SUPERSCRIPTNUMBER,
+    SUPERSCRIPTPLUS,
+    SUPERSCRIPTRIGHTPAREN,
+    SUPERSCRIPTVEE,
+    SUPERSCRIPTWEDGE,
+    SUSPENSIONPOINT,
+    SWITCH,
+    THEREFORE,
+    THERMOD,
+    TICK,
+    TILDE,
+    TIMES,
+    TRANSPOSE,
+    TRIPLEGREATER,
+    TRIPLELESS,
+    TRUELITERAL,
+    TYPEDEF,
+    UNDEFINED,
+    UNKNOWN,
+    PLOT,
+    WHERE,
+    WHILE,
+    LENGTH,
+    BREAK,
+    CONTINUE,
+    SIN,
+    COS,
+    TAN,
+    CSC,
+    SEC,
+    COT,
+    ARCSIN,
+    ARCCOS,
+    ARCTAN,
+    ARCTAN2,
+    ARCCSC,
+    ARCSEC,
+    ARCCOT,
+    SINH,
+    COSH,
+    TANH,
+    ARCSINH,
+    ARCCOSH,
+    ARCTANH,
+    CSCH,
+    SECH,
+    COTH,
+    ARCCSCH,
+    ARCSECH,
+    ARCCOTH,
+    EXP,
+    NATURALLOG,
+    LOG,
+    ERRORFUNCTION,
+    COMPERRFUNC,
+    GRAVITY,
+    ROWS,
+    COLS,
+    SPECIALORTHOGONAL,
+    FROM,
+    IMPORT,
+    TOKEN_MATRIX,
+    TOKEN_CASES,
+    TOKEN_DUALSCRIPT,
+    TOKEN_FRACTION,
+    TOKEN_BINOMIAL,
+    TOKEN_LIMIT,
+    TOKEN_NRT,
+    TOKEN_BIGSUM2,
+    TOKEN_BIGPROD2,
+    TOKEN_BIGCOPROD2,
+    TOKEN_BIGUNION2,
+    TOKEN_BIGINTERSECTION2,
+    TOKEN_INTEGRAL2,
+    TOKEN_INTEGRALCONV2,
+    TOKEN_SUPERSCRIPT,
+    TOKEN_SUBSCRIPT,
+    TOKEN_MAX,
+    TOKEN_MIN,
+    TOKEN_INF,
+    TOKEN_SUP,
+    TOKEN_SQRT,
+    TOKEN_BIGSUM1,
+    TOKEN_BIGPROD1,
+    TOKEN_BIGCOPROD1,
+    TOKEN_BIGUNION1,
+    TOKEN_BIGINTERSECTION1,
+    TOKEN_INTEGRAL1,
+    TOKEN_DOUBLEINTEGRAL1,
+    TOKEN_TRIPLEINTEGRAL1,
+    TOKEN_INTEGRALCONV1,
+    TOKEN_DOUBLEINTEGRALCONV1,
+    TOKEN_TRIPLEINTEGRALCONV1,
+    TOKEN_BIGSUM0,
+    TOKEN_BIGPROD0,
+    TOKEN_BIGCOPROD0,
+    TOKEN_BIGUNION0,
+    TOKEN_BIGINTERSECTION0,
+    TOKEN_INTEGRAL0,
+    TOKEN_DOUBLEINTEGRAL0,
+    TOKEN_TRIPLEINTEGRAL0,
+    TOKEN_INTEGRALCONV0,
+    TOKEN_DOUBLEINTEGRALCONV0,
+    TOKEN_TRIPLEINTEGRALCONV0,
+    TOKEN_MARKERLINK,
+    TOKEN_ACCENTHAT,
+    TOKEN_ACCENTTILDE,
+    TOKEN_ACCENTBAR,
+    TOKEN_ACCENTBREVE,
+    TOKEN_ACCENTDOT,
+    TOKEN_ACCENTDDOT,
+    TOKEN_ACCENTDDDOT,
+    TOKEN_SETTINGS,
+};
+
+#define FORSCAPE_SCANNER_CASES \
+    case '"': scanString(); break;\
+    case '@': createToken(AT); break;\
+    case '\\': createToken(BACKSLASH); break;\
+    case '|': createToken(BAR); break;\
+    case '^': createToken(CARET); break;\
+    case ':': createToken(COLON); break;\
+    case ',': createToken(COMMA); break;\
+    case '$': createToken(DOLLAR); break;\
+    case '=': createToken(EQUALS); break;\
+    case '!': createToken(EXCLAM); break;\
+    case '>': createToken(GREATER); break;\
+    case '[': incrementScope(); createToken(LEFTBRACE); break;\
+    case '{': incrementScope(); createToken(LEFTBRACKET); break;\
+    case '(': incrementScope(); createToken(LEFTPAREN); break;\
+    case '<': createToken(LESS); break;\
+    case '-': createToken(MINUS); break;\
+    case '*': createToken(MULTIPLY); break;\
+    case '%': createToken(PERCENT); break;\
+    case '.': createToken(PERIOD); break;\
+    case '+': createToken(PLUS); break;\
+    case '#': createToken(POUND); break;\
+    case ']': decrementScope(); createToken(RIGHTBRACE); break;\
+    case '}': decrementScope(); createToken(RIGHTBRACKET); break;\
+    case ')': decrementScope(); createToken(RIGHTPAREN); break;\
+    case ';': createToken(SEMICOLON); break;\
+    case '\'': createToken(TICK); break;\
+    case '~': createToken(TILDE); break;\
+    case 11896034: createToken(ALEPH); break;\
+    case 8948194: createToken(APPROX); break;\
+    case 11897058: createToken(BECAUSE); break;\
+    case 11961570: createToken(BETH); break;\
+    case 11110626: createToken(CAP); break;\
+    case 8489186: createToken(COMPLEMENT); break;\
+    case 10979554: createToken(CONJUNCTION); break;\
+    case 11438306: createToken(CONTOURINTEGRAL); break;\
+    case 11176162: createToken(CUP); break;\
+    case 10518754: createToken(DAGGER); break;\
+    case 9734626: createToken(DEFEQUALS); break;\
+    case 45250: createToken(DEGREE); break;\
+    case 11045090: createToken(DISJUNCTION); break;\
+    case 47043: createToken(DIVIDE); break;\
+    case 8752098: createToken(DOTPRODUCT); break;\
+    case 9863394: createToken(DOUBLEBAR); break;\
+    case 10584290: createToken(DOUBLEDAGGER); break;\
+    case 12353762: createToken(DOUBLEEXCLAM); break;\
+    case 11241954: createToken(DOUBLEGREATER); break;\
+    case 11176418: createToken(DOUBLELESS); break;\
+    case 3113524720: createToken(DOUBLESTRUCK_B); break;\
+    case 8553698: createToken(DOUBLESTRUCK_C); break;\
+    case 8816098: createToken(DOUBLESTRUCK_D); break;\
+    case 9274594: createToken(DOUBLESTRUCK_H); break;\
+    case 8947170: createToken(DOUBLESTRUCK_I); break;\
+    case 2174066160: createToken(DOUBLESTRUCK_J); break;\
+    case 9798882: createToken(DOUBLESTRUCK_N); break;\
+    case 10061026: createToken(DOUBLESTRUCK_P); break;\
+    case 10126562: createToken(DOUBLESTRUCK_Q); break;\
+    case 10323170: createToken(DOUBLESTRUCK_R); break;\
+    case 2325061104: createToken(DOUBLESTRUCK_S); break;\
+    case 2392169968: createToken(DOUBLESTRUCK_W); break;\
+    case 10781922: createToken(DOUBLESTRUCK_Z); break;\
+    case 8751330: createToken(EMPTYSET); break;\
+    case 10586594: createToken(EQUIVALENT); break;\
+    case 11305698: createToken(EURO); break;\
+    case 8620258: createToken(EXISTS); break;\
+    case 8423650: createToken(FORALL); break;\
+    case 10848738: createToken(GREATEREQUAL); break;\
+    case 9143522: createToken(HAMILTONIAN); break;\
+    case 8947938: createToken(MEMBER); break;\
+    case 10389730: createToken(INFTY); break;\
+    case 11241698: createToken(INTEGRAL); break;\
+    case 9602274: createToken(LAPLACE); break;\
+    case 11050978: incrementScope(); createToken(LEFTANGLE); break;\
+    case 9471714: createToken(LEFTARROW); break;\
+    case 8948962: incrementScope(); createToken(LEFTCEIL); break;\
+    case 11182050: incrementScope(); createToken(LEFTDOUBLEANGLE); break;\
+    case 10919906: incrementScope(); createToken(LEFTDOUBLEBRACE); break;\
+    case 9080034: incrementScope(); createToken(LEFTFLOOR); break;\
+    case 10783202: createToken(LESSEQUAL); break;\
+    case 10913506: createToken(MAPSTO); break;\
+    case 9668834: createToken(MINUSPLUS); break;\
+    case 8882402: createToken(NABLA); break;\
+    case 9144546: createToken(NI); break;\
+    case 44226: createToken(NOT); break;\
+    case 9013730: createToken(NOTAPPROX); break;\
+    case 10521058: createToken(NOTEQUAL); break;\
+    case 8685794: createToken(NOTEXIST); break;\
+    case 11504098: createToken(NOTGREATER); break;\
+    case 9013474: createToken(NOTIN); break;\
+    case 11438562: createToken(NOTLESS); break;\
+    case 9210082: createToken(NOTNI); break;\
+    case 8686306: createToken(NOTSUBSET); break;\
+    case 8948450: createToken(NOTSUBSETEQ); break;\
+    case 9996514: createToken(OCIRC); break;\
+    case 8431842: createToken(ODOT); break;\
+    case 9931490: createToken(OUTERPRODUCT); break;\
+    case 8554722: createToken(PARTIAL); break;\
+    case 10848994: createToken(PERP); break;\
+    case 9340130: createToken(PLANCKCONST); break;\
+    case 45506: createToken(PLUSMINUS); break;\
+    case 41922: createToken(POUNDSTERLING); break;\
+    case 12224994: createToken(PREC); break;\
+    case 10324194: createToken(PROPORTIONAL); break;\
+    case 10524386: createToken(QED); break;\
+    case 11116514: decrementScope(); createToken(RIGHTANGLE); break;\
+    case 9602786: createToken(RIGHTARROW); break;\
+    case 9603042: createToken(RIGHTARROWDOUBLE); break;\
+    case 9014498: decrementScope(); createToken(RIGHTCEIL); break;\
+    case 11247586: decrementScope(); createToken(RIGHTDOUBLEANGLE); break;\
+    case 10985442: decrementScope(); createToken(RIGHTDOUBLEBRACE); break;\
+    case 9145570: decrementScope(); createToken(RIGHTFLOOR); break;\
+    case 9274082: createToken(SUBSCRIPTLEFTPAREN); break;\
+    case 9143010: createToken(SUBSCRIPTMINUS); break;\
+    case 9077474: createToken(SUBSCRIPTPLUS); break;\
+    case 9339618: createToken(SUBSCRIPTRIGHTPAREN); break;\
+    case 8555234: createToken(SUBSET); break;\
+    case 8817378: createToken(SUBSETEQ); break;\
+    case 12290530: createToken(SUCC); break;\
+    case 12419554: createToken(SUPERSCRIPTLEFTPAREN); break;\
+    case 12288482: createToken(SUPERSCRIPTMINUS); break;\
+    case 12222946: createToken(SUPERSCRIPTPLUS); break;\
+    case 12485090: createToken(SUPERSCRIPTRIGHTPAREN); break;\
+    case 12431842: createToken(SUPERSCRIPTVEE); break;\
+    case 12236513: createToken(SUPERSCRIPTWEDGE); break;\
+    case 10911970: createToken(SUSPENSIONPOINT); break;\
+    case 11831522: createToken(THEREFORE); break;\
+    case 10987490: createToken(THERMOD); break;\
+    case 38851: createToken(TIMES); break;\
+    case 10783458: createToken(TRANSPOSE); break;\
+    case 10062818: createToken(TRIPLEGREATER); break;\
+    case 9997282: createToken(TRIPLELESS); break;\
+    case '0': scanNumber(); break;\
+    case '1': scanNumber(); break;\
+    case '2': scanNumber(); break;\
+    case '3': scanNumber(); break;\
+    case '4': scanNumber(); break;\
+    case '5': scanNumber(); break;\
+    case '6': scanNumber(); break;\
+    case '7': scanNumber(); break;\
+    case '8': scanNumber(); break;\
+    case '9': scanNumber(); break;\
+    case 'a': scanIdentifier(); break;\
+    case 'b': scanIdentifier(); break;\
+    case 'c': scanIdentifier(); break;\
+    case 'd': scanIdentifier(); break;\
+    case 'e': scanIdentifier(); break;\
+    case 'f': scanIdentifier(); break;\
+    case 'g': scanIdentifier(); break;\
+    case 'h': scanIdentifier(); break;\
+    case 'i': scanIdentifier(); break;\
+    case 'j': scanIdentifier(); break;\
+    case 'k': scanIdentifier(); break;\
+    case 'l': scanIdentifier(); break;\
+    case 'm': scanIdentifier(); break;\
+    case 'n': scanIdentifier(); break;\
+    case 'o': scanIdentifier(); break;\
+    case 'p': scanIdentifier(); break;\
+    case 'q': scanIdentifier(); break;\
+    case 'r': scanIdentifier(); break;\
+    case 's': scanIdentifier(); break;\
+    case 't': scanIdentifier(); break;\
+    case 'u': scanIdentifier(); break;\
+    case 'v': scanIdentifier(); break;\
+    case 'w': scanIdentifier(); break;\
+    case 'x': scanIdentifier(); break;\
+    case 'y': scanIdentifier(); break;\
+    case 'z': scanIdentifier(); break;\
+    case 'A': scanIdentifier(); break;\
+    case 'B': scanIdentifier(); break;\
+    case 'C': scanIdentifier(); break;\
+    case 'D': scanIdentifier(); break;\
+    case 'E': scanIdentifier(); break;\
+    case 'F': scanIdentifier(); break;\
+    case 'G': scanIdentifier(); break;\
+    case 'H': scanIdentifier(); break;\
+    case 'I': scanIdentifier(); break;\
+    case 'J': scanIdentifier(); break;\
+    case 'K': scanIdentifier(); break;\
+    case 'L': scanIdentifier(); break;\
+    case 'M': scanIdentifier(); break;\
+    case 'N': scanIdentifier(); break;\
+    case 'O': scanIdentifier(); break;\
+    case 'P': scanIdentifier(); break;\
+    case 'Q': scanIdentifier(); break;\
+    case 'R': scanIdentifier(); break;\
+    case 'S': scanIdentifier(); break;\
+    case 'T': scanIdentifier(); break;\
+    case 'U': scanIdentifier(); break;\
+    case 'V': scanIdentifier(); break;\
+    case 'W': scanIdentifier(); break;\
+    case 'X': scanIdentifier(); break;\
+    case 'Y': scanIdentifier(); break;\
+    case 'Z': scanIdentifier(); break;\
+    case '_': scanIdentifier(); break;\
+    case 45518: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 45774: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 46030: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 46286: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 46542: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 46798: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 47054: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 47310: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 47566: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 47822: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 48078: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 48334: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 48590: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 48846: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 49102: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 32975: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 33231: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 33487: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 33743: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 33999: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 34255: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 34511: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 34767: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 35023: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 35279: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 37326: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 37582: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 37838: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 38094: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 38350: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 38606: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 38862: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 39118: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 39374: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 39630: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 39886: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 40142: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 40398: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 40654: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 40910: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 41166: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 41422: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 41678: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 41934: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 42190: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 42446: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 42702: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 42958: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 43214: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case 43470: controller->formatBasicIdentifier(); createToken(IDENTIFIER); break;\
+    case (1 << 7) | MATRIX: scanConstruct(TOKEN_MATRIX); break;\
+    case (1 << 7) | CASES: scanConstruct(TOKEN_CASES); break;\
+    case (1 << 7) | DUALSCRIPT: scanConstruct(TOKEN_DUALSCRIPT); break;\
+    case (1 << 7) | FRACTION: scanConstruct(TOKEN_FRACTION); break;\
+    case (1 << 7) | BINOMIAL: scanConstruct(TOKEN_BINOMIAL); break;\
+    case (1 << 7) | LIMIT: scanConstruct(TOKEN_LIMIT); break;\
+    case (1 << 7) | NRT: scanConstruct(TOKEN_NRT); break;\
+    case (1 << 7) | BIGSUM2: scanConstruct(TOKEN_BIGSUM2); break;\
+    case (1 << 7) | BIGPROD2: scanConstruct(TOKEN_BIGPROD2); break;\
+    case (1 << 7) | BIGCOPROD2: scanConstruct(TOKEN_BIGCOPROD2); break;\
+    case (1 << 7) | BIGUNION2: scanConstruct(TOKEN_BIGUNION2); break;\
+    case (1 << 7) | BIGINTERSECTION2: scanConstruct(TOKEN_BIGINTERSECTION2); break;\
+    case (1 << 7) | INTEGRAL2: scanConstruct(TOKEN_INTEGRAL2); break;\
+    case (1 << 7) | INTEGRALCONV2: scanConstruct(TOKEN_INTEGRALCONV2); break;\
+    case (1 << 7) | SUPERSCRIPT: scanConstruct(TOKEN_SUPERSCRIPT); break;\
+    case (1 << 7) | SUBSCRIPT: scanConstruct(TOKEN_SUBSCRIPT); break;\
+    case (1 << 7) | MAX: scanConstruct(TOKEN_MAX); break;\
+    case (1 << 7) | MIN: scanConstruct(TOKEN_MIN); break;\
+    case (1 << 7) | INF: scanConstruct(TOKEN_INF); break;\
+    case (1 << 7) | SUP: scanConstruct(TOKEN_SUP); break;\
+    case (1 << 7) | SQRT: scanConstruct(TOKEN_SQRT); break;\
+    case (1 << 7) | BIGSUM1: scanConstruct(TOKEN_BIGSUM1); break;\
+    case (1 << 7) | BIGPROD1: scanConstruct(TOKEN_BIGPROD1); break;\
+    case (1 << 7) | BIGCOPROD1: scanConstruct(TOKEN_BIGCOPROD1); break;\
+    case (1 << 7) | BIGUNION1: scanConstruct(TOKEN_BIGUNION1); break;\
+    case (1 << 7) | BIGINTERSECTION1: scanConstruct(TOKEN_BIGINTERSECTION1); break;\
+    case (1 << 7) | INTEGRAL1: scanConstruct(TOKEN_INTEGRAL1); break;\
+    case (1 << 7) | DOUBLEINTEGRAL1: scanConstruct(TOKEN_DOUBLEINTEGRAL1); break;\
+    case (1 << 7) | TRIPLEINTEGRAL1: scanConstruct(TOKEN_TRIPLEINTEGRAL1); break;\
+    case (1 << 7) | INTEGRALCONV1: scanConstruct(TOKEN_INTEGRALCONV1); break;\
+    case (1 << 7) | DOUBLEINTEGRALCONV1: scanConstruct(TOKEN_DOUBLEINTEGRALCONV1); break;\
+    case (1 << 7) | TRIPLEINTEGRALCONV1: scanConstruct(TOKEN_TRIPLEINTEGRALCONV1); break;\
+    case (1 << 7) | BIGSUM0: scanConstruct(TOKEN_BIGSUM0); break;\
+    case (1 << 7) | BIGPROD0: scanConstruct(TOKEN_BIGPROD0); break;\
+    case (1 << 7) | BIGCOPROD0: scanConstruct(TOKEN_BIGCOPROD0); break;\
+    case (1 << 7) | BIGUNION0: scanConstruct(TOKEN_BIGUNION0); break;\
+    case (1 << 7) | BIGINTERSECTION0: scanConstruct(TOKEN_BIGINTERSECTION0); break;\
+    case (1 << 7) | INTEGRAL0: scanConstruct(TOKEN_INTEGRAL0); break;\
+    case (1 << 7) | DOUBLEINTEGRAL0: scanConstruct(TOKEN_DOUBLEINTEGRAL0); break;\
+    case (1 << 7) | TRIPLEINTEGRAL0: scanConstruct(TOKEN_TRIPLEINTEGRAL0); break;\
+    case (1 << 7) | INTEGRALCONV0: scanConstruct(TOKEN_INTEGRALCONV0); break;\
+    case (1 << 7) | DOUBLEINTEGRALCONV0: scanConstruct(TOKEN_DOUBLEINTEGRALCONV0); break;\
+    case (1 << 7) | TRIPLEINTEGRALCONV0: scanConstruct(TOKEN_TRIPLEINTEGRALCONV0); break;\
+    case (1 << 7) | MARKERLINK: scanConstruct(TOKEN_MARKERLINK); break;\
+    case (1 << 7) | ACCENTHAT: scanConstruct(TOKEN_ACCENTHAT); break;\
+    case (1 << 7) | ACCENTTILDE: scanConstruct(TOKEN_ACCENTTILDE); break;\
+    case (1 << 7) | ACCENTBAR: scanConstruct(TOKEN_ACCENTBAR); break;\
+    case (1 << 7) | ACCENTBREVE: scanConstruct(TOKEN_ACCENTBREVE); break;\
+    case (1 << 7) | ACCENTDOT: scanConstruct(TOKEN_ACCENTDOT); break;\
+    case (1 << 7) | ACCENTDDOT: scanConstruct(TOKEN_ACCENTDDOT); break;\
+    case (1 << 7) | ACCENTDDDOT: scanConstruct(TOKEN_ACCENTDDDOT); break;\
+    case (1 << 7) | SETTINGS: scanConstruct(TOKEN_SETTINGS); break;\
+    case '/': forwardSlash(); break;
+
+#define FORSCAPE_IMPLICIT_MULT_TOKENS \
+    case CONTOURINTEGRAL:\
+    case IDENTIFIER:\
+    case INTEGRAL:\
+    case LEFTANGLE:\
+    case LEFTBRACE:\
+    case LEFTCEIL:\
+    case LEFTFLOOR:\
+    case NABLA:\
+    case PLANCKCONST:\
+    case SGN:\
+    case LENGTH:\
+    case SIN:\
+    case COS:\
+    case TAN:\
+    case CSC:\
+    case SEC:\
+    case COT:\
+    case ARCSIN:\
+    case ARCCOS:\
+    case ARCTAN:\
+    case ARCTAN2:\
+    case ARCCSC:\
+    case ARCSEC:\
+    case ARCCOT:\
+    case SINH:\
+    case COSH:\
+    case TANH:\
+    case ARCSINH:\
+    case ARCCOSH:\
+    case ARCTANH:\
+    case CSCH:\
+    case SECH:\
+    case COTH:\
+    case ARCCSCH:\
+    case ARCSECH:\
+    case ARCCOTH:\
+    case EXP:\
+    case NATURALLOG:\
+    case LOG:\
+    case ERRORFUNCTION:\
+    case COMPERRFUNC:\
+    case GRAVITY:\
+    case ROWS:\
+    case COLS:\
+    case SPECIALORTHOGONAL:\
+    case TOKEN_MATRIX:\
+    case TOKEN_CASES:\
+    case TOKEN_DUALSCRIPT:\
+    case TOKEN_FRACTION:\
+    case TOKEN_BINOMIAL:\
+    case TOKEN_LIMIT:\
+    case TOKEN_NRT:\
+    case TOKEN_BIGSUM2:\
+    case TOKEN_BIGPROD2:\
+    case TOKEN_BIGCOPROD2:\
+    case TOKEN_BIGUNION2:\
+    case TOKEN_BIGINTERSECTION2:\
+    case TOKEN_INTEGRAL2:\
+    case TOKEN_INTEGRALCONV2:\
+    case TOKEN_SUPERSCRIPT:\
+    case TOKEN_SUBSCRIPT:\
+    case TOKEN_SQRT:\
+    case TOKEN_BIGSUM1:\
+    case TOKEN_BIGPROD1:\
+    case TOKEN_BIGCOPROD1:\
+    case TOKEN_BIGUNION1:\
+    case TOKEN_BIGINTERSECTION1:\
+    case TOKEN_INTEGRAL1:\
+    case TOKEN_DOUBLEINTEGRAL1:\
+    case TOKEN_TRIPLEINTEGRAL1:\
+    case TOKEN_INTEGRALCONV1:\
+    case TOKEN_DOUBLEINTEGRALCONV1:\
+    case TOKEN_TRIPLEINTEGRALCONV1:\
+    case TOKEN_BIGSUM0:\
+    case TOKEN_BIGPROD0:\
+    case TOKEN_BIGCOPROD0:\
+    case TOKEN_BIGUNION0:\
+    case TOKEN_BIGINTERSECTION0:\
+    case TOKEN_INTEGRAL0:\
+    case TOKEN_DOUBLEINTEGRAL0:\
+    case TOKEN_TRIPLEINTEGRAL0:\
+    case TOKEN_INTEGRALCONV0:\
+    case TOKEN_DOUBLEINTEGRALCONV0:\
+    case TOKEN_TRIPLEINTEGRALCONV0:\
+    case TOKEN_ACCENTHAT:
+
+constexpr size_t FORSCAPE_KEYWORD_MAP_SIZE = 68;
+
+#define FORSCAPE_KEYWORD_MAP { \
+    {{2, 7, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 2, 1, 1, 0, 11, 0, 2, 1, 0, 12, 3, 0, 0, 0, 0, 3, 2, 8, 0, 18, 12, 0, 0, 13, 0, 0, 0, 0, 10, 0, 0, 0, 18, 0, 17, 17, 1, 0, 5, 2, 7, 0, 18, 0, 0, 9, 0, 26, 0, 38, 0, 0, 0}}, \
+    {{ \
+        {"namespace", NAMESPACE}, \
+        {"continue", CONTINUE}, \
+        {"arccsc", ARCCSC}, \
+        {"log", LOG}, \
+        {"true", TRUELITERAL}, \
+        {"arccos", ARCCOS}, \
+        {"while", WHILE}, \
+        {"SO", SPECIALORTHOGONAL}, \
+        {"coth", COTH}, \
+        {"arctan", ARCTAN}, \
+        {"struct", STRUCT}, \
+        {"undefined", UNDEFINED}, \
+        {"sec", SEC}, \
+        {"cot", COT}, \
+        {"tanh", TANH}, \
+        {"arcsin", ARCSIN}, \
+        {"else", ELSE}, \
+        {"operator", OPERATOR}, \
+        {"as", AS}, \
+        {"case", CASE}, \
+        {"arccsch", ARCCSCH}, \
+        {"alg", ALGORITHM}, \
+        {"arccoth", ARCCOTH}, \
+        {"if", IF}, \
+        {"arccosh", ARCCOSH}, \
+        {"sin", SIN}, \
+        {"arcsinh", ARCSINH}, \
+        {"arcsech", ARCSECH}, \
+        {"ln", NATURALLOG}, \
+        {"arccot", ARCCOT}, \
+        {"cosh", COSH}, \
+        {"g", GRAVITY}, \
+        {"tan", TAN}, \
+        {"private", PRIVATE}, \
+        {"cols", COLS}, \
+        {"from", FROM}, \
+        {"switch", SWITCH}, \
+        {"erfc", COMPERRFUNC}, \
+        {"exp", EXP}, \
+        {"unknown", UNKNOWN}, \
+        {"len", LENGTH}, \
+        {"default", DEFAULT}, \
+        {"erf", ERRORFUNCTION}, \
+        {"return", RETURN}, \
+        {"typedef", TYPEDEF}, \
+        {"csch", CSCH}, \
+        {"class", CLASS}, \
+        {"public", PUBLIC}, \
+        {"break", BREAK}, \
+        {"plot", PLOT}, \
+        {"arctan2", ARCTAN2}, \
+        {"csc", CSC}, \
+        {"static", STATIC}, \
+        {"enum", ENUM}, \
+        {"sgn", SGN}, \
+        {"for", FOR}, \
+        {"arctanh", ARCTANH}, \
+        {"where", WHERE}, \
+        {"assert", ASSERT}, \
+        {"sech", SECH}, \
+        {"sinh", SINH}, \
+        {"arcsec", ARCSEC}, \
+        {"rows", ROWS}, \
+        {"print", PRINT}, \
+        {"import", IMPORT}, \
+        {"cos", COS}, \
+        {"static_assert", STATICASSERT}, \
+        {"false", FALSELITERAL}, \
+    }} \
+}
+
+} // namespace Code
+
+} // namespace Forscape
+
+#endif // FORSCAPE_CODE_TOKENTYPE_H
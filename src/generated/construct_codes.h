@@ -0,0 +1,293 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_CONSTRUCT_CODES_H
+#define FORSCAPE_CONSTRUCT_CODES_H
+
+#include <cinttypes>
+#include <string_view>
+
+namespace Forscape {
+
+#define CONSTRUCT_STR "⁜"
+#define OPEN_STR "⏴"
+#define CLOSE_STR "⏵"
+inline constexpr char CONSTRUCT_STRVIEW[] = CONSTRUCT_STR;
+inline constexpr auto CON_0 = CONSTRUCT_STRVIEW[0];
+inline constexpr auto CON_1 = CONSTRUCT_STRVIEW[1];
+inline constexpr auto CON_2 = CONSTRUCT_STRVIEW[2];
+inline constexpr char OPEN_STRVIEW[] = OPEN_STR;
+inline constexpr auto OPEN_0 = OPEN_STRVIEW[0];
+inline constexpr auto OPEN_1 = OPEN_STRVIEW[1];
+inline constexpr auto OPEN_2 = OPEN_STRVIEW[2];
+inline constexpr char CLOSE_STRVIEW[] = CLOSE_STR;
+inline constexpr auto CLOSE_0 = CLOSE_STRVIEW[0];
+inline constexpr auto CLOSE_1 = CLOSE_STRVIEW[1];
+inline constexpr auto CLOSE_2 = CLOSE_STRVIEW[2];
+
+#define DECLARE_CONSTRUCT_CSTRINGS\
+    inline constexpr char DUALSCRIPT_CSTRING[] = "^_";\
+    inline constexpr char FRACTION_CSTRING[] = "f";\
+    inline constexpr char BINOMIAL_CSTRING[] = "binom";\
+    inline constexpr char LIMIT_CSTRING[] = "lim";\
+    inline constexpr char NRT_CSTRING[] = "nrt";\
+    inline constexpr char BIGSUM2_CSTRING[] = "sum2";\
+    inline constexpr char BIGPROD2_CSTRING[] = "prod2";\
+    inline constexpr char BIGCOPROD2_CSTRING[] = "coprod2";\
+    inline constexpr char BIGUNION2_CSTRING[] = "union2";\
+    inline constexpr char BIGINTERSECTION2_CSTRING[] = "intersection2";\
+    inline constexpr char INTEGRAL2_CSTRING[] = "int2";\
+    inline constexpr char INTEGRALCONV2_CSTRING[] = "oint2";\
+    inline constexpr char SUPERSCRIPT_CSTRING[] = "^";\
+    inline constexpr char SUBSCRIPT_CSTRING[] = "_";\
+    inline constexpr char MAX_CSTRING[] = "max";\
+    inline constexpr char MIN_CSTRING[] = "min";\
+    inline constexpr char INF_CSTRING[] = "inf";\
+    inline constexpr char SUP_CSTRING[] = "sup";\
+    inline constexpr char SQRT_CSTRING[] = "sqrt";\
+    inline constexpr char BIGSUM1_CSTRING[] = "sum1";\
+    inline constexpr char BIGPROD1_CSTRING[] = "prod1";\
+    inline constexpr char BIGCOPROD1_CSTRING[] = "coprod1";\
+    inline constexpr char BIGUNION1_CSTRING[] = "union1";\
+    inline constexpr char BIGINTERSECTION1_CSTRING[] = "intersection1";\
+    inline constexpr char INTEGRAL1_CSTRING[] = "int1";\
+    inline constexpr char DOUBLEINTEGRAL1_CSTRING[] = "iint1";\
+    inline constexpr char TRIPLEINTEGRAL1_CSTRING[] = "iiint1";\
+    inline constexpr char INTEGRALCONV1_CSTRING[] = "oint1";\
+    inline constexpr char DOUBLEINTEGRALCONV1_CSTRING[] = "oiint1";\
+    inline constexpr char TRIPLEINTEGRALCONV1_CSTRING[] = "oiiint1";\
+    inline constexpr char BIGSUM0_CSTRING[] = "sum0";\
+    inline constexpr char BIGPROD0_CSTRING[] = "prod0";\
+    inline constexpr char BIGCOPROD0_CSTRING[] = "coprod0";\
+    inline constexpr char BIGUNION0_CSTRING[] = "union0";\
+    inline constexpr char BIGINTERSECTION0_CSTRING[] = "intersection0";\
+    inline constexpr char INTEGRAL0_CSTRING[] = "int0";\
+    inline constexpr char DOUBLEINTEGRAL0_CSTRING[] = "iint0";\
+    inline constexpr char TRIPLEINTEGRAL0_CSTRING[] = "iiint0";\
+    inline constexpr char INTEGRALCONV0_CSTRING[] = "oint0";\
+    inline constexpr char DOUBLEINTEGRALCONV0_CSTRING[] = "oiint0";\
+    inline constexpr char TRIPLEINTEGRALCONV0_CSTRING[] = "oiiint0";\
+    inline constexpr char ACCENTHAT_CSTRING[] = "hat";\
+    inline constexpr char ACCENTTILDE_CSTRING[] = "tilde";\
+    inline constexpr char ACCENTBAR_CSTRING[] = "bar";\
+    inline constexpr char ACCENTBREVE_CSTRING[] = "breve";\
+    inline constexpr char ACCENTDOT_CSTRING[] = "dot";\
+    inline constexpr char ACCENTDDOT_CSTRING[] = "ddot";\
+    inline constexpr char ACCENTDDDOT_CSTRING[] = "dddot";\
+    inline constexpr char SETTINGS_CSTRING[] = "settings";
+
+inline constexpr uint8_t encodingHash(std::string_view keyword) noexcept {
+    const uint8_t sze = static_cast<uint8_t>(keyword.size());
+    const uint8_t c0 = keyword[0];
+    const uint8_t cN = keyword[sze-1];
+    return (sze << 3) ^ (c0 << 4) ^ cN;
+}
+
+inline constexpr char MATRIX = 1;
+#define MATRIX_STR ""
+inline constexpr char CASES = 2;
+#define CASES_STR ""
+inline constexpr char DUALSCRIPT = 3;
+#define DUALSCRIPT_STR "^_"
+inline constexpr char FRACTION = 4;
+#define FRACTION_STR "f"
+inline constexpr char BINOMIAL = 5;
+#define BINOMIAL_STR "binom"
+inline constexpr char LIMIT = 6;
+#define LIMIT_STR "lim"
+inline constexpr char NRT = 7;
+#define NRT_STR "nrt"
+inline constexpr char BIGSUM2 = 8;
+#define BIGSUM2_STR "sum2"
+inline constexpr char BIGPROD2 = 9;
+#define BIGPROD2_STR "prod2"
+inline constexpr char BIGCOPROD2 = 10;
+#define BIGCOPROD2_STR "coprod2"
+inline constexpr char BIGUNION2 = 11;
+#define BIGUNION2_STR "union2"
+inline constexpr char BIGINTERSECTION2 = 12;
+#define BIGINTERSECTION2_STR "intersection2"
+inline constexpr char INTEGRAL2 = 13;
+#define INTEGRAL2_STR "int2"
+inline constexpr char INTEGRALCONV2 = 14;
+#define INTEGRALCONV2_STR "oint2"
+inline constexpr char SUPERSCRIPT = 15;
+#define SUPERSCRIPT_STR "^"
+inline constexpr char SUBSCRIPT = 16;
+#define SUBSCRIPT_STR "_"
+inline constexpr char MAX = 17;
+#define MAX_STR "max"
+inline constexpr char MIN = 18;
+#define MIN_STR "min"
+inline constexpr char INF = 19;
+#define INF_STR "inf"
+inline constexpr char SUP = 20;
+#define SUP_STR "sup"
+inline constexpr char SQRT = 21;
+#define SQRT_STR "sqrt"
+inline constexpr char BIGSUM1 = 22;
+#define BIGSUM1_STR "sum1"
+inline constexpr char BIGPROD1 = 23;
+#define BIGPROD1_STR "prod1"
+inline constexpr char BIGCOPROD1 = 24;
+#define BIGCOPROD1_STR "coprod1"
+inline constexpr char BIGUNION1 = 25;
+#define BIGUNION1_STR "union1"
+inline constexpr char BIGINTERSECTION1 = 26;
+#define BIGINTERSECTION1_STR "intersection1"
+inline constexpr char INTEGRAL1 = 27;
+#define INTEGRAL1_STR "int1"
+inline constexpr char DOUBLEINTEGRAL1 = 28;
+#define DOUBLEINTEGRAL1_STR "iint1"
+inline constexpr char TRIPLEINTEGRAL1 = 29;
+#define TRIPLEINTEGRAL1_STR "iiint1"
+inline constexpr char INTEGRALCONV1 = 30;
+#define INTEGRALCONV1_STR "oint1"
+inline constexpr char DOUBLEINTEGRALCONV1 = 31;
+#define DOUBLEINTEGRALCONV1_STR "oiint1"
+inline constexpr char TRIPLEINTEGRALCONV1 = 32;
+#define TRIPLEINTEGRALCONV1_STR "oiiint1"
+inline constexpr char BIGSUM0 = 33;
+#define BIGSUM0_STR "sum0"
+inline constexpr char BIGPROD0 = 34;
+#define BIGPROD0_STR "prod0"
+inline constexpr char BIGCOPROD0 = 35;
+#define BIGCOPROD0_STR "coprod0"
+inline constexpr char BIGUNION0 = 36;
+#define BIGUNION0_STR "union0"
+inline constexpr char BIGINTERSECTION0 = 37;
+#define BIGINTERSECTION0_STR "intersection0"
+inline constexpr char INTEGRAL0 = 38;
+#define INTEGRAL0_STR "int0"
+inline constexpr char DOUBLEINTEGRAL0 = 39;
+#define DOUBLEINTEGRAL0_STR "iint0"
+inline constexpr char TRIPLEINTEGRAL0 = 40;
+#define TRIPLEINTEGRAL0_STR "iiint0"
+inline constexpr char INTEGRALCONV0 = 41;
+#define INTEGRALCONV0_STR "oint0"
+inline constexpr char DOUBLEINTEGRALCONV0 = 42;
+#define DOUBLEINTEGRALCONV0_STR "oiint0"
+inline constexpr char TRIPLEINTEGRALCONV0 = 43;
+#define TRIPLEINTEGRALCONV0_STR "oiiint0"
+inline constexpr char MARKERLINK = 44;
+#define MARKERLINK_STR ""
+inline constexpr char ACCENTHAT = 45;
+#define ACCENTHAT_STR "hat"
+inline constexpr char ACCENTTILDE = 46;
+#define ACCENTTILDE_STR "tilde"
+inline constexpr char ACCENTBAR = 47;
+#define ACCENTBAR_STR "bar"
+inline constexpr char ACCENTBREVE = 48;
+#define ACCENTBREVE_STR "breve"
+inline constexpr char ACCENTDOT = 49;
+#define ACCENTDOT_STR "dot"
+inline constexpr char ACCENTDDOT = 50;
+#define ACCENTDDOT_STR "ddot"
+inline constexpr char ACCENTDDDOT = 51;
+#define ACCENTDDDOT_STR "dddot"
+inline constexpr char SETTINGS = 52;
+#define SETTINGS_STR "settings"
+
+#define FORSCAPE_SERIAL_NULLARY_CASES \
+    case encodingHash("sum0"): if(keyword != "sum0") return false; break; \
+    case encodingHash("prod0"): if(keyword != "prod0") return false; break; \
+    case encodingHash("coprod0"): if(keyword != "coprod0") return false; break; \
+    case encodingHash("union0"): if(keyword != "union0") return false; break; \
+    case encodingHash("intersection0"): if(keyword != "intersection0") return false; break; \
+    case encodingHash("int0"): if(keyword != "int0") return false; break; \
+    case encodingHash("iint0"): if(keyword != "iint0") return false; break; \
+    case encodingHash("iiint0"): if(keyword != "iiint0") return false; break; \
+    case encodingHash("oint0"): if(keyword != "oint0") return false; break; \
+    case encodingHash("oiint0"): if(keyword != "oiint0") return false; break; \
+    case encodingHash("oiiint0"): if(keyword != "oiiint0") return false; break;
+#define FORSCAPE_SERIAL_UNARY_CASES \
+    case encodingHash("^"): if(keyword != "^") return false; depth += 1; break; \
+    case encodingHash("_"): if(keyword != "_") return false; depth += 1; break; \
+    case encodingHash("max"): if(keyword != "max") return false; depth += 1; break; \
+    case encodingHash("min"): if(keyword != "min") return false; depth += 1; break; \
+    case encodingHash("inf"): if(keyword != "inf") return false; depth += 1; break; \
+    case encodingHash("sup"): if(keyword != "sup") return false; depth += 1; break; \
+    case encodingHash("sqrt"): if(keyword != "sqrt") return false; depth += 1; break; \
+    case encodingHash("sum1"): if(keyword != "sum1") return false; depth += 1; break; \
+    case encodingHash("prod1"): if(keyword != "prod1") return false; depth += 1; break; \
+    case encodingHash("coprod1"): if(keyword != "coprod1") return false; depth += 1; break; \
+    case encodingHash("union1"): if(keyword != "union1") return false; depth += 1; break; \
+    case encodingHash("intersection1"): if(keyword != "intersection1") return false; depth += 1; break; \
+    case encodingHash("int1"): if(keyword != "int1") return false; depth += 1; break; \
+    case encodingHash("iint1"): if(keyword != "iint1") return false; depth += 1; break; \
+    case encodingHash("iiint1"): if(keyword != "iiint1") return false; depth += 1; break; \
+    case encodingHash("oint1"): if(keyword != "oint1") return false; depth += 1; break; \
+    case encodingHash("oiint1"): if(keyword != "oiint1") return false; depth += 1; break; \
+    case encodingHash("oiiint1"): if(keyword != "oiiint1") return false; depth += 1; break; \
+    case encodingHash("hat"): if(keyword != "hat") return false; depth += 1; break; \
+    case encodingHash("tilde"): if(keyword != "tilde") return false; depth += 1; break; \
+    case encodingHash("bar"): if(keyword != "bar") return false; depth += 1; break; \
+    case encodingHash("breve"): if(keyword != "breve") return false; depth += 1; break; \
+    case encodingHash("dot"): if(keyword != "dot") return false; depth += 1; break; \
+    case encodingHash("ddot"): if(keyword != "ddot") return false; depth += 1; break; \
+    case encodingHash("dddot"): if(keyword != "dddot") return false; depth += 1; break;
+#define FORSCAPE_SERIAL_BINARY_CASES \
+    case encodingHash("^_"): if(keyword != "^_") return false; depth += 2; break; \
+    case encodingHash("f"): if(keyword != "f") return false; depth += 2; break; \
+    case encodingHash("binom"): if(keyword != "binom") return false; depth += 2; break; \
+    case encodingHash("lim"): if(keyword != "lim") return false; depth += 2; break; \
+    case encodingHash("nrt"): if(keyword != "nrt") return false; depth += 2; break; \
+    case encodingHash("sum2"): if(keyword != "sum2") return false; depth += 2; break; \
+    case encodingHash("prod2"): if(keyword != "prod2") return false; depth += 2; break; \
+    case encodingHash("coprod2"): if(keyword != "coprod2") return false; depth += 2; break; \
+    case encodingHash("union2"): if(keyword != "union2") return false; depth += 2; break; \
+    case encodingHash("intersection2"): if(keyword != "intersection2") return false; depth += 2; break; \
+    case encodingHash("int2"): if(keyword != "int2") return false; depth += 2; break; \
+    case encodingHash("oint2"): if(keyword != "oint2") return false; depth += 2; break;
+
+#define FORSCAPE_TYPESET_PARSER_CASES \
+    case encodingHash("^_"): assert(keyword == "^_"); TypesetSetupConstruct(Dualscript,); \
+    case encodingHash("f"): assert(keyword == "f"); TypesetSetupConstruct(Fraction,); \
+    case encodingHash("binom"): assert(keyword == "binom"); TypesetSetupConstruct(Binomial,); \
+    case encodingHash("lim"): assert(keyword == "lim"); TypesetSetupConstruct(Limit,); \
+    case encodingHash("nrt"): assert(keyword == "nrt"); TypesetSetupConstruct(Nrt,); \
+    case encodingHash("sum2"): assert(keyword == "sum2"); TypesetSetupConstruct(BigSum2,); \
+    case encodingHash("prod2"): assert(keyword == "prod2"); TypesetSetupConstruct(BigProd2,); \
+    case encodingHash("coprod2"): assert(keyword == "coprod2"); TypesetSetupConstruct(BigCoProd2,); \
+    case encodingHash("union2"): assert(keyword == "union2"); TypesetSetupConstruct(BigUnion2,); \
+    case encodingHash("intersection2"): assert(keyword == "intersection2"); TypesetSetupConstruct(BigIntersection2,); \
+    case encodingHash("int2"): assert(keyword == "int2"); TypesetSetupConstruct(Integral2,); \
+    case encodingHash("oint2"): assert(keyword == "oint2"); TypesetSetupConstruct(IntegralConv2,); \
+    case encodingHash("^"): assert(keyword == "^"); TypesetSetupConstruct(Superscript,); \
+    case encodingHash("_"): assert(keyword == "_"); TypesetSetupConstruct(Subscript,); \
+    case encodingHash("max"): assert(keyword == "max"); TypesetSetupConstruct(Max,); \
+    case encodingHash("min"): assert(keyword == "min"); TypesetSetupConstruct(Min,); \
+    case encodingHash("inf"): assert(keyword == "inf"); TypesetSetupConstruct(Inf,); \
+    case encodingHash("sup"): assert(keyword == "sup"); TypesetSetupConstruct(Sup,); \
+    case encodingHash("sqrt"): assert(keyword == "sqrt"); TypesetSetupConstruct(Sqrt,); \
+    case encodingHash("sum1"): assert(keyword == "sum1"); TypesetSetupConstruct(BigSum1,); \
+    case encodingHash("prod1"): assert(keyword == "prod1"); TypesetSetupConstruct(BigProd1,); \
+    case encodingHash("coprod1"): assert(keyword == "coprod1"); TypesetSetupConstruct(BigCoProd1,); \
+    case encodingHash("union1"): assert(keyword == "union1"); TypesetSetupConstruct(BigUnion1,); \
+    case encodingHash("intersection1"): assert(keyword == "intersection1"); TypesetSetupConstruct(BigIntersection1,); \
+    case encodingHash("int1"): assert(keyword == "int1"); TypesetSetupConstruct(Integral1,); \
+    case encodingHash("iint1"): assert(keyword == "iint1"); TypesetSetupConstruct(DoubleIntegral1,); \
+    case encodingHash("iiint1"): assert(keyword == "iiint1"); TypesetSetupConstruct(TripleIntegral1,); \
+    case encodingHash("oint1"): assert(keyword == "oint1"); TypesetSetupConstruct(IntegralConv1,); \
+    case encodingHash("oiint1"): assert(keyword == "oiint1"); TypesetSetupConstruct(DoubleIntegralConv1,); \
+    case encodingHash("oiiint1"): assert(keyword == "oiiint1"); TypesetSetupConstruct(TripleIntegralConv1,); \
+    case encodingHash("sum0"): assert(keyword == "sum0"); TypesetSetupNullary(BigSum0); \
+    case encodingHash("prod0"): assert(keyword == "prod0"); TypesetSetupNullary(BigProd0); \
+    case encodingHash("coprod0"): assert(keyword == "coprod0"); TypesetSetupNullary(BigCoProd0); \
+    case encodingHash("union0"): assert(keyword == "union0"); TypesetSetupNullary(BigUnion0); \
+    case encodingHash("intersection0"): assert(keyword == "intersection0"); TypesetSetupNullary(BigIntersection0); \
+    case encodingHash("int0"): assert(keyword == "int0"); TypesetSetupNullary(Integral0); \
+    case encodingHash("iint0"): assert(keyword == "iint0"); TypesetSetupNullary(DoubleIntegral0); \
+    case encodingHash("iiint0"): assert(keyword == "iiint0"); TypesetSetupNullary(TripleIntegral0); \
+    case encodingHash("oint0"): assert(keyword == "oint0"); TypesetSetupNullary(IntegralConv0); \
+    case encodingHash("oiint0"): assert(keyword == "oiint0"); TypesetSetupNullary(DoubleIntegralConv0); \
+    case encodingHash("oiiint0"): assert(keyword == "oiiint0"); TypesetSetupNullary(TripleIntegralConv0); \
+    case encodingHash("hat"): assert(keyword == "hat"); TypesetSetupConstruct(AccentHat,); \
+    case encodingHash("tilde"): assert(keyword == "tilde"); TypesetSetupConstruct(AccentTilde,); \
+    case encodingHash("bar"): assert(keyword == "bar"); TypesetSetupConstruct(AccentBar,); \
+    case encodingHash("breve"): assert(keyword == "breve"); TypesetSetupConstruct(AccentBreve,); \
+    case encodingHash("dot"): assert(keyword == "dot"); TypesetSetupConstruct(AccentDot,); \
+    case encodingHash("ddot"): assert(keyword == "ddot"); TypesetSetupConstruct(AccentDdot,); \
+    case encodingHash("dddot"): assert(keyword == "dddot"); TypesetSetupConstruct(AccentDddot,);
+} // namespace Forscape
+
+#endif // FORSCAPE_CONSTRUCT_CODES_H
@@ -0,0 +1,652 @@
+#include "forscape_interpreter.h"
+
+#include <math.h>
+#ifdef USE_CONAN_EIGEN
+  #include <unsupported/Eigen/MatrixFunctions>
+#else
+  #include <eigen3/unsupported/Eigen/MatrixFunctions>
+#endif
+using namespace Eigen;
+using namespace std;
+
+namespace Forscape {
+
+namespace Code {
+
+Value Interpreter::interpretExpr(ParseNode pn) {
+    if(error_code != NO_ERROR_FOUND) return &error_code;
+    switch( parse_tree.getOp(pn) ){
+        case OP_IMPLICIT_MULTIPLY: return implicitMult(pn);
+        case OP_GREATER: return greater(pn);
+        case OP_LESS: return less(pn);
+        case OP_GROUP_PAREN:
+        case OP_GROUP_BRACKET:
+            return interpretExpr(parse_tree.child(pn));
+        case OP_LOOP_INVARIANT: return loopInvariant(pn);
+        case OP_SUBSCRIPT_ACCESS: return elementAccess(pn);
+        case OP_IDENTIFIER: return readLocal(pn);
+        case OP_READ_GLOBAL: return readGlobal(pn);
+        case OP_READ_UPVALUE: return readClosedVar(pn);
+        case OP_TRUE: return true;
+        case OP_FALSE: return false;
+        case OP_MATRIX: return matrix(pn);
+        case OP_DECIMAL_LITERAL:
+        case OP_INTEGER_LITERAL:
+            return parse_tree.getDouble(pn);
+        case OP_STRING: return parse_tree.getValue(pn);
+        case OP_LAMBDA: return anonFun(pn);
+        case OP_CALL: return call(pn);
+        case OP_UNIT_VECTOR: return unitVector(pn);
+        case OP_SUMMATION: return sum(pn);
+        case OP_PRODUCT: return prod(pn);
+        case OP_CASES: return cases(pn);
+        case OP_PI: return 3.14159265358979323846264338327950288419716939937510f;
+        case OP_EULERS_NUMBER: return 2.71828182845904523536028747135266249775724709369995f;
+        case OP_GOLDEN_RATIO: return 1.61803398874989484820458683436563811f;
+        case OP_SPEED_OF_LIGHT: return 299792458.0f;
+        case OP_PLANCK_CONSTANT: return 6.62607015e-34f;
+        case OP_REDUCED_PLANCK_CONSTANT: return 1.054571817e-34f;
+        case OP_STEFAN_BOLTZMANN_CONSTANT: return 5.670374419e-8f;
+        case OP_MATRIX_LITERAL: return std::get<SharedMatrix>(parse_tree.getValue(pn));
+        case OP_DERIVATIVE:
+        case OP_PARTIAL:
+            return finiteDiff(pn);
+        case OP_FACTORIAL: return factorial(pn);
+        case OP_BINOMIAL: return binomial(pn);
+        case OP_DEFINITE_INTEGRAL: return definiteIntegral(pn);
+
+        case OP_TANGENT:
+        case OP_LENGTH:
+        case OP_INVERT:
+        case OP_HYPERBOLIC_SINE:
+        case OP_NORM_SQUARED:
+        case OP_ARCSINE:
+        case OP_ARCCOSINE:
+        case OP_COLS:
+        case OP_ARCCOTANGENT:
+        case OP_DAGGER:
+        case OP_HYPERBOLIC_SECANT:
+        case OP_COMP_ERR_FUNC:
+        case OP_COSECANT:
+        case OP_SECANT:
+        case OP_NORM_1:
+        case OP_COSINE:
+        case OP_CHECK_POSITIVE_INT:
+        case OP_ACCENT_HAT:
+        case OP_BIJECTIVE_MAPPING:
+        case OP_CHECK_SCALAR:
+        case OP_ARCSECANT:
+        case OP_PSEUDO_INVERSE:
+        case OP_NORM:
+        case OP_HYPERBOLIC_ARCSINE:
+        case OP_CEIL:
+        case OP_HYPERBOLIC_ARCSECANT:
+        case OP_HYPERBOLIC_ARCCOSECANT:
+        case OP_ABS:
+        case OP_FLOOR:
+        case OP_HYPERBOLIC_ARCCOSINE:
+        case OP_HYPERBOLIC_COSECANT:
+        case OP_CHECK_NAT:
+        case OP_ERROR_FUNCTION:
+        case OP_UNARY_MINUS:
+        case OP_NORM_INFTY:
+        case OP_NATURAL_LOG:
+        case OP_ARCTANGENT:
+        case OP_COTANGENT:
+        case OP_CHECK_ZERO:
+        case OP_HYPERBOLIC_ARCTANGENT:
+        case OP_HYPERBOLIC_TANGENT:
+        case OP_LOGICAL_NOT:
+        case OP_SQRT:
+        case OP_HYPERBOLIC_COTANGENT:
+        case OP_TRANSPOSE:
+        case OP_ARCCOSECANT:
+        case OP_HYPERBOLIC_ARCCOTANGENT:
+        case OP_LOGARITHM:
+        case OP_EXP:
+        case OP_HYPERBOLIC_COSINE:
+        case OP_SINE:
+        case OP_ROWS:
+            return unaryDispatch(pn);
+
+        case OP_CROSS:
+        case OP_LOGICAL_OR:
+        case OP_LOGARITHM_BASE:
+        case OP_MULTIPLICATION:
+        case OP_SUBTRACTION:
+        case OP_LINEAR_SOLVE:
+        case OP_APPROX:
+        case OP_ADDITION:
+        case OP_ODOT:
+        case OP_MODULUS:
+        case OP_BACKSLASH:
+        case OP_FRACTION:
+        case OP_POWER:
+        case OP_NOT_APPROX:
+        case OP_FORWARDSLASH:
+        case OP_ROOT:
+        case OP_LOGICAL_AND:
+        case OP_ONES_MATRIX:
+        case OP_IDENTITY_MATRIX:
+        case OP_NOT_EQUAL:
+        case OP_DOT:
+        case OP_ZERO_MATRIX:
+        case OP_DIVIDE:
+        case OP_EQUAL:
+        case OP_ARCTANGENT2:
+        case OP_INNER_PRODUCT:
+        case OP_NORM_p:
+            return binaryDispatch(pn);
+
+        default: return error(UNRECOGNIZED_EXPR, pn);
+    }
+}
+
+static constexpr uint16_t unaryCode(Op t, size_t value_op){
+    assert((t & (value_op << 8)) == 0);
+    assert((t | (value_op << 8)) <= std::numeric_limits<uint16_t>::max());
+    return static_cast<uint16_t>(t | (value_op << 8));
+}
+
+Value Interpreter::unaryDispatch(ParseNode pn) {
+    //Variables are read in place, skipping even the reference count of shared matrices
+    ParseNode child_node = parse_tree.child(pn);
+    Value temp;
+    const Value& child = isVariableRead(child_node) ? read(child_node) : (temp = interpretExpr(child_node));
+
+    switch( unaryCode(parse_tree.getOp(pn), child.index()) ){
+        case unaryCode(OP_UNARY_MINUS, double_index):
+            return -std::get<double>(child);
+        case unaryCode(OP_UNARY_MINUS, MatrixXd_index):
+            return -std::get<SharedMatrix>(child).read();
+        case unaryCode(OP_TRANSPOSE, double_index):
+            return std::get<double>(child);
+        case unaryCode(OP_TRANSPOSE, MatrixXd_index):
+            return std::get<SharedMatrix>(child).read().transpose();
+        case unaryCode(OP_PSEUDO_INVERSE, double_index):
+            return 1/std::get<double>(child);
+        case unaryCode(OP_PSEUDO_INVERSE, MatrixXd_index):
+            return std::get<SharedMatrix>(child).read().completeOrthogonalDecomposition().pseudoInverse();
+        case unaryCode(OP_DAGGER, double_index):
+            return std::get<double>(child);
+        case unaryCode(OP_DAGGER, MatrixXd_index):
+            return std::get<SharedMatrix>(child).read().adjoint();
+        case unaryCode(OP_SQRT, double_index):
+        {
+            const auto& a = std::get<double>(child);
+            if(a<0) return error(IMAGINARY_RESULT, pn);
+            return std::sqrt(a);
+        }
+        case unaryCode(OP_SQRT, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.sqrt();
+        }
+        case unaryCode(OP_LOGICAL_NOT, bool_index):
+            return !std::get<bool>(child);
+        case unaryCode(OP_ABS, double_index):
+            return std::abs(std::get<double>(child));
+        case unaryCode(OP_ABS, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.determinant();
+        }
+        case unaryCode(OP_CEIL, double_index):
+            return std::ceil(std::get<double>(child));
+        case unaryCode(OP_CEIL, MatrixXd_index):
+            return std::get<SharedMatrix>(child).read().array().ceil();
+        case unaryCode(OP_FLOOR, double_index):
+            return static_cast<double>(int(std::get<double>(child)));
+        case unaryCode(OP_FLOOR, MatrixXd_index):
+            return std::get<SharedMatrix>(child).read().array().floor();
+        case unaryCode(OP_NORM, double_index):
+        case unaryCode(OP_NORM_INFTY, double_index):
+        case unaryCode(OP_NORM_1, double_index):
+            return std::abs(std::get<double>(child));
+        case unaryCode(OP_NORM, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if((a.cols() > 1) & (a.rows() > 1)) return error(DIMENSION_MISMATCH, pn);
+            return a.norm();
+        }
+        case unaryCode(OP_NORM_1, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if((a.cols() > 1) & (a.rows() > 1)) return error(DIMENSION_MISMATCH, pn);
+            return a.lpNorm<1>();
+        }
+        case unaryCode(OP_NORM_INFTY, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if((a.cols() > 1) & (a.rows() > 1)) return error(DIMENSION_MISMATCH, pn);
+            return a.lpNorm<Eigen::Infinity>();
+        }
+        case unaryCode(OP_LENGTH, double_index):
+            return static_cast<double>(1);
+        case unaryCode(OP_LENGTH, string_index):
+            return static_cast<double>(std::get<String>(child).str().size());
+        case unaryCode(OP_LENGTH, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if((a.cols() > 1 && a.rows() > 1)) return error(DIMENSION_MISMATCH, pn);
+            return static_cast<double>(a.size());
+        }
+        case unaryCode(OP_SINE, double_index):
+            return std::sin(std::get<double>(child));
+        case unaryCode(OP_SINE, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.sin();
+        }
+        case unaryCode(OP_COSINE, double_index):
+            return std::cos(std::get<double>(child));
+        case unaryCode(OP_COSINE, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.cos();
+        }
+        case unaryCode(OP_TANGENT, double_index):
+            return std::tan(std::get<double>(child));
+        case unaryCode(OP_ARCSINE, double_index):
+            return std::asin(std::get<double>(child));
+        case unaryCode(OP_ARCCOSINE, double_index):
+            return std::acos(std::get<double>(child));
+        case unaryCode(OP_ARCTANGENT, double_index):
+            return std::atan(std::get<double>(child));
+        case unaryCode(OP_COSECANT, double_index):
+            return 1/std::sin(std::get<double>(child));
+        case unaryCode(OP_SECANT, double_index):
+            return 1/std::cos(std::get<double>(child));
+        case unaryCode(OP_COTANGENT, double_index):
+            return 1/std::tan(std::get<double>(child));
+        case unaryCode(OP_ARCCOSECANT, double_index):
+            return std::asin(1/std::get<double>(child));
+        case unaryCode(OP_ARCSECANT, double_index):
+            return std::acos(1/std::get<double>(child));
+        case unaryCode(OP_ARCCOTANGENT, double_index):
+            return std::atan(1/std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_SINE, double_index):
+            return std::sinh(std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_SINE, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.sinh();
+        }
+        case unaryCode(OP_HYPERBOLIC_COSINE, double_index):
+            return std::cosh(std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_TANGENT, double_index):
+            return std::tanh(std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_ARCSINE, double_index):
+            return std::asinh(std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_ARCCOSINE, double_index):
+            return std::acosh(std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_ARCTANGENT, double_index):
+            return std::atanh(std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_COSECANT, double_index):
+            return 1/std::asinh(std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_SECANT, double_index):
+            return 1/std::acosh(std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_COTANGENT, double_index):
+            return 1/std::atanh(std::get<double>(child));
+        case unaryCode(OP_HYPERBOLIC_ARCCOSECANT, double_index):
+            return std::log( 1/std::get<double>(child) + std::sqrt(1/std::pow(std::get<double>(child),2) + 1) );
+        case unaryCode(OP_HYPERBOLIC_ARCSECANT, double_index):
+            return std::log( (1 + std::sqrt(1 - std::pow(std::get<double>(child),2))) / std::get<double>(child) );
+        case unaryCode(OP_HYPERBOLIC_ARCCOTANGENT, double_index):
+            return std::log((std::get<double>(child)+1)/(std::get<double>(child)-1))/2;
+        case unaryCode(OP_EXP, double_index):
+            return std::exp(std::get<double>(child));
+        case unaryCode(OP_EXP, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.exp();
+        }
+        case unaryCode(OP_NATURAL_LOG, double_index):
+        {
+            const auto& a = std::get<double>(child);
+            if(a <= 0) return error(LOG_ARG, pn);
+            return std::log(a);
+        }
+        case unaryCode(OP_NATURAL_LOG, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.log();
+        }
+        case unaryCode(OP_LOGARITHM, double_index):
+        {
+            const auto& a = std::get<double>(child);
+            if(a <= 0) return error(LOG_ARG, pn);
+            return std::log(a) / std::log(10);
+        }
+        case unaryCode(OP_ERROR_FUNCTION, double_index):
+            return std::erf(std::get<double>(child));
+        case unaryCode(OP_COMP_ERR_FUNC, double_index):
+            return std::erfc(std::get<double>(child));
+        case unaryCode(OP_ACCENT_HAT, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(((a.size()!=3) & (a.size() != 6)) | ((a.rows()>1) & (a.cols()>1))) return error(DIMENSION_MISMATCH, pn);
+            return hat(a);
+        }
+        case unaryCode(OP_BIJECTIVE_MAPPING, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(((a.rows()!=3) | (a.cols() != 3)) & ((a.rows() != 4) | (a.cols() != 4))) return error(DIMENSION_MISMATCH, pn);
+            return invHat(a);
+        }
+        case unaryCode(OP_INVERT, double_index):
+            return 1/std::get<double>(child);
+        case unaryCode(OP_INVERT, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.inverse();
+        }
+        case unaryCode(OP_NORM_SQUARED, double_index):
+            return std::get<double>(child)*std::get<double>(child);
+        case unaryCode(OP_NORM_SQUARED, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(child).read();
+            if(((a.rows()>1) & (a.cols()>1))) return error(DIMENSION_MISMATCH, pn);
+            return a.squaredNorm();
+        }
+        case unaryCode(OP_CHECK_SCALAR, double_index):
+            return std::get<double>(child);
+        case unaryCode(OP_CHECK_SCALAR, MatrixXd_index):
+            return error(EXPECT_SCALAR, pn);
+        case unaryCode(OP_CHECK_ZERO, double_index):
+        {
+            const auto& a = std::get<double>(child);
+            if(a!=0) return error(INDEX_OUT_OF_RANGE, pn);
+            return a;
+        }
+        case unaryCode(OP_CHECK_ZERO, MatrixXd_index):
+            return error(EXPECT_SCALAR, pn);
+        case unaryCode(OP_CHECK_NAT, double_index):
+        {
+            const auto& a = std::get<double>(child);
+            if(a<1) return error(DIMENSION_MISMATCH, pn);
+            return a;
+        }
+        case unaryCode(OP_CHECK_NAT, MatrixXd_index):
+            return error(EXPECT_SCALAR, pn);
+        case unaryCode(OP_CHECK_POSITIVE_INT, double_index):
+        {
+            const auto& a = std::get<double>(child);
+            if(a<0) return error(DIMENSION_MISMATCH, pn);
+            return a;
+        }
+        case unaryCode(OP_CHECK_POSITIVE_INT, MatrixXd_index):
+            return error(EXPECT_SCALAR, pn);
+        case unaryCode(OP_ROWS, double_index):
+            return 1.0f;
+        case unaryCode(OP_ROWS, MatrixXd_index):
+            return static_cast<double>(std::get<SharedMatrix>(child).read().rows());
+        case unaryCode(OP_COLS, double_index):
+            return 1.0f;
+        case unaryCode(OP_COLS, MatrixXd_index):
+            return static_cast<double>(std::get<SharedMatrix>(child).read().cols());
+        default: return error(TYPE_ERROR, pn);
+    }
+}
+
+static constexpr uint16_t binaryCode(Op t, size_t a_op, size_t b_op){
+    assert((t & (a_op << 8) & (b_op << 12)) == 0);
+    assert((t | (a_op << 8) | (b_op << 12)) <= std::numeric_limits<uint16_t>::max());
+    return static_cast<uint16_t>(t | (a_op << 8) | (b_op << 12));
+}
+
+Value Interpreter::binaryDispatch(ParseNode pn) {
+    ParseNode lhs = parse_tree.lhs(pn);
+    ParseNode rhs = parse_tree.rhs(pn);
+
+    //Variables are read in place once nothing else can be evaluated,
+    //since evaluating an operand could move the stack under a reference
+    if(isVariableRead(rhs)){
+        if(isVariableRead(lhs)){
+            const Value& vL = read(lhs);
+            return binaryDispatch(parse_tree.getOp(pn), vL, read(rhs), pn);
+        }
+        Value vL = interpretExpr(lhs);
+        return binaryDispatch(parse_tree.getOp(pn), vL, read(rhs), pn);
+    }
+
+    Value vL = interpretExpr(lhs);
+    Value vR = interpretExpr(rhs);
+
+    return binaryDispatch(parse_tree.getOp(pn), vL, vR, pn);
+}
+
+Value Interpreter::binaryDispatch(Op op, const Value& lhs, const Value& rhs, ParseNode pn){
+    switch( binaryCode(op, lhs.index(), rhs.index()) ){
+        case binaryCode(OP_ADDITION, double_index, double_index):
+            return std::get<double>(lhs)+std::get<double>(rhs);
+        case binaryCode(OP_ADDITION, MatrixXd_index, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<SharedMatrix>(rhs).read();
+            if((a.rows()!=b.rows()) | (a.cols()!=b.cols())) return error(DIMENSION_MISMATCH, pn);
+            return a+b;
+        }
+        case binaryCode(OP_ADDITION, string_index, string_index):
+            return std::get<String>(lhs)+std::get<String>(rhs);
+        case binaryCode(OP_SUBTRACTION, double_index, double_index):
+            return std::get<double>(lhs)-std::get<double>(rhs);
+        case binaryCode(OP_SUBTRACTION, MatrixXd_index, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<SharedMatrix>(rhs).read();
+            if((a.rows()!=b.rows()) | (a.cols()!=b.cols())) return error(DIMENSION_MISMATCH, pn);
+            return a-b;
+        }
+        case binaryCode(OP_MULTIPLICATION, double_index, double_index):
+        case binaryCode(OP_CROSS, double_index, double_index):
+        case binaryCode(OP_DOT, double_index, double_index):
+        case binaryCode(OP_CALL, double_index, double_index):
+        case binaryCode(OP_INNER_PRODUCT, double_index, double_index):
+        case binaryCode(OP_ODOT, double_index, double_index):
+            return std::get<double>(lhs)*std::get<double>(rhs);
+        case binaryCode(OP_MULTIPLICATION, double_index, MatrixXd_index):
+        case binaryCode(OP_CALL, double_index, MatrixXd_index):
+            return std::get<double>(lhs)*std::get<SharedMatrix>(rhs).read();
+        case binaryCode(OP_MULTIPLICATION, MatrixXd_index, double_index):
+        case binaryCode(OP_CALL, MatrixXd_index, double_index):
+            return std::get<SharedMatrix>(lhs).read()*std::get<double>(rhs);
+        case binaryCode(OP_MULTIPLICATION, MatrixXd_index, MatrixXd_index):
+        case binaryCode(OP_CALL, MatrixXd_index, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<SharedMatrix>(rhs).read();
+            if(a.cols()!=b.rows()) return error(DIMENSION_MISMATCH, pn);
+            return (a.rows() > 1 || b.cols() > 1) ? Value(a*b) : dot(a,b);
+        }
+        case binaryCode(OP_DOT, MatrixXd_index, MatrixXd_index):
+        case binaryCode(OP_INNER_PRODUCT, MatrixXd_index, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<SharedMatrix>(rhs).read();
+            if((a.rows()!=b.rows()) | (a.cols()!=b.cols()) | ((a.cols() > 1) & (a.rows() > 1))) return error(DIMENSION_MISMATCH, pn);
+            return dot(a,b);
+        }
+        case binaryCode(OP_CROSS, MatrixXd_index, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<SharedMatrix>(rhs).read();
+            if((a.rows()!=b.rows()) | (a.cols()!=b.cols()) | (a.size()!=3)) return error(DIMENSION_MISMATCH, pn);
+            return Map<const Vector3d>(a.data()).cross(Map<const Vector3d>(b.data()));
+        }
+        case binaryCode(OP_ODOT, MatrixXd_index, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<SharedMatrix>(rhs).read();
+            if((a.rows()!=b.rows()) | (a.cols()!=b.cols())) return error(DIMENSION_MISMATCH, pn);
+            return a.cwiseProduct(b);
+        }
+        case binaryCode(OP_FORWARDSLASH, double_index, double_index):
+        case binaryCode(OP_DIVIDE, double_index, double_index):
+        case binaryCode(OP_FRACTION, double_index, double_index):
+        {
+            const auto& a = std::get<double>(lhs);
+            const auto& b = std::get<double>(rhs);
+            if(b==0) return error(DIV_BY_ZERO, pn);
+            return a/b;
+        }
+        case binaryCode(OP_FORWARDSLASH, MatrixXd_index, double_index):
+        case binaryCode(OP_DIVIDE, MatrixXd_index, double_index):
+        case binaryCode(OP_FRACTION, MatrixXd_index, double_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<double>(rhs);
+            if(b==0) return error(DIV_BY_ZERO, pn);
+            return a/b;
+        }
+        case binaryCode(OP_BACKSLASH, double_index, double_index):
+            return std::get<double>(rhs)/std::get<double>(lhs);
+        case binaryCode(OP_BACKSLASH, double_index, MatrixXd_index):
+            return std::get<SharedMatrix>(rhs).read()/std::get<double>(lhs);
+        case binaryCode(OP_MODULUS, double_index, double_index):
+            return std::fmod(std::get<double>(lhs),std::get<double>(rhs));
+        case binaryCode(OP_EQUAL, double_index, double_index):
+            return std::get<double>(lhs)==std::get<double>(rhs);
+        case binaryCode(OP_EQUAL, MatrixXd_index, MatrixXd_index):
+            return std::get<SharedMatrix>(lhs).read().isApprox(std::get<SharedMatrix>(rhs).read());
+        case binaryCode(OP_EQUAL, string_index, string_index):
+            return std::get<String>(lhs)==std::get<String>(rhs);
+        case binaryCode(OP_EQUAL, bool_index, bool_index):
+            return std::get<bool>(lhs)==std::get<bool>(rhs);
+        case binaryCode(OP_EQUAL, bool_index, string_index):
+        case binaryCode(OP_EQUAL, bool_index, MatrixXd_index):
+        case binaryCode(OP_EQUAL, bool_index, double_index):
+        case binaryCode(OP_EQUAL, MatrixXd_index, string_index):
+        case binaryCode(OP_EQUAL, MatrixXd_index, bool_index):
+        case binaryCode(OP_EQUAL, MatrixXd_index, double_index):
+        case binaryCode(OP_EQUAL, double_index, string_index):
+        case binaryCode(OP_EQUAL, double_index, MatrixXd_index):
+        case binaryCode(OP_EQUAL, double_index, bool_index):
+        case binaryCode(OP_EQUAL, string_index, MatrixXd_index):
+        case binaryCode(OP_EQUAL, string_index, bool_index):
+        case binaryCode(OP_EQUAL, string_index, double_index):
+            return false;
+        case binaryCode(OP_NOT_EQUAL, double_index, double_index):
+            return std::get<double>(lhs)!=std::get<double>(rhs);
+        case binaryCode(OP_NOT_EQUAL, MatrixXd_index, MatrixXd_index):
+            return !std::get<SharedMatrix>(lhs).read().isApprox(std::get<SharedMatrix>(rhs).read());
+        case binaryCode(OP_NOT_EQUAL, string_index, string_index):
+            return std::get<String>(lhs)!=std::get<String>(rhs);
+        case binaryCode(OP_NOT_EQUAL, bool_index, bool_index):
+            return std::get<bool>(lhs)!=std::get<bool>(rhs);
+        case binaryCode(OP_NOT_EQUAL, bool_index, string_index):
+        case binaryCode(OP_NOT_EQUAL, bool_index, MatrixXd_index):
+        case binaryCode(OP_NOT_EQUAL, bool_index, double_index):
+        case binaryCode(OP_NOT_EQUAL, MatrixXd_index, string_index):
+        case binaryCode(OP_NOT_EQUAL, MatrixXd_index, bool_index):
+        case binaryCode(OP_NOT_EQUAL, MatrixXd_index, double_index):
+        case binaryCode(OP_NOT_EQUAL, double_index, string_index):
+        case binaryCode(OP_NOT_EQUAL, double_index, MatrixXd_index):
+        case binaryCode(OP_NOT_EQUAL, double_index, bool_index):
+        case binaryCode(OP_NOT_EQUAL, string_index, MatrixXd_index):
+        case binaryCode(OP_NOT_EQUAL, string_index, bool_index):
+        case binaryCode(OP_NOT_EQUAL, string_index, double_index):
+            return true;
+        case binaryCode(OP_POWER, double_index, double_index):
+            return std::pow(std::get<double>(lhs),std::get<double>(rhs));
+        case binaryCode(OP_POWER, MatrixXd_index, double_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<double>(rhs);
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return (b == -1) ? a.inverse().eval() : a.pow(b).eval();
+        }
+        case binaryCode(OP_POWER, double_index, MatrixXd_index):
+        {
+            const auto& a = std::get<double>(lhs);
+            const auto& b = std::get<SharedMatrix>(rhs).read();
+            if(b.cols()!=b.rows()) return error(DIMENSION_MISMATCH, pn);
+            return (b.log()*a).exp();
+        }
+        case binaryCode(OP_ROOT, double_index, double_index):
+            return std::pow(std::get<double>(lhs),1/std::get<double>(rhs));
+        case binaryCode(OP_ROOT, MatrixXd_index, double_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<double>(rhs);
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.pow(1/b);
+        }
+        case binaryCode(OP_ROOT, double_index, MatrixXd_index):
+        {
+            const auto& a = std::get<double>(lhs);
+            const auto& b = std::get<SharedMatrix>(rhs).read();
+            if(b.cols()!=b.rows()) return error(DIMENSION_MISMATCH, pn);
+            return (b.inverse().log()*a).exp();
+        }
+        case binaryCode(OP_LOGICAL_AND, bool_index, bool_index):
+            return std::get<bool>(lhs) && std::get<bool>(rhs);
+        case binaryCode(OP_LOGICAL_OR, bool_index, bool_index):
+            return std::get<bool>(lhs) || std::get<bool>(rhs);
+        case binaryCode(OP_NORM_p, double_index, double_index):
+            return std::abs(std::get<double>(lhs));
+        case binaryCode(OP_NORM_p, MatrixXd_index, double_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<double>(rhs);
+            if((a.cols() > 1) & (a.rows() > 1)) return error(DIMENSION_MISMATCH, pn);
+            return pNorm(a, b);
+        }
+        case binaryCode(OP_ZERO_MATRIX, double_index, double_index):
+            return std::get<double>(lhs)*std::get<double>(rhs) == 1 ? Value(0.0) : MatrixXd::Zero(static_cast<Index>(std::get<double>(lhs)), static_cast<Index>(std::get<double>(rhs)));
+        case binaryCode(OP_ONES_MATRIX, double_index, double_index):
+            return std::get<double>(lhs)*std::get<double>(rhs) == 1 ? Value(1.0) : MatrixXd::Ones(static_cast<Index>(std::get<double>(lhs)), static_cast<Index>(std::get<double>(rhs)));
+        case binaryCode(OP_IDENTITY_MATRIX, double_index, double_index):
+            return std::get<double>(lhs)*std::get<double>(rhs) == 1 ? Value(1.0) : MatrixXd::Identity(static_cast<Index>(std::get<double>(lhs)), static_cast<Index>(std::get<double>(rhs)));
+        case binaryCode(OP_ARCTANGENT2, double_index, double_index):
+            return std::atan2(std::get<double>(lhs),std::get<double>(rhs));
+        case binaryCode(OP_LOGARITHM_BASE, double_index, double_index):
+        {
+            const auto& a = std::get<double>(lhs);
+            const auto& b = std::get<double>(rhs);
+            if(a <= 0) return error(LOG_ARG, pn);
+            if(b <= 0) return error(LOG_BASE, pn);
+            return std::log(a) / std::log(b);
+        }
+        case binaryCode(OP_LINEAR_SOLVE, double_index, double_index):
+            return std::get<double>(rhs)/std::get<double>(lhs);
+        case binaryCode(OP_LINEAR_SOLVE, double_index, MatrixXd_index):
+            return std::get<SharedMatrix>(rhs).read()/std::get<double>(lhs);
+        case binaryCode(OP_LINEAR_SOLVE, MatrixXd_index, double_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<double>(rhs);
+            if(a.cols()!=a.rows()) return error(DIMENSION_MISMATCH, pn);
+            return a.inverse()*b;
+        }
+        case binaryCode(OP_LINEAR_SOLVE, MatrixXd_index, MatrixXd_index):
+        {
+            const auto& a = std::get<SharedMatrix>(lhs).read();
+            const auto& b = std::get<SharedMatrix>(rhs).read();
+            if((a.cols()!=a.rows()) | (a.cols()!=b.rows())) return error(DIMENSION_MISMATCH, pn);
+            return a.colPivHouseholderQr().solve(b);
+        }
+        case binaryCode(OP_APPROX, double_index, double_index):
+            return approx(std::get<double>(lhs), std::get<double>(rhs));
+        case binaryCode(OP_APPROX, MatrixXd_index, MatrixXd_index):
+            return approx(std::get<SharedMatrix>(lhs).read(), std::get<SharedMatrix>(rhs).read());
+        case binaryCode(OP_NOT_APPROX, double_index, double_index):
+            return !approx(std::get<double>(lhs), std::get<double>(rhs));
+        case binaryCode(OP_NOT_APPROX, MatrixXd_index, MatrixXd_index):
+            return !approx(std::get<SharedMatrix>(lhs).read(), std::get<SharedMatrix>(rhs).read());
+        default: return error(TYPE_ERROR, pn);
+    }
+}
+
+
+}
+
+}
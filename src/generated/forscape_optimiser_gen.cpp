@@ -0,0 +1,230 @@
+#include "forscape_optimiser.h"
+
+#include <cmath>
+
+namespace Forscape {
+
+namespace Code {
+
+bool Optimiser::foldConstant(Op op, double& val) noexcept {
+    switch(op){
+        case OP_PI: val = 3.14159265358979323846264338327950288419716939937510f; return true;
+        case OP_EULERS_NUMBER: val = 2.71828182845904523536028747135266249775724709369995f; return true;
+        case OP_GOLDEN_RATIO: val = 1.61803398874989484820458683436563811f; return true;
+        case OP_SPEED_OF_LIGHT: val = 299792458.0f; return true;
+        case OP_PLANCK_CONSTANT: val = 6.62607015e-34f; return true;
+        case OP_REDUCED_PLANCK_CONSTANT: val = 1.054571817e-34f; return true;
+        case OP_STEFAN_BOLTZMANN_CONSTANT: val = 5.670374419e-8f; return true;
+        default: return false;
+    }
+}
+
+bool Optimiser::foldUnary(Op op, double a, double& val) noexcept {
+    switch(op){
+        case OP_UNARY_MINUS:
+            val = -a;
+            return true;
+        case OP_TRANSPOSE:
+            val = a;
+            return true;
+        case OP_PSEUDO_INVERSE:
+            val = 1/a;
+            return true;
+        case OP_DAGGER:
+            val = a;
+            return true;
+        case OP_SQRT:
+            if(a<0) return false;
+            val = std::sqrt(a);
+            return true;
+        case OP_ABS:
+            val = std::abs(a);
+            return true;
+        case OP_CEIL:
+            val = std::ceil(a);
+            return true;
+        case OP_FLOOR:
+            val = static_cast<double>(int(a));
+            return true;
+        case OP_NORM:
+        case OP_NORM_INFTY:
+        case OP_NORM_1:
+            val = std::abs(a);
+            return true;
+        case OP_LENGTH:
+            val = static_cast<double>(1);
+            return true;
+        case OP_SINE:
+            val = std::sin(a);
+            return true;
+        case OP_COSINE:
+            val = std::cos(a);
+            return true;
+        case OP_TANGENT:
+            val = std::tan(a);
+            return true;
+        case OP_ARCSINE:
+            val = std::asin(a);
+            return true;
+        case OP_ARCCOSINE:
+            val = std::acos(a);
+            return true;
+        case OP_ARCTANGENT:
+            val = std::atan(a);
+            return true;
+        case OP_COSECANT:
+            val = 1/std::sin(a);
+            return true;
+        case OP_SECANT:
+            val = 1/std::cos(a);
+            return true;
+        case OP_COTANGENT:
+            val = 1/std::tan(a);
+            return true;
+        case OP_ARCCOSECANT:
+            val = std::asin(1/a);
+            return true;
+        case OP_ARCSECANT:
+            val = std::acos(1/a);
+            return true;
+        case OP_ARCCOTANGENT:
+            val = std::atan(1/a);
+            return true;
+        case OP_HYPERBOLIC_SINE:
+            val = std::sinh(a);
+            return true;
+        case OP_HYPERBOLIC_COSINE:
+            val = std::cosh(a);
+            return true;
+        case OP_HYPERBOLIC_TANGENT:
+            val = std::tanh(a);
+            return true;
+        case OP_HYPERBOLIC_ARCSINE:
+            val = std::asinh(a);
+            return true;
+        case OP_HYPERBOLIC_ARCCOSINE:
+            val = std::acosh(a);
+            return true;
+        case OP_HYPERBOLIC_ARCTANGENT:
+            val = std::atanh(a);
+            return true;
+        case OP_HYPERBOLIC_COSECANT:
+            val = 1/std::asinh(a);
+            return true;
+        case OP_HYPERBOLIC_SECANT:
+            val = 1/std::acosh(a);
+            return true;
+        case OP_HYPERBOLIC_COTANGENT:
+            val = 1/std::atanh(a);
+            return true;
+        case OP_HYPERBOLIC_ARCCOSECANT:
+            val = std::log( 1/a + std::sqrt(1/std::pow(a,2) + 1) );
+            return true;
+        case OP_HYPERBOLIC_ARCSECANT:
+            val = std::log( (1 + std::sqrt(1 - std::pow(a,2))) / a );
+            return true;
+        case OP_HYPERBOLIC_ARCCOTANGENT:
+            val = std::log((a+1)/(a-1))/2;
+            return true;
+        case OP_EXP:
+            val = std::exp(a);
+            return true;
+        case OP_NATURAL_LOG:
+            if(a <= 0) return false;
+            val = std::log(a);
+            return true;
+        case OP_LOGARITHM:
+            if(a <= 0) return false;
+            val = std::log(a) / std::log(10);
+            return true;
+        case OP_ERROR_FUNCTION:
+            val = std::erf(a);
+            return true;
+        case OP_COMP_ERR_FUNC:
+            val = std::erfc(a);
+            return true;
+        case OP_INVERT:
+            val = 1/a;
+            return true;
+        case OP_NORM_SQUARED:
+            val = a*a;
+            return true;
+        case OP_CHECK_SCALAR:
+            val = a;
+            return true;
+        case OP_CHECK_ZERO:
+            if(a!=0) return false;
+            val = a;
+            return true;
+        case OP_CHECK_NAT:
+            if(a<1) return false;
+            val = a;
+            return true;
+        case OP_CHECK_POSITIVE_INT:
+            if(a<0) return false;
+            val = a;
+            return true;
+        case OP_ROWS:
+            val = 1.0f;
+            return true;
+        case OP_COLS:
+            val = 1.0f;
+            return true;
+        default: return false;
+    }
+}
+
+bool Optimiser::foldBinary(Op op, double a, double b, double& val) noexcept {
+    switch(op){
+        case OP_ADDITION:
+            val = a+b;
+            return true;
+        case OP_SUBTRACTION:
+            val = a-b;
+            return true;
+        case OP_MULTIPLICATION:
+        case OP_CROSS:
+        case OP_DOT:
+        case OP_INNER_PRODUCT:
+        case OP_ODOT:
+            val = a*b;
+            return true;
+        case OP_FORWARDSLASH:
+        case OP_DIVIDE:
+        case OP_FRACTION:
+            if(b==0) return false;
+            val = a/b;
+            return true;
+        case OP_BACKSLASH:
+            val = b/a;
+            return true;
+        case OP_MODULUS:
+            val = std::fmod(a,b);
+            return true;
+        case OP_POWER:
+            val = std::pow(a,b);
+            return true;
+        case OP_ROOT:
+            val = std::pow(a,1/b);
+            return true;
+        case OP_NORM_p:
+            val = std::abs(a);
+            return true;
+        case OP_ARCTANGENT2:
+            val = std::atan2(a,b);
+            return true;
+        case OP_LOGARITHM_BASE:
+            if(a <= 0) return false;
+            if(b <= 0) return false;
+            val = std::log(a) / std::log(b);
+            return true;
+        case OP_LINEAR_SOLVE:
+            val = b/a;
+            return true;
+        default: return false;
+    }
+}
+
+}
+
+}
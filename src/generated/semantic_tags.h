@@ -0,0 +1,108 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_SEMANTIC_TAGS_H
+#define FORSCAPE_SEMANTIC_TAGS_H
+
+#include <string_view>
+#include <typeset_themes.h>
+
+namespace Forscape {
+
+enum SemanticType {
+    SEM_DEFAULT,
+    SEM_COMMENT,
+    SEM_STRING,
+    SEM_KEYWORD,
+    SEM_NUMBER,
+    SEM_ERROR,
+    SEM_ID,
+    SEM_ID_FUN_IMPURE,
+    SEM_LINK,
+    SEM_PREDEFINEDMAT,
+    SEM_PREDEFINEDMATNUM,
+    SEM_ID_MAT,
+    SEM_ID_MAT_IMPURE,
+    SEM_PREDEF,
+    SEM_ID_EWISE_INDEX,
+    SEM_BIG_SYM,
+    SEM_WARNING,
+    SEM_BOLD,
+    SEM_FILE,
+};
+
+struct SemanticTag {
+    size_t index;
+    SemanticType type;
+
+    SemanticTag(size_t index, SemanticType type)
+        : index(index), type(type) {}
+};
+
+inline constexpr bool isId(SemanticType type){
+    return type >= SEM_ID;
+}
+
+#ifndef FORSCAPE_TYPESET_HEADLESS
+constexpr size_t NUM_SEM_TYPES = 19;
+
+constexpr size_t sem_colours[NUM_SEM_TYPES] {
+    Typeset::COLOUR_TEXT,
+    Typeset::COLOUR_COMMENT,
+    Typeset::COLOUR_STRING,
+    Typeset::COLOUR_KEYWORD,
+    Typeset::COLOUR_NUMBER,
+    Typeset::COLOUR_ERRORTEXT,
+    Typeset::COLOUR_ID,
+    Typeset::COLOUR_IMPURE,
+    Typeset::COLOUR_LINK,
+    Typeset::COLOUR_PREDEFMAT,
+    Typeset::COLOUR_PREDEFMAT,
+    Typeset::COLOUR_ID,
+    Typeset::COLOUR_IMPURE,
+    Typeset::COLOUR_PREDEF,
+    Typeset::COLOUR_KEYWORD,
+    Typeset::COLOUR_TEXT,
+    Typeset::COLOUR_WARNINGBORDER,
+    Typeset::COLOUR_TEXT,
+    Typeset::COLOUR_STRING,
+};
+
+static constexpr size_t NUM_FONTS = 7;
+
+enum Font{
+    JULIAMONO_REGULAR,
+    TRIMMEDJULIAMONO_BOLD,
+    CMU_TYPEWRITER_SCALED_REGULAR,
+    TRIMMEDJULIAMONO_BOLD_ITALIC,
+    CMU_TYPEWRITER_SCALED_BOLD_BOLD,
+    CMU_SERIF_MONO_ITALIC,
+    TRIMMEDJULIAMONO_ITALIC,
+};
+
+constexpr Font font_enum[NUM_SEM_TYPES] {
+    JULIAMONO_REGULAR,
+    JULIAMONO_REGULAR,
+    JULIAMONO_REGULAR,
+    JULIAMONO_REGULAR,
+    JULIAMONO_REGULAR,
+    JULIAMONO_REGULAR,
+    TRIMMEDJULIAMONO_ITALIC,
+    CMU_TYPEWRITER_SCALED_REGULAR,
+    JULIAMONO_REGULAR,
+    TRIMMEDJULIAMONO_BOLD_ITALIC,
+    TRIMMEDJULIAMONO_BOLD,
+    TRIMMEDJULIAMONO_BOLD_ITALIC,
+    CMU_TYPEWRITER_SCALED_BOLD_BOLD,
+    TRIMMEDJULIAMONO_ITALIC,
+    CMU_SERIF_MONO_ITALIC,
+    CMU_SERIF_MONO_ITALIC,
+    JULIAMONO_REGULAR,
+    TRIMMEDJULIAMONO_BOLD,
+    JULIAMONO_REGULAR,
+};
+
+#endif
+
+} // namespace Forscape
+
+#endif // FORSCAPE_SEMANTIC_TAGS_H
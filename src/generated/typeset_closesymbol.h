@@ -0,0 +1,32 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_TYPESET_CLOSESYMBOL_H
+#define FORSCAPE_TYPESET_CLOSESYMBOL_H
+
+#include <unordered_set>
+
+namespace Forscape {
+
+namespace Typeset {
+
+class CloseSymbol{
+private:
+    static const std::unordered_set<char> close_symbols;
+
+public:
+    static bool isClosing(char ch) noexcept{
+        return close_symbols.find(ch) != close_symbols.end();
+    }
+};
+
+const std::unordered_set<char> CloseSymbol::close_symbols{
+    ']',
+    '}',
+    ')',
+};
+
+} // namespace Typeset
+
+} // namespace Forscape
+
+#endif // FORSCAPE_TYPESET_CLOSESYMBOL_H
@@ -0,0 +1,75 @@
+//CODEGEN
+
+#include "typeset_keywords.h"
+
+namespace Forscape {
+
+namespace Typeset {
+
+const std::string Keywords::NONE = "";
+
+const FORSCAPE_UNORDERED_MAP<std::string, std::string> Keywords::defaults {
+    FORSCAPE_KEYWORD_LIST,
+    {"^_", CONSTRUCT_STR DUALSCRIPT_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"frac", CONSTRUCT_STR FRACTION_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"binom", CONSTRUCT_STR BINOMIAL_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"lim", CONSTRUCT_STR LIMIT_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"nrt", CONSTRUCT_STR NRT_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"sum2", CONSTRUCT_STR BIGSUM2_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"prod2", CONSTRUCT_STR BIGPROD2_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"coprod2", CONSTRUCT_STR BIGCOPROD2_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"union2", CONSTRUCT_STR BIGUNION2_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"intersection2", CONSTRUCT_STR BIGINTERSECTION2_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"int2", CONSTRUCT_STR INTEGRAL2_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"oint2", CONSTRUCT_STR INTEGRALCONV2_STR OPEN_STR CLOSE_STR CLOSE_STR},
+    {"^", CONSTRUCT_STR SUPERSCRIPT_STR OPEN_STR CLOSE_STR},
+    {"_", CONSTRUCT_STR SUBSCRIPT_STR OPEN_STR CLOSE_STR},
+    {"max", CONSTRUCT_STR MAX_STR OPEN_STR CLOSE_STR},
+    {"min", CONSTRUCT_STR MIN_STR OPEN_STR CLOSE_STR},
+    {"inf", CONSTRUCT_STR INF_STR OPEN_STR CLOSE_STR},
+    {"sup", CONSTRUCT_STR SUP_STR OPEN_STR CLOSE_STR},
+    {"sqrt", CONSTRUCT_STR SQRT_STR OPEN_STR CLOSE_STR},
+    {"sum1", CONSTRUCT_STR BIGSUM1_STR OPEN_STR CLOSE_STR},
+    {"prod1", CONSTRUCT_STR BIGPROD1_STR OPEN_STR CLOSE_STR},
+    {"coprod1", CONSTRUCT_STR BIGCOPROD1_STR OPEN_STR CLOSE_STR},
+    {"union1", CONSTRUCT_STR BIGUNION1_STR OPEN_STR CLOSE_STR},
+    {"intersection1", CONSTRUCT_STR BIGINTERSECTION1_STR OPEN_STR CLOSE_STR},
+    {"int1", CONSTRUCT_STR INTEGRAL1_STR OPEN_STR CLOSE_STR},
+    {"iint1", CONSTRUCT_STR DOUBLEINTEGRAL1_STR OPEN_STR CLOSE_STR},
+    {"iiint1", CONSTRUCT_STR TRIPLEINTEGRAL1_STR OPEN_STR CLOSE_STR},
+    {"oint1", CONSTRUCT_STR INTEGRALCONV1_STR OPEN_STR CLOSE_STR},
+    {"oiint1", CONSTRUCT_STR DOUBLEINTEGRALCONV1_STR OPEN_STR CLOSE_STR},
+    {"oiiint1", CONSTRUCT_STR TRIPLEINTEGRALCONV1_STR OPEN_STR CLOSE_STR},
+    {"sum", CONSTRUCT_STR BIGSUM0_STR},
+    {"prod", CONSTRUCT_STR BIGPROD0_STR},
+    {"coprod", CONSTRUCT_STR BIGCOPROD0_STR},
+    {"union", CONSTRUCT_STR BIGUNION0_STR},
+    {"intersection", CONSTRUCT_STR BIGINTERSECTION0_STR},
+    {"int", CONSTRUCT_STR INTEGRAL0_STR},
+    {"iint", CONSTRUCT_STR DOUBLEINTEGRAL0_STR},
+    {"iiint", CONSTRUCT_STR TRIPLEINTEGRAL0_STR},
+    {"oint", CONSTRUCT_STR INTEGRALCONV0_STR},
+    {"oiint", CONSTRUCT_STR DOUBLEINTEGRALCONV0_STR},
+    {"oiiint", CONSTRUCT_STR TRIPLEINTEGRALCONV0_STR},
+    {"hat", CONSTRUCT_STR ACCENTHAT_STR OPEN_STR CLOSE_STR},
+    {"tilde", CONSTRUCT_STR ACCENTTILDE_STR OPEN_STR CLOSE_STR},
+    {"bar", CONSTRUCT_STR ACCENTBAR_STR OPEN_STR CLOSE_STR},
+    {"breve", CONSTRUCT_STR ACCENTBREVE_STR OPEN_STR CLOSE_STR},
+    {"dot", CONSTRUCT_STR ACCENTDOT_STR OPEN_STR CLOSE_STR},
+    {"ddot", CONSTRUCT_STR ACCENTDDOT_STR OPEN_STR CLOSE_STR},
+    {"dddot", CONSTRUCT_STR ACCENTDDDOT_STR OPEN_STR CLOSE_STR},
+    {"settings", CONSTRUCT_STR OPEN_STR SETTINGS_STR ""},
+    {"^T", CONSTRUCT_STR SUPERSCRIPT_STR OPEN_STR "⊤" CLOSE_STR},
+    {"^+", CONSTRUCT_STR SUPERSCRIPT_STR OPEN_STR "+" CLOSE_STR},
+    {"^*", CONSTRUCT_STR SUPERSCRIPT_STR OPEN_STR "*" CLOSE_STR},
+    {"^-1", CONSTRUCT_STR SUPERSCRIPT_STR OPEN_STR "-1" CLOSE_STR},
+    {"^dag", CONSTRUCT_STR SUPERSCRIPT_STR OPEN_STR "†" CLOSE_STR},
+   {"cases", CONSTRUCT_STR "{2" OPEN_STR CLOSE_STR CLOSE_STR CLOSE_STR CLOSE_STR},
+   {"mat", CONSTRUCT_STR "[2x2]" OPEN_STR CLOSE_STR CLOSE_STR CLOSE_STR CLOSE_STR},
+};
+
+FORSCAPE_UNORDERED_MAP<std::string, std::string> Keywords::map = defaults;
+
+}
+
+}
@@ -0,0 +1,250 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_TYPESET_KEYWORDS_H
+#define FORSCAPE_TYPESET_KEYWORDS_H
+
+#include <construct_codes.h>
+#include <forscape_common.h>
+#include <string>
+#include <vector>
+
+namespace Forscape {
+
+namespace Typeset {
+
+class Keywords{
+public:
+    static FORSCAPE_UNORDERED_MAP<std::string, std::string> map;
+    static const std::string NONE;
+
+    static const std::string& lookup(const std::string& key) noexcept{
+        auto result = map.find(key);
+        return result==map.end() ? NONE : result->second;
+    }
+
+private:
+    static const FORSCAPE_UNORDERED_MAP<std::string, std::string> defaults;
+public:
+    static void reset() { map = defaults; }
+};
+
+#define FORSCAPE_NUM_KEYWORDS 211
+
+#define FORSCAPE_KEYWORD_LIST\
+    {"|", "‖"},\
+    {"aleph", "ℵ"},\
+    {"alpha", "α"},\
+    {"Alpha", "Α"},\
+    {"approx", "≈"},\
+    {"B", "𝔹"},\
+    {"bagmember", "⋿"},\
+    {"because", "∵"},\
+    {"beta", "β"},\
+    {"Beta", "Β"},\
+    {"beth", "ℶ"},\
+    {"bot", "⊥"},\
+    {"bowtie", "⋈"},\
+    {"bumpeq", "≏"},\
+    {"C", "ℂ"},\
+    {"cap", "∩"},\
+    {"cdot", "⋅"},\
+    {"ceqdef", "≔"},\
+    {"chi", "χ"},\
+    {"Chi", "Χ"},\
+    {"circ", "∘"},\
+    {"complement", "∁"},\
+    {"cong", "≅"},\
+    {"copyright", "©"},\
+    {"cup", "∪"},\
+    {"cupdot", "⊍"},\
+    {"d", "ⅆ"},\
+    {"dagger", "†"},\
+    {"ddagger", "‡"},\
+    {"deg", "°"},\
+    {"degrees", "°"},\
+    {"delta", "δ"},\
+    {"Delta", "Δ"},\
+    {"div", "÷"},\
+    {"doteq", "≐"},\
+    {"e", "ℯ"},\
+    {"E", "𝔼"},\
+    {"emptyset", "∅"},\
+    {"epsilon", "ϵ"},\
+    {"Epsilon", "Ε"},\
+    {"eqcolon", "∹"},\
+    {"eqdef", "≝"},\
+    {"equiv", "≡"},\
+    {"Equiv", "≣"},\
+    {"errbar", "⧮"},\
+    {"eta", "η"},\
+    {"Eta", "Η"},\
+    {"Euler", "ℇ"},\
+    {"euro", "€"},\
+    {"exists", "∃"},\
+    {"F", "𝔽"},\
+    {"forall", "∀"},\
+    {"gamma", "γ"},\
+    {"Gamma", "Γ"},\
+    {"geq", "≥"},\
+    {"geqq", "≧"},\
+    {"gg", "≫"},\
+    {"ggg", "⋙"},\
+    {"H", "ℍ"},\
+    {"ham", "ℋ"},\
+    {"Im", "ℑ"},\
+    {"imath", "ⅈ"},\
+    {"implies", "⇒"},\
+    {"in", "∈"},\
+    {"incr", "∆"},\
+    {"infty", "∞"},\
+    {"iota", "ι"},\
+    {"Iota", "Ι"},\
+    {"J", "𝕁"},\
+    {"jmath", "ⅉ"},\
+    {"kappa", "κ"},\
+    {"Kappa", "Κ"},\
+    {"lag", "ℒ"},\
+    {"lambda", "λ"},\
+    {"Lambda", "Λ"},\
+    {"land", "∧"},\
+    {"langle", "⟨"},\
+    {"lceil", "⌈"},\
+    {"leftarrow", "←"},\
+    {"Leftarrow", "⇐"},\
+    {"leftrightarrow", "↔"},\
+    {"Leftrightarrow", "⇔"},\
+    {"leq", "≤"},\
+    {"leqq", "≦"},\
+    {"lfloor", "⌊"},\
+    {"ll", "≪"},\
+    {"llangle", "⟪"},\
+    {"llbracket", "⟦"},\
+    {"lll", "⋘"},\
+    {"lor", "∨"},\
+    {"ltimes", "⋉"},\
+    {"mapsto", "↦"},\
+    {"mathsterling", "£"},\
+    {"mathyen", "¥"},\
+    {"mho", "℧"},\
+    {"mp", "∓"},\
+    {"mu", "μ"},\
+    {"Mu", "Μ"},\
+    {"N", "ℕ"},\
+    {"nabla", "∇"},\
+    {"napprox", "≉"},\
+    {"ncong", "≇"},\
+    {"ne", "≠"},\
+    {"neg", "¬"},\
+    {"neq", "≠"},\
+    {"nequiv", "≢"},\
+    {"nexists", "∄"},\
+    {"ngtr", "≯"},\
+    {"ni", "∋"},\
+    {"nless", "≮"},\
+    {"nmid", "∤"},\
+    {"nni", "∌"},\
+    {"notin", "∉"},\
+    {"nsubset", "⊄"},\
+    {"nsubseteq", "⊈"},\
+    {"nsupset", "⊅"},\
+    {"nsupseteq", "⊉"},\
+    {"nu", "ν"},\
+    {"Nu", "Ν"},\
+    {"O", "𝕆"},\
+    {"odot", "⨀"},\
+    {"omega", "ω"},\
+    {"Omega", "Ω"},\
+    {"omicron", "ο"},\
+    {"Omicron", "Ο"},\
+    {"ominus", "⊖"},\
+    {"oplus", "⊕"},\
+    {"oslash", "⊘"},\
+    {"otimes", "⊗"},\
+    {"P", "ℙ"},\
+    {"partial", "∂"},\
+    {"phi", "ϕ"},\
+    {"Phi", "Φ"},\
+    {"pi", "π"},\
+    {"Pi", "Π"},\
+    {"Planckconst", "ℎ"},\
+    {"pm", "±"},\
+    {"prec", "≺"},\
+    {"prime", "′"},\
+    {"propto", "∝"},\
+    {"psi", "ψ"},\
+    {"Psi", "Ψ"},\
+    {"Q", "ℚ"},\
+    {"QED", "■"},\
+    {"questeq", "≟"},\
+    {"R", "ℝ"},\
+    {"rangle", "⟩"},\
+    {"rceil", "⌉"},\
+    {"Re", "ℜ"},\
+    {"registered", "®"},\
+    {"rfloor", "⌋"},\
+    {"rho", "ρ"},\
+    {"Rho", "Ρ"},\
+    {"rightarrow", "→"},\
+    {"Rightarrow", "⇒"},\
+    {"rightleftarrows", "⇄"},\
+    {"rrangle", "⟫"},\
+    {"rrbracket", "⟧"},\
+    {"rtimes", "⋊"},\
+    {"S", "𝕊"},\
+    {"second", "″"},\
+    {"shuffle", "⧢"},\
+    {"sigma", "σ"},\
+    {"Sigma", "Σ"},\
+    {"sqcap", "⊓"},\
+    {"sqcup", "⊔"},\
+    {"sqsubset", "⊏"},\
+    {"sqsubseteq", "⊑"},\
+    {"sqsupset", "⊐"},\
+    {"sqsupseteq", "⊒"},\
+    {"subset", "⊂"},\
+    {"Subset", "⋐"},\
+    {"subsetcirc", "⟃"},\
+    {"subseteq", "⊆"},\
+    {"succ", "≻"},\
+    {"supset", "⊃"},\
+    {"supsetcirc", "⟄"},\
+    {"supseteq", "⊇"},\
+    {"tau", "τ"},\
+    {"Tau", "Τ"},\
+    {"therefore", "∴"},\
+    {"thermod", "⧧"},\
+    {"theta", "θ"},\
+    {"Theta", "Θ"},\
+    {"times", "×"},\
+    {"to", "→"},\
+    {"top", "⊤"},\
+    {"triangleq", "≜"},\
+    {"U", "𝕌"},\
+    {"uplus", "⊎"},\
+    {"upsilon", "υ"},\
+    {"Upsilon", "Υ"},\
+    {"varepsilon", "ε"},\
+    {"varkappa", "ϰ"},\
+    {"varphi", "φ"},\
+    {"varpi", "ϖ"},\
+    {"varrho", "ϱ"},\
+    {"varsigma", "ς"},\
+    {"vartheta", "ϑ"},\
+    {"varTheta", "ϴ"},\
+    {"vee", "∨"},\
+    {"veebar", "⊻"},\
+    {"wedge", "∧"},\
+    {"wp", "℘"},\
+    {"wr", "≀"},\
+    {"xi", "ξ"},\
+    {"Xi", "Ξ"},\
+    {"Z", "ℤ"},\
+    {"Zbar", "Ƶ"},\
+    {"zeta", "ζ"},\
+    {"Zeta", "Ζ"}
+
+} // namespace Typeset
+
+} // namespace Forscape
+
+#endif // FORSCAPE_TYPESET_KEYWORDS_H
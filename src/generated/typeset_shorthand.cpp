@@ -0,0 +1,78 @@
+#include "typeset_shorthand.h"
+
+namespace Forscape {
+
+namespace Typeset {
+
+const std::string Shorthand::NONE = "";
+
+const FORSCAPE_UNORDERED_MAP<std::pair<uint32_t, uint32_t>, std::string, PairHash> Shorthand::defaults{
+    {std::make_pair(60, 95), "≤"},
+    {std::make_pair(62, 95), "≥"},
+    {std::make_pair(61, 95), "≡"},
+    {std::make_pair(10586594, 95), "≣"},
+    {std::make_pair(43, 95), "±"},
+    {std::make_pair(9407202, 95), "⊑"},
+    {std::make_pair(9472738, 95), "⊒"},
+    {std::make_pair(11045090, 95), "⊻"},
+    {std::make_pair(60, 45), "←"},
+    {std::make_pair(124, 45), "⊢"},
+    {std::make_pair(45, 58), "∹"},
+    {std::make_pair(92, 47), "∨"},
+    {std::make_pair(61, 47), "≠"},
+    {std::make_pair(8947938, 47), "∉"},
+    {std::make_pair(8620258, 47), "∄"},
+    {std::make_pair(8555234, 47), "⊄"},
+    {std::make_pair(60, 47), "≮"},
+    {std::make_pair(62, 47), "≯"},
+    {std::make_pair(10586594, 47), "≢"},
+    {std::make_pair(10521058, 95), "≢"},
+    {std::make_pair(8948194, 47), "≉"},
+    {std::make_pair(8751586, 47), "≇"},
+    {std::make_pair(9144546, 47), "∌"},
+    {std::make_pair(8817378, 47), "⊈"},
+    {std::make_pair(8620770, 47), "⊅"},
+    {std::make_pair(8882914, 47), "⊉"},
+    {std::make_pair(9603042, 47), "⇏"},
+    {std::make_pair(9734114, 47), "⇎"},
+    {std::make_pair(9471970, 47), "⇍"},
+    {std::make_pair(47, 92), "∧"},
+    {std::make_pair(60, 60), "≪"},
+    {std::make_pair(11176418, 60), "⋘"},
+    {std::make_pair(58, 61), "≔"},
+    {std::make_pair(60, 61), "⇐"},
+    {std::make_pair(45, 62), "→"},
+    {std::make_pair(9471714, 62), "↔"},
+    {std::make_pair(9471970, 62), "⇔"},
+    {std::make_pair(61, 62), "⇒"},
+    {std::make_pair(10521058, 62), "⇏"},
+    {std::make_pair(10652386, 62), "↦"},
+    {std::make_pair(62, 62), "≫"},
+    {std::make_pair(11241954, 62), "⋙"},
+    {std::make_pair(9275362, 62), "⇎"},
+    {std::make_pair(124, 124), "‖"},
+    {std::make_pair(126, 126), "≈"},
+    {std::make_pair(47, 48), "∅"},
+    {std::make_pair(10979554, 45), "⊼"},
+    {std::make_pair(11045090, 45), "⊽"},
+    {std::make_pair(8555234, 95), "⊆"},
+    {std::make_pair(8620770, 95), "⊇"},
+    {std::make_pair(91, 91), "⟦"},
+    {std::make_pair(93, 93), "⟧"},
+    {std::make_pair(94, 95), "∆"},
+    {std::make_pair(10979554, 95), "∆"},
+    {std::make_pair(123, 125), "∅"},
+};
+
+void Shorthand::reset(){ map = defaults; }
+
+const std::string& Shorthand::lookup(uint32_t first, uint32_t second) noexcept{
+    auto result = map.find(std::make_pair(first, second));
+    return result==map.end() ? NONE : result->second;
+}
+
+FORSCAPE_UNORDERED_MAP<std::pair<uint32_t, uint32_t>, std::string, PairHash> Shorthand::map = defaults;
+
+}
+
+}
@@ -0,0 +1,40 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_TYPESET_SHORTHAND_H
+#define FORSCAPE_TYPESET_SHORTHAND_H
+
+#include <cassert>
+#include <forscape_common.h>
+#include <limits>
+#include <string>
+
+namespace Forscape {
+
+namespace Typeset {
+
+struct PairHash {
+    size_t operator()(const std::pair<uint32_t, uint32_t>& key) const noexcept {
+        if(sizeof(size_t) > 4) return std::hash<size_t>()(
+            static_cast<size_t>(key.first) |
+            (static_cast<size_t>(key.second) << 32)
+        );
+        else return std::hash<uint32_t>()(key.first) ^ (std::hash<uint32_t>()(key.second) << 16);
+    }
+};
+
+class Shorthand{
+public:
+    static FORSCAPE_UNORDERED_MAP<std::pair<uint32_t, uint32_t>, std::string, PairHash> map;
+    static void reset();
+    static const std::string& lookup(uint32_t first, uint32_t second) noexcept;
+
+private:
+    static const FORSCAPE_UNORDERED_MAP<std::pair<uint32_t, uint32_t>, std::string, PairHash> defaults;
+    static const std::string NONE;
+};
+
+} // namespace Typeset
+
+} // namespace Forscape
+
+#endif // FORSCAPE_TYPESET_SHORTHAND_H
@@ -0,0 +1,218 @@
+#ifndef FORSCAPE_TYPESET_HEADLESS
+
+#include "typeset_themes.h"
+
+#include <array>
+
+namespace Forscape {
+
+namespace Typeset {
+
+static std::array<QColor, NUM_COLOUR_ROLES> colours;
+
+static constexpr std::array<std::string_view, NUM_COLOUR_ROLES> colour_names {
+    "Background",
+    "Background (disabled)",
+    "Selection",
+    "Selected Text",
+    "Cursor",
+    "Error Background",
+    "Error Border",
+    "Warning Background",
+    "Warning Border",
+    "Linebox Fill",
+    "Linebox Border",
+    "Line Num (active)",
+    "Line Num (passive)",
+    "Grouping Highlight",
+    "Grouping Background",
+    "Comment",
+    "Text",
+    "String",
+    "Keyword",
+    "Number",
+    "Error Text",
+    "Id",
+    "Impure",
+    "Link",
+    "Predef",
+    "Predef Mat",
+    "Light",
+    "Highlight Primary",
+    "Highlight Secondary",
+    "Highlight Border",
+};
+
+static constexpr std::array<std::string_view, NUM_COLOUR_PRESETS> preset_names {
+    "Default",
+    "Dark Mode",
+    "Matrix",
+    "Chalkboard",
+};
+
+static const std::array<std::array<QColor, NUM_COLOUR_ROLES>, NUM_COLOUR_PRESETS> presets {
+    std::array<QColor, NUM_COLOUR_ROLES>({
+        QColor(255, 255, 255),
+        QColor(240, 240, 240),
+        QColor(0, 120, 215),
+        QColor(255, 255, 255),
+        QColor(0, 0, 0),
+        QColor(255, 180, 180),
+        QColor(255, 50, 50),
+        QColor(255, 188, 32),
+        QColor(234, 156, 0),
+        QColor(240, 240, 240),
+        QColor(192, 192, 192),
+        QColor(0, 0, 0),
+        QColor(128, 128, 128),
+        QColor(255, 0, 0),
+        QColor(180, 238, 180),
+        QColor(6, 85, 53),
+        QColor(0, 0, 0),
+        QColor(0, 128, 128),
+        QColor(196, 147, 22),
+        QColor(12, 0, 92),
+        QColor(231, 30, 40),
+        QColor(92, 0, 0),
+        QColor(231, 30, 40),
+        QColor(0, 0, 255),
+        QColor(12, 0, 92),
+        QColor(131, 52, 235),
+        QColor(184, 184, 184),
+        QColor(255, 255, 255),
+        QColor(230, 230, 230),
+        QColor(190, 190, 190),
+    }),
+    std::array<QColor, NUM_COLOUR_ROLES>({
+        QColor(20, 20, 20),
+        QColor(30, 30, 30),
+        QColor(59, 61, 65),
+        QColor(212, 212, 212),
+        QColor(174, 175, 173),
+        QColor(188, 63, 60),
+        QColor(155, 63, 61),
+        QColor(65, 61, 3),
+        QColor(81, 76, 4),
+        QColor(49, 51, 53),
+        QColor(85, 85, 85),
+        QColor(163, 158, 145),
+        QColor(115, 118, 106),
+        QColor(255, 239, 40),
+        QColor(59, 81, 77),
+        QColor(113, 150, 85),
+        QColor(162, 182, 197),
+        QColor(113, 150, 85),
+        QColor(203, 119, 48),
+        QColor(104, 151, 187),
+        QColor(155, 63, 61),
+        QColor(234, 171, 134),
+        QColor(140, 0, 70),
+        QColor(5, 223, 231),
+        QColor(104, 151, 187),
+        QColor(131, 52, 235),
+        QColor(30, 30, 30),
+        QColor(35, 35, 35),
+        QColor(45, 58, 54),
+        QColor(55, 71, 66),
+    }),
+    std::array<QColor, NUM_COLOUR_ROLES>({
+        QColor(0, 0, 0),
+        QColor(0, 0, 0),
+        QColor(0, 50, 0),
+        QColor(96, 218, 14),
+        QColor(94, 207, 28),
+        QColor(90, 0, 81),
+        QColor(90, 0, 81),
+        QColor(48, 59, 30),
+        QColor(48, 59, 30),
+        QColor(0, 0, 0),
+        QColor(0, 0, 0),
+        QColor(96, 218, 14),
+        QColor(43, 81, 28),
+        QColor(241, 241, 8),
+        QColor(43, 81, 28),
+        QColor(43, 81, 28),
+        QColor(0, 126, 0),
+        QColor(43, 81, 28),
+        QColor(0, 240, 140),
+        QColor(0, 230, 0),
+        QColor(96, 218, 14),
+        QColor(96, 218, 14),
+        QColor(43, 81, 28),
+        QColor(215, 3, 130),
+        QColor(96, 218, 14),
+        QColor(96, 218, 14),
+        QColor(0, 0, 0),
+        QColor(0, 20, 0),
+        QColor(0, 30, 0),
+        QColor(0, 126, 0),
+    }),
+    std::array<QColor, NUM_COLOUR_ROLES>({
+        QColor(84, 132, 87),
+        QColor(66, 79, 66),
+        QColor(78, 141, 198),
+        QColor(255, 255, 255),
+        QColor(177, 127, 169),
+        QColor(84, 132, 87),
+        QColor(255, 0, 127),
+        QColor(84, 132, 87),
+        QColor(255, 170, 0),
+        QColor(84, 132, 87),
+        QColor(202, 202, 202),
+        QColor(206, 217, 0),
+        QColor(255, 255, 255),
+        QColor(255, 255, 0),
+        QColor(84, 132, 87),
+        QColor(238, 238, 0),
+        QColor(255, 255, 255),
+        QColor(238, 238, 0),
+        QColor(255, 255, 255),
+        QColor(255, 255, 255),
+        QColor(255, 255, 255),
+        QColor(255, 255, 255),
+        QColor(255, 255, 255),
+        QColor(3, 242, 255),
+        QColor(255, 255, 255),
+        QColor(255, 255, 255),
+        QColor(255, 255, 255),
+        QColor(84, 132, 87),
+        QColor(84, 132, 87),
+        QColor(238, 238, 0),
+    }),
+};
+
+void setColour(size_t role, const QColor& colour) noexcept {
+    assert(role < NUM_COLOUR_ROLES);
+    colours[role] = colour;
+}
+
+const QColor& getColour(size_t role) noexcept {
+    assert(role < NUM_COLOUR_ROLES);
+    return colours[role];
+}
+
+void setPreset(size_t preset) noexcept {
+    assert(preset < NUM_COLOUR_PRESETS);
+    colours = presets[preset];
+}
+
+std::string_view getColourName(size_t role) noexcept {
+    assert(role < NUM_COLOUR_ROLES);
+    return colour_names[role];
+}
+
+std::string_view getPresetName(size_t preset) noexcept {
+    assert(preset < NUM_COLOUR_PRESETS);
+    return preset_names[preset];
+}
+
+const std::array<QColor, NUM_COLOUR_ROLES>& getColours() noexcept { return colours; } 
+
+void setColours(const std::array<QColor, NUM_COLOUR_ROLES>& colours) noexcept { Typeset::colours = colours; } 
+
+
+}
+
+}
+
+#endif
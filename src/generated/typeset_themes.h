@@ -0,0 +1,67 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_TYPESET_HEADLESS
+#ifndef FORSCAPE_TYPESET_THEMES_H
+#define FORSCAPE_TYPESET_THEMES_H
+
+#include <QColor>
+#include <string_view>
+
+namespace Forscape {
+
+namespace Typeset {
+
+constexpr size_t PRESET_DEFAULT = 0;
+constexpr size_t PRESET_DARKMODE = 1;
+constexpr size_t PRESET_MATRIX = 2;
+constexpr size_t PRESET_CHALKBOARD = 3;
+constexpr size_t NUM_COLOUR_PRESETS = 4;
+
+constexpr size_t COLOUR_BACKGROUND = 0;
+constexpr size_t COLOUR_BACKGROUNDDISABLED = 1;
+constexpr size_t COLOUR_SELECTION = 2;
+constexpr size_t COLOUR_SELECTEDTEXT = 3;
+constexpr size_t COLOUR_CURSOR = 4;
+constexpr size_t COLOUR_ERRORBACKGROUND = 5;
+constexpr size_t COLOUR_ERRORBORDER = 6;
+constexpr size_t COLOUR_WARNINGBACKGROUND = 7;
+constexpr size_t COLOUR_WARNINGBORDER = 8;
+constexpr size_t COLOUR_LINEBOXFILL = 9;
+constexpr size_t COLOUR_LINEBOXBORDER = 10;
+constexpr size_t COLOUR_LINENUMACTIVE = 11;
+constexpr size_t COLOUR_LINENUMPASSIVE = 12;
+constexpr size_t COLOUR_GROUPINGHIGHLIGHT = 13;
+constexpr size_t COLOUR_GROUPINGBACKGROUND = 14;
+constexpr size_t COLOUR_COMMENT = 15;
+constexpr size_t COLOUR_TEXT = 16;
+constexpr size_t COLOUR_STRING = 17;
+constexpr size_t COLOUR_KEYWORD = 18;
+constexpr size_t COLOUR_NUMBER = 19;
+constexpr size_t COLOUR_ERRORTEXT = 20;
+constexpr size_t COLOUR_ID = 21;
+constexpr size_t COLOUR_IMPURE = 22;
+constexpr size_t COLOUR_LINK = 23;
+constexpr size_t COLOUR_PREDEF = 24;
+constexpr size_t COLOUR_PREDEFMAT = 25;
+constexpr size_t COLOUR_LIGHT = 26;
+constexpr size_t COLOUR_HIGHLIGHTPRIMARY = 27;
+constexpr size_t COLOUR_HIGHLIGHTSECONDARY = 28;
+constexpr size_t COLOUR_HIGHLIGHTBORDER = 29;
+constexpr size_t NUM_COLOUR_ROLES = 30;
+
+void setColour(size_t role, const QColor& colour) noexcept;
+const QColor& getColour(size_t role) noexcept;
+void setPreset(size_t preset) noexcept;
+std::string_view getColourName(size_t role) noexcept;
+std::string_view getPresetName(size_t preset) noexcept;
+
+//EVENTUALLY: remove these
+const std::array<QColor, NUM_COLOUR_ROLES>& getColours() noexcept;
+void setColours(const std::array<QColor, NUM_COLOUR_ROLES>& colours) noexcept;
+
+} // namespace Typeset
+
+} // namespace Forscape
+
+#endif // FORSCAPE_TYPESET_THEMES_H
+#endif
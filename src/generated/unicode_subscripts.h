@@ -0,0 +1,122 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_UNICODE_SUBSCRIPTS_H
+#define FORSCAPE_UNICODE_SUBSCRIPTS_H
+
+namespace Forscape {
+
+#define FORSCAPE_SUBSCRIPTS_CASES\
+    case 48:\
+    case 49:\
+    case 50:\
+    case 51:\
+    case 52:\
+    case 53:\
+    case 54:\
+    case 55:\
+    case 56:\
+    case 57:\
+    case 43:\
+    case 45:\
+    case 61:\
+    case 47:\
+    case 40:\
+    case 41:\
+    case 97:\
+    case 101:\
+    case 104:\
+    case 105:\
+    case 106:\
+    case 107:\
+    case 108:\
+    case 109:\
+    case 110:\
+    case 111:\
+    case 112:\
+    case 114:\
+    case 115:\
+    case 116:\
+    case 117:\
+    case 118:\
+    case 120:\
+    case 45774:\
+    case 46030:\
+    case 33231:\
+    case 34511:\
+    case 34767:\
+    case 9471714:\
+    case 126:\
+    case 44:\
+    case 95:\
+    case 38851:\
+    case 9080034:\
+    case 9145570:\
+    case 8555234:\
+    case 8817378:\
+    case 8620770:\
+    case 8882914:\
+    case 58:\
+    case 8752098:\
+    case 10979554:\
+    case 124:\
+    case 9931490:
+
+#define FORSCAPE_SUBSCRIPTS_CONVERSION\
+    case 48: out += "₀"; break;\
+    case 49: out += "₁"; break;\
+    case 50: out += "₂"; break;\
+    case 51: out += "₃"; break;\
+    case 52: out += "₄"; break;\
+    case 53: out += "₅"; break;\
+    case 54: out += "₆"; break;\
+    case 55: out += "₇"; break;\
+    case 56: out += "₈"; break;\
+    case 57: out += "₉"; break;\
+    case 43: out += "₊"; break;\
+    case 45: out += "₋"; break;\
+    case 61: out += "₌"; break;\
+    case 47: out += "⸝"; break;\
+    case 40: out += "₍"; break;\
+    case 41: out += "₎"; break;\
+    case 97: out += "ₐ"; break;\
+    case 101: out += "ₑ"; break;\
+    case 104: out += "ₕ"; break;\
+    case 105: out += "ᵢ"; break;\
+    case 106: out += "ⱼ"; break;\
+    case 107: out += "ₖ"; break;\
+    case 108: out += "ₗ"; break;\
+    case 109: out += "ₘ"; break;\
+    case 110: out += "ₙ"; break;\
+    case 111: out += "ₒ"; break;\
+    case 112: out += "ₚ"; break;\
+    case 114: out += "ᵣ"; break;\
+    case 115: out += "ₛ"; break;\
+    case 116: out += "ₜ"; break;\
+    case 117: out += "ᵤ"; break;\
+    case 118: out += "ᵥ"; break;\
+    case 120: out += "ₓ"; break;\
+    case 45774: out += "ᵦ"; break;\
+    case 46030: out += "ᵧ"; break;\
+    case 33231: out += "ᵨ"; break;\
+    case 34511: out += "ᵩ"; break;\
+    case 34767: out += "ᵪ"; break;\
+    case 9471714: out += "˿"; break;\
+    case 126: out += "˷"; break;\
+    case 44: out += "ˏ"; break;\
+    case 95: out += "ˍ"; break;\
+    case 38851: out += "༝"; break;\
+    case 9080034: out += "⸤"; break;\
+    case 9145570: out += "⸥"; break;\
+    case 8555234: out += "꜀"; break;\
+    case 8817378: out += "꜁"; break;\
+    case 8620770: out += "꜆"; break;\
+    case 8882914: out += "꜇"; break;\
+    case 58: out += "܄"; break;\
+    case 8752098: out += "․"; break;\
+    case 10979554: out += "‸ "; break;\
+    case 124: out += "ˌ"; break;\
+    case 9931490: out += "𝅅"; break;
+
+} // namespace Forscape
+
+#endif // FORSCAPE_UNICODE_SUBSCRIPTS_H
@@ -0,0 +1,190 @@
+//CODEGEN FILE
+
+#ifndef FORSCAPE_UNICODE_SUPERSCRIPTS_H
+#define FORSCAPE_UNICODE_SUPERSCRIPTS_H
+
+namespace Forscape {
+
+#define FORSCAPE_SUPERSCRIPTS_CASES\
+    case 48:\
+    case 49:\
+    case 50:\
+    case 51:\
+    case 52:\
+    case 53:\
+    case 54:\
+    case 55:\
+    case 56:\
+    case 57:\
+    case 38851:\
+    case 43:\
+    case 45:\
+    case 61:\
+    case 44226:\
+    case 8752098:\
+    case 47:\
+    case 40:\
+    case 41:\
+    case 65:\
+    case 66:\
+    case 68:\
+    case 69:\
+    case 71:\
+    case 72:\
+    case 73:\
+    case 74:\
+    case 75:\
+    case 76:\
+    case 77:\
+    case 78:\
+    case 79:\
+    case 80:\
+    case 82:\
+    case 84:\
+    case 10783458:\
+    case 85:\
+    case 86:\
+    case 87:\
+    case 97:\
+    case 98:\
+    case 99:\
+    case 100:\
+    case 101:\
+    case 102:\
+    case 103:\
+    case 104:\
+    case 105:\
+    case 106:\
+    case 107:\
+    case 108:\
+    case 109:\
+    case 110:\
+    case 111:\
+    case 112:\
+    case 114:\
+    case 115:\
+    case 116:\
+    case 117:\
+    case 118:\
+    case 119:\
+    case 120:\
+    case 121:\
+    case 122:\
+    case 45774:\
+    case 46030:\
+    case 46286:\
+    case 46543:\
+    case 47310:\
+    case 47566:\
+    case 48590:\
+    case 34511:\
+    case 34767:\
+    case 11241698:\
+    case 47305:\
+    case 126:\
+    case 44:\
+    case 8948962:\
+    case 9014498:\
+    case 33:\
+    case 8555234:\
+    case 8817378:\
+    case 8620770:\
+    case 8882914:\
+    case 58:\
+    case 124:\
+    case 8751330:\
+    case 10518754:
+
+#define FORSCAPE_SUPERSCRIPTS_CONVERSION\
+    case 48: out += "⁰"; break;\
+    case 49: out += "¹"; break;\
+    case 50: out += "²"; break;\
+    case 51: out += "³"; break;\
+    case 52: out += "⁴"; break;\
+    case 53: out += "⁵"; break;\
+    case 54: out += "⁶"; break;\
+    case 55: out += "⁷"; break;\
+    case 56: out += "⁸"; break;\
+    case 57: out += "⁹"; break;\
+    case 38851: out += "˟"; break;\
+    case 43: out += "⁺"; break;\
+    case 45: out += "⁻"; break;\
+    case 61: out += "⁼"; break;\
+    case 44226: out += "˺"; break;\
+    case 8752098: out += "˙ "; break;\
+    case 47: out += "⸍"; break;\
+    case 40: out += "⁽"; break;\
+    case 41: out += "⁾"; break;\
+    case 65: out += "ᴬ"; break;\
+    case 66: out += "ᴮ"; break;\
+    case 68: out += "ᴰ"; break;\
+    case 69: out += "ᴱ"; break;\
+    case 71: out += "ᴳ"; break;\
+    case 72: out += "ᴴ"; break;\
+    case 73: out += "ᴵ"; break;\
+    case 74: out += "ᴶ"; break;\
+    case 75: out += "ᴷ"; break;\
+    case 76: out += "ᴸ"; break;\
+    case 77: out += "ᴹ"; break;\
+    case 78: out += "ᴺ"; break;\
+    case 79: out += "ᴼ"; break;\
+    case 80: out += "ᴾ"; break;\
+    case 82: out += "ᴿ"; break;\
+    case 84: out += "ᵀ"; break;\
+    case 10783458: out += "ᵀ"; break;\
+    case 85: out += "ᵁ"; break;\
+    case 86: out += "ⱽ"; break;\
+    case 87: out += "ᵂ"; break;\
+    case 97: out += "ᵃ"; break;\
+    case 98: out += "ᵇ"; break;\
+    case 99: out += "ᶜ"; break;\
+    case 100: out += "ᵈ"; break;\
+    case 101: out += "ᵉ"; break;\
+    case 102: out += "ᶠ"; break;\
+    case 103: out += "ᵍ"; break;\
+    case 104: out += "ʰ"; break;\
+    case 105: out += "ⁱ"; break;\
+    case 106: out += "ʲ"; break;\
+    case 107: out += "ᵏ"; break;\
+    case 108: out += "ˡ"; break;\
+    case 109: out += "ᵐ"; break;\
+    case 110: out += "ⁿ"; break;\
+    case 111: out += "ᵒ"; break;\
+    case 112: out += "ᵖ"; break;\
+    case 114: out += "ʳ"; break;\
+    case 115: out += "ˢ"; break;\
+    case 116: out += "ᵗ"; break;\
+    case 117: out += "ᵘ"; break;\
+    case 118: out += "ᵛ"; break;\
+    case 119: out += "ʷ"; break;\
+    case 120: out += "ˣ"; break;\
+    case 121: out += "ʸ"; break;\
+    case 122: out += "ᶻ"; break;\
+    case 45774: out += "ᵝ"; break;\
+    case 46030: out += "ᵞ"; break;\
+    case 46286: out += "ᵟ"; break;\
+    case 46543: out += "ᵋ"; break;\
+    case 47310: out += "ᶿ"; break;\
+    case 47566: out += "ᶥ"; break;\
+    case 48590: out += "ᶹ"; break;\
+    case 34511: out += "ᵠ"; break;\
+    case 34767: out += "ᵡ"; break;\
+    case 11241698: out += "ᶴ"; break;\
+    case 47305: out += "ᶲ"; break;\
+    case 126: out += "˜"; break;\
+    case 44: out += "ʼ"; break;\
+    case 8948962: out += "⸢"; break;\
+    case 9014498: out += "⸣"; break;\
+    case 33: out += "ꜝ"; break;\
+    case 8555234: out += "꜂"; break;\
+    case 8817378: out += "꜃"; break;\
+    case 8620770: out += "꜄ "; break;\
+    case 8882914: out += "꜅ "; break;\
+    case 58: out += "܃"; break;\
+    case 124: out += "ˈ "; break;\
+    case 8751330: out += "𝆩"; break;\
+    case 10518754: out += "ᶧ"; break;
+
+} // namespace Forscape
+
+#endif // FORSCAPE_UNICODE_SUPERSCRIPTS_H
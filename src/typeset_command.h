@@ -1,6 +1,8 @@
 #ifndef TYPESET_COMMAND_H
 #define TYPESET_COMMAND_H
 
+#include <cstddef>
+
 namespace Forscape {
 
 namespace Typeset {
@@ -12,6 +14,13 @@ public:
     virtual ~Command(){}
     virtual void undo(Controller& controller) = 0;
     virtual void redo(Controller& controller) = 0;
+
+    //Estimated memory held by the command, which counts against the history budget of the model.
+    //The estimate must not change while the command is on a stack, except through Model::addHistoryBytes.
+    virtual size_t historyBytes() const noexcept {return HISTORY_BYTES_PER_COMMAND;}
+    static constexpr size_t HISTORY_BYTES_PER_COMMAND = 64;
+    static constexpr size_t HISTORY_BYTES_PER_NODE = 128;
+
     virtual bool isCharacterDeletion() const noexcept {return false;}
     virtual bool isCharacterInsertion() const noexcept {return false;}
     virtual bool isPairInsertion() const noexcept {return false;}
@@ -25,6 +25,7 @@ void CommandChangeSettings::swap(Controller& c) noexcept {
     c.selectConstruct(settings); //Select to give affordance of what was changed
     #ifndef FORSCAPE_TYPESET_HEADLESS
     debug_cast<Settings*>(settings)->updateString();
+    settings->invalidateSize();
     #endif
 }
 
@@ -120,6 +120,20 @@ void CommandLine::PhraseRight::free(){
     for(Text* t : texts) delete t;
 }
 
+size_t CommandLine::PhraseRight::historyBytes() const noexcept {
+    return str.size() + (constructs.size() + texts.size()) * HISTORY_BYTES_PER_NODE;
+}
+
+size_t CommandLine::historyBytes() const noexcept {
+    return history_bytes;
+}
+
+static size_t linesHistoryBytes(const std::vector<Line*>& lines) noexcept {
+    size_t bytes = 0;
+    for(const Line* l : lines) bytes += Command::HISTORY_BYTES_PER_NODE + l->serialChars();
+    return bytes;
+}
+
 CommandLine::CommandLine(bool is_insertion,
                          Text* t,
                          const size_t iL,
@@ -135,7 +149,9 @@ CommandLine::CommandLine(bool is_insertion,
       insert_fragment(insert_fragment),
       insert_lines(insert_lines),
       tR(tR),
-      iR(iR) {}
+      iR(iR),
+      history_bytes(sizeof(CommandLine) + source_fragment.historyBytes() + insert_fragment.historyBytes() +
+                    linesHistoryBytes(insert_lines)) {}
 
 }
 
@@ -22,6 +22,7 @@ public:
     virtual ~CommandLine();
     virtual void undo(Controller& controller) override;
     virtual void redo(Controller& controller) override;
+    virtual size_t historyBytes() const noexcept override;
 
 private:
     void insert(Controller& controller);
@@ -36,6 +37,7 @@ private:
         PhraseRight(Text* t, size_t index);
         void writeTo(Text* t, size_t index);
         void free();
+        size_t historyBytes() const noexcept;
     };
 
     bool active;
@@ -47,6 +49,7 @@ private:
     std::vector<Line*> insert_lines;
     Text* tR;
     const size_t iR;
+    const size_t history_bytes; //Measured once, since the lines are shared with the model while the command is enacted
 
     Line* baseLine();
     Model* model();
@@ -20,6 +20,12 @@ void CommandList::redo(Controller& controller){
     for(Command* cmd : cmds) cmd->redo(controller);
 }
 
+size_t CommandList::historyBytes() const noexcept {
+    size_t bytes = sizeof(CommandList) + cmds.size()*sizeof(Command*);
+    for(Command* cmd : cmds) bytes += cmd->historyBytes();
+    return bytes;
+}
+
 }
 
 }
@@ -13,6 +13,7 @@ public:
     virtual ~CommandList();
     virtual void undo(Controller& controller) override;
     virtual void redo(Controller& controller) override;
+    virtual size_t historyBytes() const noexcept override;
 
     std::vector<Command*> cmds;
 };
@@ -26,6 +26,10 @@ void CommandPair::redo(Controller& controller){
     b->redo(controller);
 }
 
+size_t CommandPair::historyBytes() const noexcept {
+    return sizeof(CommandPair) + a->historyBytes() + b->historyBytes();
+}
+
 }
 
 }
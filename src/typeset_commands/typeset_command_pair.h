@@ -14,6 +14,7 @@ public:
     virtual bool isPairInsertion() const noexcept override;
     virtual void undo(Controller& controller) override;
     virtual void redo(Controller& controller) override;
+    virtual size_t historyBytes() const noexcept override;
 
     Command* a;
     Command* b;
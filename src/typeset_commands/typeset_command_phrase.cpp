@@ -62,6 +62,10 @@ void CommandPhrase::redo(Controller& controller){
     else remove(controller);
 }
 
+size_t CommandPhrase::historyBytes() const noexcept {
+    return sizeof(CommandPhrase) + removed.size() + (constructs.size() + texts.size()) * HISTORY_BYTES_PER_NODE;
+}
+
 CommandPhrase::CommandPhrase(Text* tL, const std::string& removed, size_t iR, const std::vector<Construct*>& c, const std::vector<Text*>& t, bool is_insertion)
     : tL(tL), removed(removed), iR(iR), constructs(c), texts(t), is_insertion(is_insertion) {}
 
@@ -21,6 +21,7 @@ public:
     virtual ~CommandPhrase();
     virtual void undo(Controller& controller) override;
     virtual void redo(Controller& controller) override;
+    virtual size_t historyBytes() const noexcept override;
 
 public:
     Text* tL;
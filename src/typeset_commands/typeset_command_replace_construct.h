@@ -30,12 +30,18 @@ protected:
     virtual void redo(Controller& c) override final{
         enacted = true;
         after->parent->constructs[after->id] = after;
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        after->invalidateSize();
+        #endif
         c.setBothToFrontOf(after->next());
     }
 
     virtual void undo(Controller& c) override final{
         enacted = false;
         before->parent->constructs[before->id] = before;
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        before->invalidateSize();
+        #endif
         c.setBothToFrontOf(before->next());
     }
 };
@@ -91,6 +97,9 @@ protected:
         fake->id = 1;
         moved->setParent(con1);
         fake->setParent(con2);
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        con1->invalidateSize();
+        #endif
         c.setBothToFrontOf(con1->next());
     }
 
@@ -103,6 +112,9 @@ protected:
         fake->id = 0;
         moved->setParent(con2);
         fake->setParent(con1);
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        con2->invalidateSize();
+        #endif
         c.setBothToFrontOf(con2->next());
     }
 
@@ -26,6 +26,10 @@ void CommandText::redo(Controller& controller){
     else remove(controller);
 }
 
+size_t CommandText::historyBytes() const noexcept {
+    return sizeof(CommandText) + removed.size();
+}
+
 CommandText::CommandText(Text* t, size_t index, const std::string& str, bool is_insertion)
     : t(t), index(index), removed(str), is_insertion(is_insertion) {}
 
@@ -17,6 +17,7 @@ public:
     static CommandText* remove(Text* t, size_t index, size_t sze);
     virtual void undo(Controller& controller) override;
     virtual void redo(Controller& controller) override;
+    virtual size_t historyBytes() const noexcept override;
 
 public:
     Text* t;
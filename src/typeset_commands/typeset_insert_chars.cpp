@@ -19,6 +19,15 @@ void InsertChars::insertAdditionalChar(const std::string& str){
     inserted += str;
 }
 
+void InsertChars::removeInsertedChars(size_t offset, size_t sze){
+    t->erase(index+offset, inserted.substr(offset, sze));
+    inserted.erase(offset, sze);
+}
+
+size_t InsertChars::historyBytes() const noexcept {
+    return sizeof(InsertChars) + inserted.size();
+}
+
 void InsertChars::undo(Controller& controller){
     t->erase(index, inserted);
     controller.active.text = controller.anchor.text = t;
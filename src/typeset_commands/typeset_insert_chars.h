@@ -16,8 +16,10 @@ public:
     InsertChars(Text* t, size_t index, const std::string& inserted);
     virtual bool isCharacterInsertion() const noexcept override;
     void insertAdditionalChar(const std::string& str);
+    void removeInsertedChars(size_t offset, size_t sze);
     virtual void undo(Controller& controller) override;
     virtual void redo(Controller& controller) override;
+    virtual size_t historyBytes() const noexcept override;
 
 public:
     Text* t;
@@ -13,21 +13,36 @@ RemoveChars::RemoveChars(Text* t, size_t index)
     removed = t->graphemeAt(index);
 }
 
+RemoveChars::RemoveChars(Text* t, size_t index, size_t sze)
+    : t(t), index(index), removed(t->view(index, sze)) {}
+
 bool RemoveChars::isCharacterDeletion() const noexcept {
     return true;
 }
 
 void RemoveChars::removeAdditionalChar(){
-    std::string_view additional = t->graphemeAt(index);
-    removed += additional;
-    t->erase(index, std::string(additional));
+    removeRight(t->graphemeAt(index).size());
 }
 
 void RemoveChars::removeCharLeft(){
-    size_t glyph_size = graphemeSizeLeft(t->getString(), index);
-    index -= glyph_size;
-    removed.insert(0, t->view(index, glyph_size));
-    t->erase(index, std::string(t->view(index, glyph_size)));
+    removeLeft(graphemeSizeLeft(t->getString(), index));
+}
+
+void RemoveChars::removeRight(size_t sze){
+    std::string additional(t->view(index, sze));
+    removed += additional;
+    t->erase(index, additional);
+}
+
+void RemoveChars::removeLeft(size_t sze){
+    index -= sze;
+    std::string additional(t->view(index, sze));
+    removed.insert(0, additional);
+    t->erase(index, additional);
+}
+
+size_t RemoveChars::historyBytes() const noexcept {
+    return sizeof(RemoveChars) + removed.size();
 }
 
 void RemoveChars::undo(Controller& controller){
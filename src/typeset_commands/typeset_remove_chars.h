@@ -14,11 +14,15 @@ class Text;
 class RemoveChars : public Command{
 public:
     RemoveChars(Text* t, size_t index);
+    RemoveChars(Text* t, size_t index, size_t sze);
     virtual bool isCharacterDeletion() const noexcept override;
     void removeAdditionalChar();
     void removeCharLeft();
+    void removeRight(size_t sze);
+    void removeLeft(size_t sze);
     virtual void undo(Controller& controller) override;
     virtual void redo(Controller& controller) override;
+    virtual size_t historyBytes() const noexcept override;
 
 public:
     Text* t;
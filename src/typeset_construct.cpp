@@ -167,14 +167,23 @@ bool Construct::increasesScriptDepth(uint8_t) const noexcept {
     return false;
 }
 
-void Construct::updateSize() noexcept {
+void Construct::updateSize() alloc_except {
     for(Subphrase* s : args){
-        s->script_level = parent->script_level + (increasesScriptDepth(static_cast<uint8_t>(s->id)) & (parent->script_level < 2));
+        const uint8_t script_level =
+            parent->script_level + (increasesScriptDepth(static_cast<uint8_t>(s->id)) & (parent->script_level < 2));
+        if(s->script_level != script_level){
+            s->script_level = script_level;
+            s->size_stale = true;
+        }
         s->updateSize();
     }
     updateSizeFromChildSizes();
 }
 
+void Construct::invalidateSize() noexcept {
+    if(parent) parent->invalidateSize();
+}
+
 void Construct::updateLayout() noexcept {
     updateChildPositions();
     for(Subphrase* s : args)
@@ -186,6 +195,20 @@ void Construct::paint(Painter& painter) const {
     for(Subphrase* arg : args) arg->paint(painter);
 }
 
+void Construct::paint(Painter& painter, double xL, double yT, double xR, double yB) const {
+    if(x > xR || x + width < xL || y > yB || y + height() < yT) return;
+
+    if(x >= xL && x + width <= xR && y >= yT && y + height() <= yB){
+        paint(painter);
+        return;
+    }
+
+    paintSpecific(painter);
+    for(Subphrase* arg : args)
+        if(arg->x <= xR && arg->x + arg->width >= xL && arg->y <= yB && arg->yBottom() >= yT)
+            arg->paint(painter, xL, yT, xR, yB);
+}
+
 void Construct::paintGrouping(Painter&) const {
     // DO NOTHING
 }
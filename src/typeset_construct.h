@@ -2,6 +2,7 @@
 #define TYPESET_CONSTRUCT_H
 
 #include <construct_codes.h>
+#include "typeset_node_pool.h"
 #include <cassert>
 #include <string>
 #include <vector>
@@ -28,7 +29,7 @@ class Selection;
 class Subphrase;
 class Text;
 
-class Construct {
+class Construct : public PooledNode {
 public:
     #ifdef TYPESET_MEMORY_DEBUG
     static FORSCAPE_UNORDERED_SET<Construct*> all;
@@ -59,7 +60,7 @@ public:
     bool sameContent(const Construct* other) const noexcept;
     void search(const std::string& target, std::vector<Selection>& hits, bool use_case, bool word) const;
 
-    Phrase* parent;
+    Phrase* parent = nullptr;
     size_t id;
 
     #ifdef FORSCAPE_SEMANTIC_DEBUGGING
@@ -75,10 +76,12 @@ public:
     Subphrase* argAt(double x, double y) const noexcept;
     uint8_t scriptDepth() const noexcept;
     virtual bool increasesScriptDepth(uint8_t id) const noexcept;
-    void updateSize() noexcept;
+    void updateSize() alloc_except;
+    void invalidateSize() noexcept;
     virtual void updateSizeFromChildSizes() noexcept = 0;
     void updateLayout() noexcept;
     void paint(Painter& painter) const;
+    void paint(Painter& painter, double xL, double yT, double xR, double yB) const;
     virtual void paintGrouping(Painter& painter) const;
     double height() const noexcept;
     double width  DEBUG_INIT_STALE;
@@ -116,6 +116,10 @@ public:
         args[2*row + 1] = second;
         first->id = 2*row;
         second->id = 2*row + 1;
+
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        invalidateSize();
+        #endif
     }
 
     void removeRow(size_t row) noexcept {
@@ -125,6 +129,10 @@ public:
         }
 
         args.resize(args.size() - 2);
+
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        invalidateSize();
+        #endif
     }
 
     template<bool is_insert>
@@ -199,6 +199,10 @@ public:
             U.resize(rows);
             D.resize(rows);
         }
+
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        invalidateSize();
+        #endif
     }
 
     void removeRow(size_t row) noexcept {
@@ -212,6 +216,10 @@ public:
 
         args.resize(numArgs() - cols);
         rows--;
+
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        invalidateSize();
+        #endif
     }
 
     void insertCol(size_t col, const std::vector<Subphrase*>& inserted){
@@ -241,6 +249,10 @@ public:
         }
 
         if(cols > W.size()) W.resize(cols);
+
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        invalidateSize();
+        #endif
     }
 
     void removeCol(size_t col){
@@ -264,6 +276,10 @@ public:
         args.resize(numArgs() - rows);
 
         cols--;
+
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        invalidateSize();
+        #endif
     }
 
     template<bool is_insert>
@@ -427,6 +443,9 @@ public:
             mat.W.resize(mat.cols);
             mat.U.resize(mat.rows);
             mat.D.resize(mat.rows);
+            #ifndef FORSCAPE_TYPESET_HEADLESS
+            mat.invalidateSize();
+            #endif
 
             c.setBothToFrontOf(mat.next());
         }
@@ -441,6 +460,9 @@ public:
             mat.W.resize(mat.cols);
             mat.U.resize(mat.rows);
             mat.D.resize(mat.rows);
+            #ifndef FORSCAPE_TYPESET_HEADLESS
+            mat.invalidateSize();
+            #endif
 
             c.setBothToFrontOf(mat.next());
         }
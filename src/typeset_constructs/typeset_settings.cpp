@@ -128,6 +128,7 @@ void Settings::expandCollapse(Construct* con, Controller& c) noexcept {
     c.deselect();
     Settings* settings = debug_cast<Settings*>(con);
     settings->expanded = !settings->expanded;
+    settings->invalidateSize();
     c.getModel()->postmutate();
 }
 
@@ -352,8 +352,7 @@ void Controller::delWord() noexcept {
         getModel()->mutate(cmd, *this);
     }else if(!atTextEnd()){
         selectNextWord();
-        Command* cmd = deleteSelectionText();
-        getModel()->mutate(cmd, *this);
+        deleteWord();
     }else{
         del();
     }
@@ -365,8 +364,7 @@ void Controller::backspaceWord() noexcept {
         getModel()->mutate(cmd, *this);
     }else if(!atTextStart()){
         selectPrevWord();
-        Command* cmd = deleteSelectionText();
-        getModel()->mutate(cmd, *this);
+        deleteWord();
     }else{
         backspace();
     }
@@ -534,11 +532,11 @@ void Controller::insertText(const std::string& str){
         Command* cmd = new CommandPair(a,b);
         getModel()->mutate(cmd, *this);
     }else{
-        const auto& undo_stack = getModel()->undo_stack;
-        if(!undo_stack.empty() && undo_stack.back()->isCharacterInsertion())
-            insertAdditionalChar(undo_stack.back(), str);
-        else if(!undo_stack.empty() && undo_stack.back()->isPairInsertion())
-            insertAdditionalChar(static_cast<CommandPair*>(undo_stack.back())->b, str);
+        Command* last = getModel()->extendableCommand();
+        if(last && last->isCharacterInsertion())
+            insertAdditionalChar(last, str);
+        else if(last && last->isPairInsertion())
+            insertAdditionalChar(static_cast<CommandPair*>(last)->b, str);
         else
             getModel()->mutate(insertFirstChar(str), *this);
     }
@@ -687,9 +685,11 @@ void Controller::selectLine(const Line* l) noexcept {
 }
 
 void Controller::deleteChar(){
-    const auto& undo_stack = getModel()->undo_stack;
-    if(!undo_stack.empty() && undo_stack.back()->isCharacterDeletion())
-        deleteAdditionalChar(undo_stack.back());
+    Command* last = getModel()->extendableCommand();
+    if(last && last->isCharacterDeletion())
+        deleteAdditionalChar(last);
+    else if(last && last->isCharacterInsertion())
+        deleteInsertedChar(last);
     else
         deleteFirstChar();
 }
@@ -700,12 +700,16 @@ void Controller::deleteAdditionalChar(Command* cmd){
         if(rm->index == active.index){
             Model* m = getModel();
             m->premutate();
+            const size_t removed_before = rm->removed.size();
             rm->removeAdditionalChar();
+            m->addHistoryBytes(rm->removed.size() - removed_before);
             m->postmutate();
         }else if(rm->index == active.index+numBytesInGrapheme(active.text->getString(), active.index)){
             Model* m = getModel();
             m->premutate();
+            const size_t removed_before = rm->removed.size();
             rm->removeCharLeft();
+            m->addHistoryBytes(rm->removed.size() - removed_before);
             m->postmutate();
         }else{
             deleteFirstChar();
@@ -715,11 +719,51 @@ void Controller::deleteAdditionalChar(Command* cmd){
     }
 }
 
+void Controller::deleteInsertedChar(Command* cmd){
+    //Deleting a character from the run being typed shrinks the insertion, so a corrected typo is not an extra undo step
+    InsertChars* in = static_cast<InsertChars*>(cmd);
+    const size_t sze = numBytesInGrapheme(active.text->getString(), active.index);
+    if((in->t == active.text) & (active.index >= in->index) &
+       (active.index+sze <= in->index+in->inserted.size()) & (sze < in->inserted.size())){
+        Model* m = getModel();
+        m->premutate();
+        in->removeInsertedChars(active.index - in->index, sze);
+        m->removeHistoryBytes(sze);
+        m->postmutate();
+    }else{
+        deleteFirstChar();
+    }
+}
+
 void Controller::deleteFirstChar(){
     RemoveChars* rm = new RemoveChars(active.text, active.index);
     getModel()->mutate(rm, *this);
 }
 
+void Controller::deleteWord(){
+    assert(isTextSelection());
+    const size_t start = std::min(active.index, anchor.index);
+    const size_t sze = std::max(active.index, anchor.index) - start;
+
+    //A word deletion next to the previous deletion extends it, so a run of deletions undoes in one step
+    Command* last = getModel()->extendableCommand();
+    if(last && last->isCharacterDeletion()){
+        RemoveChars* rm = static_cast<RemoveChars*>(last);
+        if(rm->t == active.text && (rm->index == start || rm->index == start+sze)){
+            Model* m = getModel();
+            m->premutate();
+            if(rm->index == start) rm->removeRight(sze);
+            else rm->removeLeft(sze);
+            m->addHistoryBytes(sze);
+            m->postmutate();
+            active.index = anchor.index = start;
+            return;
+        }
+    }
+
+    getModel()->mutate(new RemoveChars(active.text, start, sze), *this);
+}
+
 Command* Controller::deleteSelection(){
     if(isTextSelection()) return deleteSelectionText();
     else if(isPhraseSelection()) return deleteSelectionPhrase();
@@ -758,6 +802,7 @@ void Controller::insertAdditionalChar(Command* cmd, const std::string& str){
         Model* m = getModel();
         m->premutate();
         in->insertAdditionalChar(str);
+        m->addHistoryBytes(str.size());
         m->postmutate();
         active.index += str.size();
         anchor.index = active.index;
@@ -135,7 +135,9 @@ private:
     void selectLine(const Line* l) noexcept;
     void deleteChar();
     void deleteAdditionalChar(Command* cmd);
+    void deleteInsertedChar(Command* cmd);
     void deleteFirstChar();
+    void deleteWord();
     Command* deleteSelection();
     Command* deleteSelectionText();
     Command* deleteSelectionPhrase();
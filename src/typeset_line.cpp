@@ -26,19 +26,19 @@ bool Line::isLine() const noexcept {
     return true;
 }
 
-Line* Line::next() const noexcept {
+Line* Line::next() const alloc_except {
     return parent->nextLine(this);
 }
 
-Line* Line::prev() const noexcept {
+Line* Line::prev() const alloc_except {
     return parent->prevLine(this);
 }
 
-Line* Line::prevAsserted() const noexcept {
+Line* Line::prevAsserted() const alloc_except {
     return parent->prevLineAsserted(this);
 }
 
-Line* Line::nextAsserted() const noexcept {
+Line* Line::nextAsserted() const alloc_except {
     return parent->nextLineAsserted(this);
 }
 
@@ -46,19 +46,38 @@ size_t Line::leadingSpaces() const noexcept {
     return front()->leadingSpaces();
 }
 
-const std::vector<Line*>& Line::lines() const noexcept {
-    return parent->lines;
+bool Line::isCollapsed() const noexcept {
+    return collapsed;
+}
+
+void Line::expand() alloc_except {
+    if(!collapsed) return;
+    collapsed = false;
+
+    const std::string serial = front()->getString();
+    assert(serial.find('\n') == std::string::npos);
+    Model::linesFromSerial(serial, this);
+
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    invalidateSize();
+    #endif
 }
 
 #ifndef FORSCAPE_TYPESET_HEADLESS
-Line* Line::nearestLine(double y) const noexcept {
+Line* Line::nearestLine(double y) const alloc_except {
     return parent->nearestLine(y);
 }
 
-Line* Line::nearestAbove(double y) const noexcept {
+Line* Line::nearestAbove(double y) const alloc_except {
     return parent->nearestAbove(y);
 }
 
+void Line::invalidateSize() noexcept {
+    if(size_stale) return;
+    size_stale = true;
+    if(parent) parent->invalidateLine(id);
+}
+
 #ifndef NDEBUG
 void Line::invalidateWidth() noexcept {
     width = STALE;
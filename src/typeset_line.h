@@ -14,17 +14,19 @@ public:
     Line();
     Line(Model* model);
     virtual bool isLine() const noexcept override;
-    Model* parent  DEBUG_INIT_NULLPTR;
-    Line* next() const noexcept;
-    Line* prev() const noexcept;
-    Line* prevAsserted() const noexcept;
-    Line* nextAsserted() const noexcept;
+    Model* parent = nullptr;
+    Line* next() const alloc_except;
+    Line* prev() const alloc_except;
+    Line* prevAsserted() const alloc_except;
+    Line* nextAsserted() const alloc_except;
     size_t leadingSpaces() const noexcept;
-    const std::vector<Line*>& lines() const noexcept;
+    bool isCollapsed() const noexcept;
+    void expand() alloc_except;
 
     #ifndef FORSCAPE_TYPESET_HEADLESS
-    Line* nearestLine(double y) const noexcept;
-    Line* nearestAbove(double y) const noexcept;
+    Line* nearestLine(double y) const alloc_except;
+    Line* nearestAbove(double y) const alloc_except;
+    virtual void invalidateSize() noexcept override;
     #ifndef NDEBUG
     virtual void invalidateWidth() noexcept override;
     virtual void invalidateDims() noexcept override;
@@ -32,6 +34,10 @@ public:
     #endif
 
     size_t scope_depth = 0;
+
+    //Lines of output models are loaded with their serial held verbatim by the front text, and only
+    //built into constructs once visited. Until then, the size of the line is estimated from the serial.
+    bool collapsed = false;
 };
 
 }
@@ -14,7 +14,6 @@
 #include <forscape_symbol_lexical_pass.h>
 #include <forscape_symbol_link_pass.h>
 #include <forscape_interpreter.h>
-#include <fstream>
 #include <unordered_set>
 
 namespace Forscape {
@@ -47,11 +46,19 @@ void Model::clear() noexcept {
     clearRedo();
     for(Command* cmd : undo_stack) delete cmd;
     undo_stack.clear();
+    history_bytes = 0;
     for(Line* l : lines) delete l;
     lines.clear();
+    has_collapsed_lines = false;
+    search_index.clear();
+    search_index_stale = true;
 
     lines.push_back( new Line(this) );
     lines[0]->id = 0;
+
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    invalidateLine(0);
+    #endif
 }
 
 #define TypesetSetupNullary(name) \
@@ -73,7 +80,7 @@ void Model::clear() noexcept {
     text = construct->frontText(); \
     break; }
 
-Model* Model::fromSerial(const std::string& src, bool is_output){
+Model* Model::fromSerial(std::string_view src, bool is_output){
     return new Model(src, is_output);
 }
 
@@ -89,9 +96,11 @@ std::string Model::toSerial() const {
     return out;
 }
 
-Model::Model(const std::string& src, bool is_output)
+Model::Model(std::string_view src, bool is_output)
     : is_output(is_output) {
-    lines = linesFromSerial(src);
+    //Output is only read, so lines are built on demand as they are shown or visited
+    lines = is_output ? collapsedLinesFromSerial(src) : linesFromSerial(src);
+    has_collapsed_lines = is_output;
     for(size_t i = 0; i < lines.size(); i++){
         lines[i]->id = i;
         lines[i]->parent = this;
@@ -138,16 +147,16 @@ Model::Model(const std::string& src, bool is_output)
     assert(isUnicodeChar<OPEN_STRVIEW>(&src[index])); \
     index += codepointSize(OPEN_0); }
 
-std::vector<Line*> Model::linesFromSerial(const std::string& src){
+std::vector<Line*> Model::linesFromSerial(std::string_view src, Line* first){
     assert(isValidSerial(src));
 
     size_t index = 0;
     size_t start = index;
     std::vector<Line*> lines;
-    lines.push_back(new Line());
+    lines.push_back(first ? first : new Line());
     Text* text = lines.back()->front();
 
-    while(index < src.size()){
+    while((index = findSerialControl(src, index)) < src.size()){
         if(isUnicodeChar<CONSTRUCT_STRVIEW>(&src[index])){
             index += codepointSize(CON_0);
 
@@ -250,16 +259,42 @@ std::vector<Line*> Model::linesFromSerial(const std::string& src){
     return lines;
 }
 
+std::vector<Line*> Model::collapsedLinesFromSerial(std::string_view src){
+    assert(isValidSerial(src));
+
+    std::vector<Line*> lines;
+    for(size_t start = 0;;){
+        const size_t end = std::min(src.find('\n', start), src.size());
+        const std::string_view line_src = src.substr(start, end-start);
+        Line* l = new Line();
+        l->front()->setString(line_src);
+        //Without a construct code there are no escapes either, so plain text is already fully built
+        l->collapsed = (line_src.find(CONSTRUCT_STRVIEW) != std::string_view::npos);
+        lines.push_back(l);
+
+        if(end == src.size()) return lines;
+        start = end+1;
+    }
+}
+
+Line* Model::expandedLine(size_t index) const alloc_except {
+    Line* l = lines[index];
+    l->expand();
+    return l;
+}
+
 #undef TypesetSetupNullary
 #undef TypesetSetupConstruct
 #undef TypesetSetupMatrix
 
 #ifdef FORSCAPE_SEMANTIC_DEBUGGING
 std::string Model::toSerialWithSemanticTags() const {
-    std::string out = lines[0]->toStringWithSemanticTags();
-    for(size_t i = 1; i < lines.size(); i++){
-        out += '\n';
-        out += lines[i]->toStringWithSemanticTags();
+    std::string out;
+    for(size_t i = 0; i < lines.size(); i++){
+        if(i) out += '\n';
+        Line* l = lines[i];
+        if(l->isCollapsed()) out += l->front()->getString();
+        else out += l->toStringWithSemanticTags();
     }
 
     return out;
@@ -271,33 +306,68 @@ Line* Model::appendLine(){
     l->id = lines.size();
     lines.push_back(l);
     needs_update = true;
+    search_index_stale = true;
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    invalidateLine(l->id);
+    #endif
     return l;
 }
 
-Line* Model::lastLine() const noexcept {
-    return lines.back();
+Line* Model::lastLine() const alloc_except {
+    return expandedLine(lines.size()-1);
 }
 
 void Model::search(const std::string& str, std::vector<Selection>& hits, bool use_case, bool word) const {
     assert(!str.empty());
-    for(Line* l : lines) l->search(str, hits, use_case, word);
+    //The index and collapsed lines hold the serial, where literal construct glyphs in text are escaped
+    std::string serial_target;
+    typesetEscape(serial_target, str);
+    if(!serialMayContain(serial_target)) return;
+
+    for(Line* l : lines){
+        //A collapsed line is only built when its serial has a match, so searching output leaves other lines collapsed
+        if(l->isCollapsed()){
+            if(!containsMatch(l->front()->getString(), serial_target, use_case)) continue;
+            l->expand();
+        }
+        l->search(str, hits, use_case, word);
+    }
+}
+
+bool Model::mayContain(std::string_view str) const {
+    std::string serial_target;
+    typesetEscape(serial_target, str);
+    return serialMayContain(serial_target);
+}
+
+bool Model::serialMayContain(std::string_view serial_target) const {
+    if(search_index_stale){
+        search_index.build(toSerial());
+        search_index_stale = false;
+    }
+
+    return search_index.mayContain(serial_target);
+}
+
+size_t Model::searchIndexBits() const noexcept {
+    return search_index.numBits();
 }
 
 bool Model::empty() const noexcept {
     return lines.size() == 1 && lines[0]->empty();
 }
 
-Text* Model::firstText() const noexcept {
-    return lines[0]->front();
+Text* Model::firstText() const alloc_except {
+    return expandedLine(0)->front();
 }
 
-Text* Model::lastText() const noexcept {
-    return lines.back()->back();
+Text* Model::lastText() const alloc_except {
+    return lastLine()->back();
 }
 
 size_t Model::serialChars() const noexcept {
     size_t serial_chars = lines.size() - 1;
-    for(Line* l : lines) serial_chars += l->serialChars();
+    for(Line* l : lines) serial_chars += l->isCollapsed() ? l->front()->numChars() : l->serialChars();
     return serial_chars;
 }
 
@@ -306,35 +376,44 @@ void Model::registerCommaSeparatedNumber(const Selection& sel) alloc_except {
 }
 
 void Model::writeString(std::string& out) const noexcept {
-    lines.front()->writeString(out);
-    for(size_t i = 1; i < lines.size(); i++){
-        out += '\n';
-        lines[i]->writeString(out);
+    for(size_t i = 0; i < lines.size(); i++){
+        if(i) out += '\n';
+        Line* l = lines[i];
+        if(l->isCollapsed()) out += l->front()->getString();
+        else l->writeString(out);
     }
 
     assert(isValidSerial(out));
 }
 
-Line* Model::nextLine(const Line* l) const noexcept {
-    return l->id+1 < lines.size() ? lines[l->id+1] : nullptr;
+Line* Model::nextLine(const Line* l) const alloc_except {
+    return l->id+1 < lines.size() ? expandedLine(l->id+1) : nullptr;
 }
 
-Line* Model::prevLine(const Line* l) const noexcept {
-    return l->id > 0 ? lines[l->id-1] : nullptr;
+Line* Model::prevLine(const Line* l) const alloc_except {
+    return l->id > 0 ? expandedLine(l->id-1) : nullptr;
 }
 
-Line* Model::nextLineAsserted(const Line* l) const noexcept {
+Line* Model::nextLineAsserted(const Line* l) const alloc_except {
     assert(l->id+1 < lines.size());
-    return lines[l->id+1];
+    return expandedLine(l->id+1);
 }
 
-Line* Model::prevLineAsserted(const Line* l) const noexcept {
+Line* Model::prevLineAsserted(const Line* l) const alloc_except {
     assert(l->id > 0);
-    return lines[l->id-1];
+    return expandedLine(l->id-1);
 }
 
 #ifndef FORSCAPE_TYPESET_HEADLESS
-Line* Model::nearestLine(double y) const noexcept {
+Line* Model::nearestLine(double y) const alloc_except {
+    return expandedLine(nearestLineIndex(y));
+}
+
+Line* Model::nearestAbove(double y) const alloc_except {
+    return expandedLine(nearestAboveIndex(y));
+}
+
+size_t Model::nearestLineIndex(double y) const noexcept {
     auto search = std::lower_bound(
                     lines.rbegin(),
                     lines.rend(),
@@ -342,10 +421,10 @@ Line* Model::nearestLine(double y) const noexcept {
                     [](Line* l, double y){return l->y - LINE_VERTICAL_PADDING/2 > y;}
                 );
 
-    return (search != lines.rend()) ? *search : lines[0];
+    return (search != lines.rend()) ? (*search)->id : 0;
 }
 
-Line* Model::nearestAbove(double y) const noexcept {
+size_t Model::nearestAboveIndex(double y) const noexcept {
     auto search = std::lower_bound(
                     lines.rbegin(),
                     lines.rend(),
@@ -353,7 +432,20 @@ Line* Model::nearestAbove(double y) const noexcept {
                     [](Line* l, double y){return l->y + l->height() > y;}
                 );
 
-    return (search != lines.rend()) ? *search : lines[0];
+    return (search != lines.rend()) ? (*search)->id : 0;
+}
+
+bool Model::expandLinesBetween(double yT, double yB) {
+    if(!has_collapsed_lines) return false;
+
+    //Expanding a line may change its height, so the caller lays out again until no visible line is collapsed
+    bool expanded = false;
+    for(size_t i = nearestAboveIndex(yT), end = nearestLineIndex(yB); i <= end; i++){
+        expanded |= lines[i]->isCollapsed();
+        lines[i]->expand();
+    }
+
+    return expanded;
 }
 
 Construct* Model::constructAt(double x, double y) const noexcept {
@@ -387,8 +479,23 @@ size_t Model::numLines() const noexcept {
 void Model::appendSerialToOutput(const std::string& src){
     assert(is_output);
 
+    //Only the first line of output joins the existing text. The rest are appended collapsed.
+    const size_t newline = src.find('\n');
     Controller controller(this);
-    controller.insertSerial(src);
+    if(newline != 0) controller.insertSerial(src.substr(0, newline));
+    if(newline != std::string::npos){
+        const std::vector<Line*> appended = collapsedLinesFromSerial(std::string_view(src).substr(newline+1));
+        for(Line* l : appended){
+            l->parent = this;
+            l->id = lines.size();
+            lines.push_back(l);
+        }
+        has_collapsed_lines = true;
+        search_index_stale = true;
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        invalidateLine(appended.front()->id);
+        #endif
+    }
 
     //EVENTUALLY: need to guard against large horizontal prints
     static constexpr size_t MAX_LINES = 8192;
@@ -397,6 +504,9 @@ void Model::appendSerialToOutput(const std::string& src){
         for(size_t i = 0; i < lines_removed; i++) delete lines[i];
         lines.erase(lines.begin(), lines.begin() + lines_removed);
         for(size_t i = 0; i < MAX_LINES; i++) lines[i]->id = i;
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        invalidateLine(0);
+        #endif
     }
 
     #ifndef FORSCAPE_TYPESET_HEADLESS
@@ -404,42 +514,69 @@ void Model::appendSerialToOutput(const std::string& src){
     #endif
 }
 
-bool Model::isSavedDeepComparison() const {
-    if(path.empty()) return empty();
+bool Model::isSaved() const noexcept {
+    if(notOnDisk()) return empty();
 
-    //Avoid a deep comparison if size from file meta data doesn't match
-    //if(std::filesystem::file_size(path) != serialChars()) return false; //Disabled for line endings
-
-    std::ifstream in(path);
-    assert(in.is_open());
-
-    std::stringstream buffer;
-    buffer << in.rdbuf();
+    //Every edit either pushes to or extends the undo stack, so the saved state is tracked by depth
+    return saved_undo_depth == undo_stack.size();
+}
 
-    std::string saved_src = buffer.str();
-    saved_src.erase( std::remove(saved_src.begin(), saved_src.end(), '\r'), saved_src.end() );
+void Model::markSaved() noexcept {
+    saved_undo_depth = undo_stack.size();
+}
 
-    //EVENTUALLY: no need to convert model to serial, but cost is probably negligible compared to I/O
-    std::string curr_src = toSerial();
+void Model::markModified() noexcept {
+    saved_undo_depth = NONE;
+}
 
-    return saved_src == curr_src;
+Command* Model::extendableCommand() const noexcept {
+    //Extending the command at the saved depth would lose the saved state
+    if(undo_stack.empty() || saved_undo_depth == undo_stack.size()) return nullptr;
+    return undo_stack.back();
 }
 
 void Model::mutate(Command* cmd, Controller& controller){
     premutate();
     cmd->redo(controller);
     undo_stack.push_back(cmd);
+    addHistoryBytes(cmd->historyBytes());
     postmutate();
 }
 
+void Model::addHistoryBytes(size_t bytes) noexcept {
+    history_bytes += bytes;
+    if(history_bytes > history_budget) trimHistory();
+}
+
+void Model::removeHistoryBytes(size_t bytes) noexcept {
+    assert(bytes <= history_bytes);
+    history_bytes -= bytes;
+}
+
+void Model::trimHistory() noexcept {
+    //The newest command is always kept, since the controller may still be extending it
+    size_t dropped = 0;
+    while(history_bytes > history_budget && dropped+1 < undo_stack.size()){
+        history_bytes -= undo_stack[dropped]->historyBytes();
+        delete undo_stack[dropped++];
+    }
+    undo_stack.erase(undo_stack.begin(), undo_stack.begin()+dropped);
+
+    if(saved_undo_depth != NONE) saved_undo_depth = saved_undo_depth >= dropped ? saved_undo_depth-dropped : NONE;
+}
+
 void Model::clearRedo(){
-    for(Command* cmd : redo_stack) delete cmd;
+    for(Command* cmd : redo_stack){
+        history_bytes -= cmd->historyBytes();
+        delete cmd;
+    }
     redo_stack.clear();
 }
 
 void Model::undo(Controller& controller){
     if(!undo_stack.empty()){
         clearFormatting();
+        search_index_stale = true;
         Command* cmd = undo_stack.back();
         undo_stack.pop_back();
 
@@ -468,6 +605,7 @@ void Model::undo(Controller& controller){
 void Model::redo(Controller& controller){
     if(!redo_stack.empty()){
         clearFormatting();
+        search_index_stale = true;
         Command* cmd = redo_stack.back();
         redo_stack.pop_back();
 
@@ -494,10 +632,12 @@ void Model::redo(Controller& controller){
 }
 
 void Model::resetUndoRedo() noexcept {
+    saved_undo_depth = (saved_undo_depth == undo_stack.size()) ? 0 : NONE;
     clearRedo();
     for(Command* cmd : undo_stack) delete cmd;
     undo_stack.clear();
     redo_stack.clear();
+    history_bytes = 0;
 }
 
 bool Model::undoAvailable() const noexcept {
@@ -508,16 +648,28 @@ bool Model::redoAvailable() const noexcept {
     return !redo_stack.empty();
 }
 
+size_t Model::historyBytes() const noexcept {
+    return history_bytes;
+}
+
 void Model::remove(size_t start, size_t stop) noexcept {
     lines.erase(lines.begin()+start, lines.begin()+stop);
     for(size_t i = start; i < lines.size(); i++)
         lines[i]->id = i;
+    search_index_stale = true;
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    invalidateLine(start);
+    #endif
 }
 
 void Model::insert(const std::vector<Line*>& l){
     for(size_t i = l.front()->id; i < lines.size(); i++)
         lines[i]->id += l.size();
     lines.insert(lines.begin() + l.front()->id, l.begin(), l.end());
+    search_index_stale = true;
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    invalidateLine(l.front()->id);
+    #endif
 }
 
 Marker Model::begin() const noexcept {
@@ -526,22 +678,56 @@ Marker Model::begin() const noexcept {
 
 #ifndef FORSCAPE_TYPESET_HEADLESS
 void Model::calculateSizes(){
-    for(Line* l : lines) l->updateSize();
+    for(Line* l : lines){
+        l->invalidateSizeRecursive();
+        l->updateSize();
+        l->y = STALE; //Sizes are fresh, but the layout is not
+    }
+    first_stale_line = 0;
+    needs_update = true;
+    revision = nextRevision();
 }
 
 void Model::updateLayout(){
     if(!needs_update) return;
     needs_update = false;
 
-    calculateSizes();
-
-    double y = 0;
+    //Lines are positioned by a running sum of the line heights above, so only the stale lines
+    //and those shifted by a change in the sum need to be laid out again
+    double y = first_stale_line == 0 || first_stale_line > lines.size() ?
+               0 :
+               lines[first_stale_line-1]->yBottom() + LINE_VERTICAL_PADDING;
 
-    for(Line* l : lines){
-        l->y = y;
-        l->updateLayout();
+    for(size_t i = first_stale_line; i < lines.size(); i++){
+        Line* l = lines[i];
+        if(l->size_stale || l->y != y){
+            l->updateSize();
+            l->y = y;
+            l->updateLayout();
+        }
         y += l->height() + LINE_VERTICAL_PADDING;
     }
+
+    first_stale_line = NONE;
+}
+
+void Model::invalidateLayout() noexcept {
+    for(Line* l : lines) l->invalidateSizeRecursive();
+    first_stale_line = 0;
+    needs_update = true;
+    revision = nextRevision();
+}
+
+void Model::invalidateLine(size_t line_id) noexcept {
+    first_stale_line = std::min(first_stale_line, line_id);
+    needs_update = true;
+    revision = nextRevision();
+}
+
+size_t Model::nextRevision() noexcept {
+    //Revisions are unique across models so a view can't mistake a new model for an old one
+    static size_t revision_counter = 0;
+    return ++revision_counter;
 }
 
 void Model::paint(Painter& painter, double xL, double yT, double xR, double yB) const {
@@ -549,8 +735,8 @@ void Model::paint(Painter& painter, double xL, double yT, double xR, double yB)
     Line* end = nearestLine(yB);
 
     for(size_t i = start->id; i <= end->id; i++){
-        Line* l = lines[i];
-        l->paint(painter, xL, xR);
+        Line* l = expandedLine(i);
+        l->paint(painter, xL, yT, xR, yB);
 
         #ifdef FORSCAPE_TYPESET_LAYOUT_DEBUG
         painter.drawHorizontalConstructionLine(l->y - LINE_VERTICAL_PADDING/2);
@@ -673,6 +859,10 @@ void Model::clearFormatting() noexcept {
     warnings.clear();
     error_warning_buffer.clear();
     comma_separated_numbers.clear();
+
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    revision = nextRevision(); //Tags are only applied after clearing the old ones
+    #endif
 }
 
 void Model::performSemanticFormatting(){
@@ -690,7 +880,9 @@ void Model::performSemanticFormatting(){
 }
 
 void Model::premutate() noexcept {
+    if(saved_undo_depth > undo_stack.size()) saved_undo_depth = NONE; //The saved state is about to be cleared from redo
     clearRedo();
+    search_index_stale = true;
     if(is_output) return;
     clearFormatting();
 }
@@ -2,9 +2,11 @@
 #define TYPESET_MODEL_H
 
 #include "forscape_error.h"
+#include "forscape_search.h"
 #include "typeset_command.h"
 #include <filesystem>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "forscape_scanner.h"
@@ -49,7 +51,7 @@ public:
     Model();
     ~Model();
     void clear() noexcept;
-    static Model* fromSerial(const std::string& src, bool is_output = false);
+    static Model* fromSerial(std::string_view src, bool is_output = false);
     std::string toSerial() const;
     void updateWidth() noexcept;
     double getWidth() noexcept;
@@ -57,7 +59,9 @@ public:
     double getHeight() noexcept;
     size_t numLines() const noexcept;
     void appendSerialToOutput(const std::string& src);
-    bool isSavedDeepComparison() const;
+    bool isSaved() const noexcept;
+    void markSaved() noexcept;
+    void markModified() noexcept;
     double width  DEBUG_INIT_STALE;
     double height  DEBUG_INIT_STALE;
 
@@ -68,6 +72,8 @@ public:
     #ifndef FORSCAPE_TYPESET_HEADLESS
     void calculateSizes();
     void updateLayout();
+    void invalidateLayout() noexcept;
+    size_t revision = nextRevision(); //Changes whenever the painted text of the model may have changed
     void paint(Painter& painter, double xL, double yT, double xR, double yB) const;
     void paintGroupings(Painter& painter, const Typeset::Marker& loc) const;
     void paintNumberCommas(Painter& painter, double xL, double yT, double xR, double yB, const Selection& sel) const;
@@ -86,18 +92,24 @@ public:
     void resetUndoRedo() noexcept;
     bool undoAvailable() const noexcept;
     bool redoAvailable() const noexcept;
+    size_t historyBytes() const noexcept;
+    static constexpr size_t DEFAULT_HISTORY_BUDGET = 32*1024*1024;
+    size_t history_budget = DEFAULT_HISTORY_BUDGET; //The oldest undo steps are dropped beyond this estimated size
     void mutate(Command* cmd, Controller& controller);
     void clearFormatting() noexcept;
     bool is_output = false; //EVENTUALLY: this is janky and leads to dumb errors
 
-    Text* firstText() const noexcept;
-    Text* lastText() const noexcept;
+    Text* firstText() const alloc_except;
+    Text* lastText() const alloc_except;
     Line* appendLine();
-    Line* lastLine() const noexcept;
+    Line* lastLine() const alloc_except;
+    Line* expandedLine(size_t index) const alloc_except; //Builds the line if it is collapsed, which leaves the serial unchanged
     void search(const std::string& str, std::vector<Selection>& hits, bool use_case, bool word) const;
+    bool mayContain(std::string_view str) const;
+    size_t searchIndexBits() const noexcept;
     bool empty() const noexcept;
     size_t serialChars() const noexcept;
-    Line* nearestLine(double y) const noexcept;
+    Line* nearestLine(double y) const alloc_except;
     void registerCommaSeparatedNumber(const Typeset::Selection& sel) alloc_except;
     void postmutate();
     void performSemanticFormatting();
@@ -105,17 +117,25 @@ public:
     static constexpr double LINE_VERTICAL_PADDING = 5;
 
 private:
-    Model(const std::string& src, bool is_output = false);
-    static std::vector<Line*> linesFromSerial(const std::string& src);
+    Model(std::string_view src, bool is_output = false);
+    static std::vector<Line*> linesFromSerial(std::string_view src, Line* first = nullptr);
+    static std::vector<Line*> collapsedLinesFromSerial(std::string_view src);
     void writeString(std::string& out) const noexcept;
-    Line* nextLine(const Line* l) const noexcept;
-    Line* prevLine(const Line* l) const noexcept;
-    Line* nextLineAsserted(const Line* l) const noexcept;
-    Line* prevLineAsserted(const Line* l) const noexcept;
+    bool serialMayContain(std::string_view serial_target) const;
+    Line* nextLine(const Line* l) const alloc_except;
+    Line* prevLine(const Line* l) const alloc_except;
+    Line* nextLineAsserted(const Line* l) const alloc_except;
+    Line* prevLineAsserted(const Line* l) const alloc_except;
     #ifndef FORSCAPE_TYPESET_HEADLESS
-    Line* nearestAbove(double y) const noexcept;
+    Line* nearestAbove(double y) const alloc_except;
+    size_t nearestLineIndex(double y) const noexcept;
+    size_t nearestAboveIndex(double y) const noexcept;
+    bool expandLinesBetween(double yT, double yB);
     Construct* constructAt(double x, double y) const noexcept;
     ParseNode parseNodeAt(double x, double y) const noexcept;
+    void invalidateLine(size_t line_id) noexcept;
+    static size_t nextRevision() noexcept;
+    size_t first_stale_line = 0; //Lines before this index have an up-to-date size and position
     #endif
     void clearRedo();
     void remove(size_t start, size_t stop) noexcept;
@@ -123,6 +143,9 @@ private:
     Typeset::Marker begin() const noexcept;
 
     std::vector<Line*> lines;
+    bool has_collapsed_lines = false;
+    mutable TrigramIndex search_index;
+    mutable bool search_index_stale = true; //Set by every edit, and the index is rebuilt by the next search
     friend CommandLine;
     friend Controller;
     friend Line;
@@ -131,6 +154,12 @@ private:
 
     std::vector<Command*> undo_stack;
     std::vector<Command*> redo_stack;
+    size_t saved_undo_depth = 0; //The undo stack size matching the file on disk, or NONE if unreachable
+    size_t history_bytes = 0; //Estimated size of the undo and redo stacks
+    Command* extendableCommand() const noexcept;
+    void addHistoryBytes(size_t bytes) noexcept;
+    void removeHistoryBytes(size_t bytes) noexcept;
+    void trimHistory() noexcept;
 
     Selection find(const std::string& str) noexcept;
     void premutate() noexcept;
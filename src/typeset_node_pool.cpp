@@ -0,0 +1,47 @@
+#include "typeset_node_pool.h"
+
+namespace Forscape {
+
+namespace Typeset {
+
+NodePool::SizeClass NodePool::classes[NUM_CLASSES];
+size_t NodePool::num_slabs = 0;
+
+NodePool::Slab* NodePool::newSlab(SizeClass& size_class, size_t slot_bytes) {
+    //The pool has no destructor, so nodes which outlive static destruction still have their slabs
+    char* memory = static_cast<char*>(::operator new(SLAB_BYTES, std::align_val_t(SLAB_BYTES)));
+    Slab* slab = reinterpret_cast<Slab*>(memory);
+    slab->free_list = nullptr;
+    slab->bump = memory + HEADER_BYTES;
+    slab->live = 0;
+    slab->capacity = (SLAB_BYTES - HEADER_BYTES) / slot_bytes;
+    link(size_class, slab);
+    num_slabs++;
+
+    return slab;
+}
+
+void NodePool::link(SizeClass& size_class, Slab* slab) noexcept {
+    slab->prev = nullptr;
+    slab->next = size_class.available;
+    if(slab->next) slab->next->prev = slab;
+    size_class.available = slab;
+}
+
+void NodePool::unlink(SizeClass& size_class, Slab* slab) noexcept {
+    if(slab->prev) slab->prev->next = slab->next;
+    else size_class.available = slab->next;
+    if(slab->next) slab->next->prev = slab->prev;
+}
+
+void NodePool::release(SizeClass& size_class, Slab* slab) noexcept {
+    if(size_class.available == slab && slab->next == nullptr) return; //Keep the last slab as a spare
+
+    unlink(size_class, slab);
+    ::operator delete(slab, std::align_val_t(SLAB_BYTES));
+    num_slabs--;
+}
+
+}
+
+}
@@ -0,0 +1,107 @@
+#ifndef TYPESET_NODE_POOL_H
+#define TYPESET_NODE_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace Forscape {
+
+namespace Typeset {
+
+//Slab allocator for document nodes. Nodes of a size class are carved from shared slabs, so a document
+//loaded in one pass is laid out contiguously, and nodes freed by edits are recycled through the freelist
+//of their slab. A slab is returned once all of its nodes are freed, except for one spare per size class
+//so that an edit which frees and recreates a node does not reallocate a slab.
+//Typeset nodes are only created and destroyed on the GUI thread, so the pool is not synchronised.
+class NodePool {
+public:
+    static void* allocate(size_t bytes) {
+        if(bytes > MAX_POOLED_BYTES) return ::operator new(bytes);
+
+        SizeClass& size_class = classes[classIndex(bytes)];
+        Slab* slab = size_class.available;
+        if(slab == nullptr) slab = newSlab(size_class, slotBytes(bytes));
+
+        void* ptr;
+        if(FreeNode* recycled = slab->free_list){
+            slab->free_list = recycled->next;
+            ptr = recycled;
+        }else{
+            ptr = slab->bump;
+            slab->bump += slotBytes(bytes);
+        }
+
+        if(++slab->live == slab->capacity) unlink(size_class, slab);
+        return ptr;
+    }
+
+    static void deallocate(void* ptr, size_t bytes) noexcept {
+        if(bytes > MAX_POOLED_BYTES) return ::operator delete(ptr);
+
+        SizeClass& size_class = classes[classIndex(bytes)];
+        Slab* slab = slabOf(ptr);
+        FreeNode* freed = static_cast<FreeNode*>(ptr);
+        freed->next = slab->free_list;
+        slab->free_list = freed;
+
+        if(slab->live-- == slab->capacity) link(size_class, slab);
+        else if(slab->live == 0) release(size_class, slab);
+    }
+
+    static size_t numSlabs() noexcept { return num_slabs; }
+
+private:
+    static constexpr size_t GRANULE = alignof(std::max_align_t);
+    static constexpr size_t MAX_POOLED_BYTES = 256;
+    static constexpr size_t SLAB_BYTES = 64*1024;
+    static constexpr size_t NUM_CLASSES = MAX_POOLED_BYTES / GRANULE;
+
+    static constexpr size_t classIndex(size_t bytes) noexcept { return (bytes-1) / GRANULE; }
+    static constexpr size_t slotBytes(size_t bytes) noexcept { return (classIndex(bytes)+1) * GRANULE; }
+
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    //Header at the start of each slab. Slabs are aligned to their size, so a node finds its slab by masking its address.
+    struct Slab {
+        Slab* prev;
+        Slab* next;
+        FreeNode* free_list;
+        char* bump;
+        size_t live;
+        size_t capacity;
+    };
+
+    static constexpr size_t HEADER_BYTES = (sizeof(Slab) + GRANULE - 1) / GRANULE * GRANULE;
+
+    struct SizeClass {
+        Slab* available = nullptr; //Slabs with at least one free slot
+    };
+
+    static Slab* slabOf(void* ptr) noexcept {
+        return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(ptr) & ~uintptr_t(SLAB_BYTES-1));
+    }
+
+    static Slab* newSlab(SizeClass& size_class, size_t slot_bytes);
+    static void link(SizeClass& size_class, Slab* slab) noexcept;
+    static void unlink(SizeClass& size_class, Slab* slab) noexcept;
+    static void release(SizeClass& size_class, Slab* slab) noexcept;
+    static SizeClass classes[NUM_CLASSES];
+    static size_t num_slabs;
+};
+
+//Routes allocation of Text, Phrase and Construct through the NodePool.
+//Sized delete is required since the size class is not stored with the node.
+class PooledNode {
+public:
+    static void* operator new(size_t bytes) { return NodePool::allocate(bytes); }
+    static void operator delete(void* ptr, size_t bytes) noexcept { NodePool::deallocate(ptr, bytes); }
+};
+
+}
+
+}
+
+#endif // TYPESET_NODE_POOL_H
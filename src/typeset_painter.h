@@ -55,6 +55,8 @@ const QFont& getFont(SemanticType type, uint8_t depth) noexcept;
 class Painter {
 public:
     static void init();
+    static double glyphCacheHitRate() noexcept;
+    static void resetGlyphCacheStats() noexcept;
     Painter(WrappedPainter& painter, double xL, double yT, double xR, double yB);
     void setZoom(double zoom);
     void setType(SemanticType type);
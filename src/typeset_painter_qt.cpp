@@ -2,6 +2,7 @@
 
 #include <typeset_themes.h>
 #include <typeset_view.h>
+#include <forscape_common.h>
 #include <forscape_unicode.h>
 #include <qt_compatability.h>
 
@@ -10,9 +11,12 @@
 #endif
 
 #include <array>
+#include <list>
 #include <QDialog>
+#include <QGlyphRun>
 #include <QLabel>
 #include <QPainterPath>
+#include <QTextLayout>
 
 //EVENTUALLY: probably want to codegen these
 static constexpr double ASCENT[3] = {
@@ -97,6 +101,67 @@ static QColor getColor(SemanticType type) noexcept {
     return Typeset::getColour(sem_colours[type]);
 }
 
+//Shaping is the bulk of drawing text, so recently drawn strings keep their glyph runs.
+//The runs are positioned in unzoomed coordinates, so they are reused across zoom levels.
+struct ShapedText {
+    std::string key;
+    QList<QGlyphRun> runs;
+    qreal ascent;
+};
+
+static constexpr size_t SHAPED_TEXT_CACHE_SIZE = 4096;
+//Leaked deliberately: the glyph runs reference fonts which must not be released after the application
+static std::list<ShapedText>& shaped_lru = *new std::list<ShapedText>();
+static FORSCAPE_UNORDERED_MAP<std::string, std::list<ShapedText>::iterator>& shaped_lookup =
+    *new FORSCAPE_UNORDERED_MAP<std::string, std::list<ShapedText>::iterator>();
+static size_t shaped_hits = 0;
+static size_t shaped_misses = 0;
+
+static const ShapedText& shape(QPaintDevice* device, std::string_view str, SemanticType type, uint8_t depth) {
+    static std::string key;
+    const int dpi = device->logicalDpiY();
+    key.assign(str);
+    key += static_cast<char>(type);
+    key += static_cast<char>(depth);
+    key.append(reinterpret_cast<const char*>(&dpi), sizeof(dpi));
+
+    auto lookup = shaped_lookup.find(key);
+    if(lookup != shaped_lookup.end()){
+        shaped_hits++;
+        shaped_lru.splice(shaped_lru.begin(), shaped_lru, lookup->second);
+        return shaped_lru.front();
+    }
+
+    shaped_misses++;
+    if(shaped_lru.size() == SHAPED_TEXT_CACHE_SIZE){
+        shaped_lookup.erase(shaped_lru.back().key);
+        shaped_lru.pop_back();
+    }
+
+    QTextLayout layout(QString::fromUtf8(str.data(), static_cast<int>(str.size())), getFont(type, depth), device);
+    QTextOption option;
+    option.setWrapMode(QTextOption::NoWrap);
+    layout.setTextOption(option);
+    layout.beginLayout();
+    QTextLine line = layout.createLine();
+    line.setPosition(QPointF(0, 0));
+    layout.endLayout();
+
+    shaped_lru.push_front(ShapedText{key, layout.glyphRuns(), line.ascent()});
+    shaped_lookup[key] = shaped_lru.begin();
+
+    return shaped_lru.front();
+}
+
+double Painter::glyphCacheHitRate() noexcept {
+    const size_t total = shaped_hits + shaped_misses;
+    return total == 0 ? 0 : static_cast<double>(shaped_hits) / total;
+}
+
+void Painter::resetGlyphCacheStats() noexcept {
+    shaped_hits = shaped_misses = 0;
+}
+
 Painter::Painter(WrappedPainter& painter, double xL, double yT, double xR, double yB)
     : painter(painter), xL(xL), yT(yT), xR(xR), yB(yB) {
     const double w = xR-xL;
@@ -137,10 +202,11 @@ void Painter::drawText(double x, double y, std::string_view text){
     x += x_offset + grapheme_start * CHARACTER_WIDTHS[depth];
 
     const size_t char_end = charIndexOfGrapheme(text, max_graphemes[depth], char_start);
+    if(char_end == char_start) return;
 
-    QString q_str = QString::fromUtf8(text.data() + char_start, static_cast<int>(char_end - char_start));
-
-    painter.drawText(QPointF(x, y), q_str);
+    const ShapedText& shaped = shape(painter.device(), text.substr(char_start, char_end - char_start), type, depth);
+    const QPointF top_left(x, y - shaped.ascent);
+    for(const QGlyphRun& run : shaped.runs) painter.drawGlyphRun(top_left, run);
 }
 
 void Painter::drawHighlightBox(double x, double y, double w, double h) {
@@ -34,6 +34,9 @@ void Phrase::appendConstruct(Construct* c){
     t->setParent(this);
     t->id = texts.size();
     texts.push_back(t);
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    invalidateSize();
+    #endif
 }
 
 void Phrase::appendConstruct(Construct* c, Text* t){
@@ -43,6 +46,9 @@ void Phrase::appendConstruct(Construct* c, Text* t){
     t->setParent(this);
     t->id = texts.size();
     texts.push_back(t);
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    invalidateSize();
+    #endif
 }
 
 size_t Phrase::serialChars() const noexcept {
@@ -170,6 +176,9 @@ void Phrase::remove(size_t start, size_t stop) noexcept {
         constructs[i]->id = i;
         texts[i+1]->id = i+1;
     }
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    invalidateSize();
+    #endif
 }
 
 void Phrase::insert(const std::vector<Construct*>& c, const std::vector<Text*>& t){
@@ -192,6 +201,9 @@ void Phrase::insert(size_t index, const std::vector<Construct*>& c, const std::v
         constructs[i]->id = i;
         constructs[i]->parent = this;
     }
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    invalidateSize();
+    #endif
 }
 
 void Phrase::giveUpOwnership() noexcept {
@@ -278,7 +290,10 @@ Construct* Phrase::constructAt(double x, double y) const noexcept {
     else return *search;
 }
 
-void Phrase::updateSize() noexcept {
+void Phrase::updateSize() alloc_except {
+    if(!size_stale) return;
+    size_stale = false;
+
     text(0)->updateWidth();
     width = texts[0]->getWidth();
     above_center = texts[0]->aboveCenter();
@@ -297,6 +312,13 @@ void Phrase::updateSize() noexcept {
     if(width == 0 && !isLine()) width = EMPTY_PHRASE_WIDTH_RATIO*height();
 }
 
+void Phrase::invalidateSizeRecursive() noexcept {
+    size_stale = true;
+    for(Construct* c : constructs)
+        for(size_t i = 0; i < c->numArgs(); i++)
+            c->arg(i)->invalidateSizeRecursive();
+}
+
 void Phrase::updateLayout() noexcept {
     double x_child = x;
     double y_child = y;
@@ -375,19 +397,30 @@ void Phrase::paintMid(Painter& painter, Text* tL, size_t iL, Text* tR, size_t iR
     tR->paintUntil(painter, iR);
 }
 
-void Phrase::paint(Painter& painter, double xL, double xR) const {
+void Phrase::paint(Painter& painter, double xL, double yT, double xR, double yB) const {
     Text* tL = textLeftOf(xL);
     Text* tR = textRightOf(xR);
 
     Typeset::Marker r_mark(tR, tR->charIndexLeft(xR));
     if(!r_mark.atTextEnd()) r_mark.incrementGrapheme();
 
+    painter.setScriptLevel(script_level);
     if(tL == tR){
-        painter.setScriptLevel(script_level);
         tL->paintMid(painter, tL->charIndexLeft(xL), r_mark.index);
-    }else{
-        paintMid(painter, tL, tL->charIndexLeft(xL), tR, r_mark.index);
+        return;
     }
+
+    tL->paintAfter(painter, tL->charIndexLeft(xL));
+    constructs[tL->id]->paint(painter, xL, yT, xR, yB);
+
+    for(size_t i = tL->id+1; i < tR->id; i++){
+        painter.setScriptLevel(script_level);
+        texts[i]->paint(painter);
+        constructs[i]->paint(painter, xL, yT, xR, yB);
+    }
+
+    painter.setScriptLevel(script_level);
+    tR->paintUntil(painter, r_mark.index);
 }
 
 bool Phrase::contains(double x_test, double y_test) const noexcept {
@@ -19,7 +19,7 @@ class Text;
 template<typename Before, typename After> class ReplaceConstruct;
 template<typename Con1, typename Con2, bool to2> class ReplaceConstruct1vs2;
 
-class Phrase {
+class Phrase : public PooledNode {
 public:
     Phrase();
     ~Phrase();
@@ -73,13 +73,15 @@ public:
     Construct* constructAt(double x, double y) const noexcept;
     double height() const noexcept {return above_center + under_center;}
     double yBottom() const noexcept {return y + height();}
-    void updateSize() noexcept;
+    void updateSize() alloc_except;
     void updateLayout() noexcept;
+    virtual void invalidateSize() noexcept = 0;
+    void invalidateSizeRecursive() noexcept;
     virtual void paint(Painter& painter) const;
     virtual void paintUntil(Painter& painter, Text* t_end, size_t index) const;
     virtual void paintAfter(Painter& painter, Text* t_start, size_t index) const;
     virtual void paintMid(Painter& painter, Text* tL, size_t iL, Text* tR, size_t iR) const;
-    virtual void paint(Painter& painter, double xL, double xR) const;
+    virtual void paint(Painter& painter, double xL, double yT, double xR, double yB) const;
     bool contains(double x_test, double y_test) const noexcept;
     bool containsY(double y_test) const noexcept;
     Text* textNearest(double x, double y) const;
@@ -89,6 +91,7 @@ public:
     double x  DEBUG_INIT_STALE;
     double y  DEBUG_INIT_STALE;
     uint8_t script_level;
+    bool size_stale = true;
     #ifndef NDEBUG
     virtual void invalidateWidth() noexcept = 0;
     virtual void invalidateDims() noexcept = 0;
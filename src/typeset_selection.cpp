@@ -29,7 +29,6 @@ namespace Typeset {
 #define pR Selection::right.phrase()
 #define lL pL->asLine()
 #define lR pR->asLine()
-#define getLines lL->lines
 
 Selection::Selection() noexcept {}
 
@@ -134,10 +133,9 @@ bool Selection::operator==(const Selection& other) const noexcept {
         if(sze != other.lR->id - other.lL->id)
             return false;
 
-        const std::vector<Line*>& lines = getLines();
         for(size_t i = 1; i < sze; i++){
-            Line* A_line = lines[ lL->id+i ];
-            Line* B_line = lines[ other.lL->id+i ];
+            Line* A_line = lL->parent->expandedLine(lL->id+i);
+            Line* B_line = other.lL->parent->expandedLine(other.lL->id+i);
             if(!A_line->sameContent(B_line))
                 return false;
         }
@@ -455,9 +453,8 @@ void Selection::searchLines(const std::string& str, std::vector<Selection>& hits
         lL->text(i)->search(str, hits, use_case, word);
     }
 
-    const std::vector<Line*> lines = getLines();
     for(size_t i = lL->id+1; i < lR->id; i++)
-        lines[i]->search(str, hits, use_case, word);
+        lL->parent->expandedLine(i)->search(str, hits, use_case, word);
 
     for(size_t i = 0; i < tR->id; i++){
         lR->text(i)->search(str, hits, use_case, word);
@@ -511,9 +508,8 @@ std::array<double, 4> Selection::getDimensionsLines() const noexcept {
                (lR->id - lL->id)*Model::LINE_VERTICAL_PADDING;
     double w = lL->width;
 
-    const std::vector<Line*> lines = getLines();
     for(size_t i = lL->id+1; i < lR->id; i++){
-        Line* l = lines[i];
+        Line* l = lL->parent->expandedLine(i);
         h += l->height();
         w = std::max(w, l->width);
     }
@@ -697,7 +693,7 @@ void Selection::paintSelectionLines(Painter& painter, double xLeft, double yT, d
     for(; l != lR; l = l->nextAsserted()){
         if(l->y > yB) return;
         painter.drawSelection(l->x, l->y, l->width + NEWLINE_EXTRA, l->height());
-        l->paint(painter, xLeft, xRight);
+        l->paint(painter, xLeft, yT, xRight, yB);
     }
 
     if(iR == 0 && tR == lR->front()) return;
@@ -759,9 +755,8 @@ void Selection::paintErrorLines(Painter& painter) const {
     painter.drawError(x, y, w, h);
     lL->paintAfter(painter, tL, iL);
 
-    const std::vector<Line*> lines = getLines();
     for(size_t i = lL->id+1; i < lR->id; i++){
-        Line* l = lines[i];
+        Line* l = lL->parent->expandedLine(i);
         painter.drawError(l->x, l->y, l->width, l->height());
         l->paint(painter);
     }
@@ -36,6 +36,18 @@ void Subphrase::paint(Painter& painter) const {
     else painter.drawEmptySubphrase(x, y, width, height());
 }
 
+void Subphrase::paint(Painter& painter, double xL, double yT, double xR, double yB) const {
+    if(numTexts() > 1 || !text(0)->empty()) Phrase::paint(painter, xL, yT, xR, yB);
+    else painter.drawEmptySubphrase(x, y, width, height());
+}
+
+void Subphrase::invalidateSize() noexcept {
+    //A stale phrase has already invalidated its ancestors, which stay stale until the next layout
+    if(size_stale) return;
+    size_stale = true;
+    if(parent) parent->invalidateSize();
+}
+
 #ifndef NDEBUG
 void Subphrase::invalidateWidth() noexcept {
     width = STALE;
@@ -15,10 +15,12 @@ public:
     Text* textUp(double setpoint) const noexcept;
     virtual bool isLine() const noexcept override;
     void setParent(Construct* c) noexcept;
-    Construct* parent;
+    Construct* parent = nullptr;
 
     #ifndef FORSCAPE_TYPESET_HEADLESS
     virtual void paint(Painter& painter) const override;
+    virtual void paint(Painter& painter, double xL, double yT, double xR, double yB) const override;
+    virtual void invalidateSize() noexcept override;
     #ifndef NDEBUG
     virtual void invalidateWidth() noexcept override;
     virtual void invalidateDims() noexcept override;
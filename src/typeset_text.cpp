@@ -1,5 +1,6 @@
 #include "typeset_text.h"
 
+#include "forscape_search.h"
 #include "forscape_serial.h"
 #include "forscape_serial_unicode.h"
 #include "forscape_unicode.h"
@@ -15,6 +16,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 
 namespace Forscape {
 
@@ -73,27 +75,42 @@ bool Text::empty() const noexcept {
 
 void Text::setString(std::string_view str) alloc_except {
     this->str = str;
+    invalidateSize();
 }
 
 void Text::setStringAndRemoveEscapes(const char* ch, size_t sze) alloc_except {
     str.clear();
-    for(size_t i = 0; i < sze; i++){
-        if(isUnicodeChar<CONSTRUCT_STRVIEW>(&ch[i])){
-            i += codepointSize(CON_0);
-            assert(isUnicodeChar<CONSTRUCT_STRVIEW>(&ch[i])
-                   || isUnicodeChar<OPEN_STRVIEW>(&ch[i])
-                   || isUnicodeChar<CLOSE_STRVIEW>(&ch[i]));
+    str.reserve(sze);
+
+    //Copy unescaped runs in bulk, only stopping at bytes which may start an escape
+    const char* const end = ch + sze;
+    while(const char* lead = static_cast<const char*>(std::memchr(ch, CON_0, end-ch))){
+        if(isUnicodeChar<CONSTRUCT_STRVIEW>(lead)){
+            str.append(ch, lead);
+            ch = lead + codepointSize(CON_0);
+            assert(isUnicodeChar<CONSTRUCT_STRVIEW>(ch)
+                   || isUnicodeChar<OPEN_STRVIEW>(ch)
+                   || isUnicodeChar<CLOSE_STRVIEW>(ch));
+            str.append(ch, codepointSize(*ch));
+            ch += codepointSize(*ch);
+        }else{
+            str.append(ch, lead+1);
+            ch = lead+1;
         }
-        str += ch[i];
     }
+    str.append(ch, end);
+
+    invalidateSize();
 }
 
 void Text::append(std::string_view appended) alloc_except {
     str += appended;
+    invalidateSize();
 }
 
 void Text::prepend(std::string_view prepended) noexcept {
     str.insert(str.begin(), prepended.cbegin(), prepended.cend());
+    invalidateSize();
 }
 
 void Text::prependSpaces(size_t num_spaces) alloc_except {
@@ -101,6 +118,7 @@ void Text::prependSpaces(size_t num_spaces) alloc_except {
     assert(scriptDepth() == 0);
     #endif
     str.insert(0, num_spaces, ' ');
+    invalidateSize();
 }
 
 void Text::removeLeadingSpaces(size_t num_spaces) noexcept {
@@ -109,6 +127,7 @@ void Text::removeLeadingSpaces(size_t num_spaces) noexcept {
     #endif
     assert(str.substr(0, num_spaces) == std::string(num_spaces, ' '));
     str.erase(0, num_spaces);
+    invalidateSize();
 }
 
 void Text::removeComment() noexcept {
@@ -117,25 +136,30 @@ void Text::removeComment() noexcept {
     #endif
     assert(str.substr(0, 2) == "//");
     str.erase(0, 2);
+    invalidateSize();
 }
 
 void Text::overwrite(size_t start, const std::string& in) alloc_except {
     str.resize(start + in.size());
     std::memcpy(str.data() + start, in.data(), in.size());
+    invalidateSize();
 }
 
 void Text::overwrite(size_t start, std::string_view in) alloc_except {
     str.resize(start + in.size());
     std::memcpy(str.data() + start, in.data(), in.size());
+    invalidateSize();
 }
 
 void Text::insert(size_t start, const std::string& in) alloc_except {
     str.insert(start, in);
+    invalidateSize();
 }
 
 void Text::erase(size_t start, const std::string& out) noexcept {
     assert(view(start, out.size()) == out);
     str.erase(start, out.size());
+    invalidateSize();
 }
 
 std::string_view Text::from(size_t index) const noexcept {
@@ -209,25 +233,21 @@ void Text::search(const std::string& target, std::vector<Selection>& hits, size_
     assert(!target.empty());
     if(target.size() > end-start) return;
 
-    size_t stop = end-target.size();
+    const size_t stop = end-target.size();
+    const size_t first = start;
 
     bool word_front = word && alpha(target.front());
     bool word_back = word && alphaNumeric(target.back());
 
-    //Go to first word
-    if(word_front && !alpha(str[start])) do{ start++; } while(start <= stop && !alpha(str[start]));
-
-    while(start <= stop){
-        if((!word_back || isWordEnd(str, start+target.size())) && equal(target, str, start, use_case)){
+    //Only positions where the first and last characters line up are compared in full
+    while((start = findSearchCandidate(str, start, stop, target, use_case)) <= stop){
+        if((!word_front || start == first || !alpha(str[start-1])) &&
+           (!word_back || isWordEnd(str, start+target.size())) &&
+           equal(target, str, start, use_case)){
             hits.push_back( Selection(this, start, start+target.size()) );
             //Go to after the hit
             start += target.size();
-        }else if(word_front){
-            //Go to the next word
-            do{ start++; } while(start <= stop && alpha(str[start]));
-            do{ start++; } while(start <= stop && !alpha(str[start]));
         }else{
-            //Go to the next character
             start++;
         }
     }
@@ -273,6 +293,13 @@ const char* Text::data() const noexcept {
     return str.data();
 }
 
+void Text::invalidateSize() noexcept {
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    grapheme_index_stale = true;
+    parent->invalidateSize();
+    #endif
+}
+
 Phrase* Text::getParent() const noexcept {
     //Not great to expose this detail, but I can't find a better way, and it should be stable
     return parent;
@@ -398,8 +425,28 @@ double Text::height() const noexcept {
     return CHARACTER_HEIGHTS[scriptDepth()];
 }
 
-double Text::xLocal(size_t index) const noexcept {
-    return CHARACTER_WIDTHS[scriptDepth()] * countGraphemes(std::string_view(str.data(), index));
+void Text::updateGraphemeIndex() const alloc_except {
+    grapheme_starts.clear();
+    plain_ascii = asciiPrefixEnd(str.data(), 0, str.size()) == str.size();
+    leading_zero_width = !plain_ascii && !isAscii(str[0]) && isZeroWidth(codepointInt(str, 0));
+    if(!plain_ascii)
+        for(size_t index = 0; index < str.size(); index += numBytesInGrapheme(str, index))
+            grapheme_starts.push_back(static_cast<uint32_t>(index));
+    grapheme_index_stale = false;
+}
+
+size_t Text::graphemesBefore(size_t index) const alloc_except {
+    assert(index <= str.size());
+    if(grapheme_index_stale) updateGraphemeIndex();
+    if(plain_ascii) return index;
+
+    //A leading zero-width character shares the first grapheme start, but has no width of its own
+    const size_t starts_before = std::lower_bound(grapheme_starts.begin(), grapheme_starts.end(), index) - grapheme_starts.begin();
+    return starts_before - (leading_zero_width && index != 0);
+}
+
+double Text::xLocal(size_t index) const alloc_except {
+    return CHARACTER_WIDTHS[scriptDepth()] * graphemesBefore(index);
 }
 
 double Text::xPhrase(size_t index) const {
@@ -431,25 +478,25 @@ double Text::getWidth() const noexcept {
     return width;
 }
 
-void Text::updateWidth() noexcept {
-    width = CHARACTER_WIDTHS[scriptDepth()] * countGraphemes(str);
+void Text::updateWidth() alloc_except {
+    width = CHARACTER_WIDTHS[scriptDepth()] * graphemesBefore(str.size());
 }
 
 uint8_t Text::scriptDepth() const noexcept {
     return parent->script_level;
 }
 
-size_t Text::charIndexNearest(double x_in) const noexcept {
+size_t Text::charIndexNearest(double x_in) const alloc_except {
     return charIndexLeft(x_in + CHARACTER_WIDTHS[scriptDepth()]/2);
 }
 
-size_t Text::charIndexLeft(double x_in) const noexcept {
+size_t Text::charIndexLeft(double x_in) const alloc_except {
     double grapheme_index = (x_in-x) / CHARACTER_WIDTHS[scriptDepth()];
     if(grapheme_index < 0) return 0;
-    size_t index = 0;
-    for(size_t i = 0; i < static_cast<size_t>(grapheme_index) && index < numChars(); i++)
-        index += numBytesInGrapheme(str, index);
-    return index;
+    const size_t n = static_cast<size_t>(grapheme_index);
+    if(grapheme_index_stale) updateGraphemeIndex();
+    if(plain_ascii) return std::min(n, numChars());
+    return n < grapheme_starts.size() ? grapheme_starts[n] : numChars();
 }
 
 void Text::paint(Painter& painter) const {
@@ -460,7 +507,7 @@ void Text::paint(Painter& painter) const {
     for(const SemanticTag& tag : tags){
         std::string_view substr(&str[start], tag.index-start);
         painter.drawText(x, y, substr);
-        x += char_width * countGraphemes(substr);
+        x += char_width * (graphemesBefore(tag.index) - graphemesBefore(start));
         start = tag.index;
         painter.setType(tag.type);
     }
@@ -475,7 +522,7 @@ void Text::paintUntil(Painter& painter, size_t stop) const {
         if(tag.index >= stop) break;
         std::string_view substr(&str[start], tag.index-start);
         painter.drawText(x, y, substr);
-        x += char_width * countGraphemes(substr);
+        x += char_width * (graphemesBefore(tag.index) - graphemesBefore(start));
         start = tag.index;
         painter.setType(tag.type);
     }
@@ -491,7 +538,7 @@ void Text::paintAfter(Painter& painter, size_t start) const {
         if(tag.index > start){
             std::string_view substr(&str[start], tag.index-start);
             painter.drawText(x, y, substr);
-            x += char_width * countGraphemes(substr);
+            x += char_width * (graphemesBefore(tag.index) - graphemesBefore(start));
             start = tag.index;
             painter.setType(tag.type);
         }
@@ -511,7 +558,7 @@ void Text::paintMid(Painter& painter, size_t start, size_t stop) const {
             if(tag.index >= stop) break;
             std::string_view substr(&str[start], tag.index-start);
             painter.drawText(x, y, substr);
-            x += char_width * countGraphemes(substr);
+            x += char_width * (graphemesBefore(tag.index) - graphemesBefore(start));
             start = tag.index;
             painter.setType(tag.type);
         }
@@ -533,7 +580,7 @@ void Text::paintGrouping(Painter& painter, size_t start) const {
         if(tag.index > start){
             if(tag.index >= stop) break;
             std::string_view substr(&str[start], tag.index-start);
-            double width = char_width * countGraphemes(substr);
+            double width = char_width * (graphemesBefore(tag.index) - graphemesBefore(start));
             painter.drawHighlightedGrouping(x, y, width, substr);
             x += width;
             start = tag.index;
@@ -542,7 +589,7 @@ void Text::paintGrouping(Painter& painter, size_t start) const {
     }
 
     std::string_view substr(&str[start], stop-start);
-    double width = char_width * countGraphemes(substr);
+    double width = char_width * (graphemesBefore(stop) - graphemesBefore(start));
     painter.drawHighlightedGrouping(x, y, width, substr);
 }
 
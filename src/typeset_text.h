@@ -6,6 +6,7 @@
 #include <vector>
 
 #include <forscape_common.h>
+#include "typeset_node_pool.h"
 
 namespace Forscape {
 
@@ -18,7 +19,7 @@ class Selection;
 class Painter;
 class Phrase;
 
-class Text {
+class Text : public PooledNode {
     public:
         #ifdef TYPESET_MEMORY_DEBUG
         static FORSCAPE_UNORDERED_SET<Text*> all;
@@ -96,16 +97,16 @@ class Text {
         double aboveCenter() const noexcept;
         double underCenter() const noexcept;
         double height() const noexcept;
-        double xLocal(size_t index) const noexcept;
+        double xLocal(size_t index) const alloc_except;
         double xPhrase(size_t index) const;
         double xGlobal(size_t index) const;
         double xRight() const noexcept;
         double yBot() const noexcept;
         double getWidth() const noexcept;
-        void updateWidth() noexcept;
+        void updateWidth() alloc_except;
         uint8_t scriptDepth() const noexcept;
-        size_t charIndexNearest(double x_in) const noexcept;
-        size_t charIndexLeft(double x_in) const noexcept;
+        size_t charIndexNearest(double x_in) const alloc_except;
+        size_t charIndexLeft(double x_in) const alloc_except;
         void paint(Painter& painter) const;
         void paintUntil(Painter& painter, size_t stop) const;
         void paintAfter(Painter& painter, size_t start) const;
@@ -135,6 +136,19 @@ class Text {
         #endif
 
     private:
+        void invalidateSize() noexcept;
+
+        #ifndef FORSCAPE_TYPESET_HEADLESS
+        void updateGraphemeIndex() const alloc_except;
+        size_t graphemesBefore(size_t index) const alloc_except;
+
+        //Byte offset of each grapheme, kept only for text which is not plain ASCII. Rebuilt on demand after mutation.
+        mutable std::vector<uint32_t> grapheme_starts;
+        mutable bool grapheme_index_stale = true;
+        mutable bool plain_ascii = true;
+        mutable bool leading_zero_width = false;
+        #endif
+
         Phrase* parent  DEBUG_INIT_NULLPTR;
         double width = 0;
         std::string str;
@@ -15,6 +15,7 @@
 #include <typeset_themes.h>
 
 #include <chrono>
+#include <cmath>
 
 #include <QClipboard>
 #include <QDrag>
@@ -719,7 +720,7 @@ void View::updateModel() noexcept {
 
 void View::goToLine(size_t line_num){
     if(line_num > model->lines.size()) return;
-    controller.setBothToBackOf(model->lines[line_num]->back());
+    controller.setBothToBackOf(model->expandedLine(line_num)->back());
     ensureCursorVisible();
     restartCursorBlink();
     update();
@@ -940,7 +941,8 @@ void View::setCursorAppearance(double x, double y) {
 }
 
 void View::drawModel(double xL, double yT, double xR, double yB) {
-    model->updateLayout();
+    do model->updateLayout(); while(model->expandLinesBetween(yT, yB));
+    updateTextLayer();
 
     Painter painter(qpainter, xL, yT, xR, yB);
     painter.setZoom(zoom);
@@ -988,7 +990,11 @@ void View::drawModel(double xL, double yT, double xR, double yB) {
 
     const Typeset::Marker& cursor = getController().active;
 
-    model->paint(painter, xL, yT, xR, yB);
+    qpainter.save();
+    qpainter.resetTransform();
+    qpainter.drawPixmap(0, 0, text_layer);
+    qpainter.restore();
+
     if(allow_write) model->paintGroupings(painter, cursor);
     controller.paintSelection(painter, xL, yT, xR, yB);
     if(display_commas_in_numbers) model->paintNumberCommas(painter, xL, yT, xR, yB, controller.selection());
@@ -998,6 +1004,77 @@ void View::drawModel(double xL, double yT, double xR, double yB) {
     }
 }
 
+bool View::TextLayerKey::operator==(const TextLayerKey& other) const noexcept {
+    return model == other.model &&
+           revision == other.revision &&
+           zoom == other.zoom &&
+           show_line_nums == other.show_line_nums &&
+           colours == other.colours;
+}
+
+void View::invalidateTextLayer() noexcept {
+    text_layer_key.model = nullptr;
+}
+
+void View::updateTextLayer() {
+    TextLayerKey key;
+    key.model = model;
+    key.revision = model->revision;
+    key.zoom = zoom;
+    key.show_line_nums = show_line_nums;
+    key.colours = getColours();
+
+    const qreal dpr = devicePixelRatioF();
+    const QSize device_size = size() * dpr;
+    const bool reusable = key == text_layer_key && text_layer.size() == device_size && text_layer.devicePixelRatio() == dpr;
+    const int dx = text_layer_h_scroll - h_scroll->value();
+    const int dy = text_layer_v_scroll - v_scroll->value();
+    text_layer_key = key;
+    text_layer_h_scroll = h_scroll->value();
+    text_layer_v_scroll = v_scroll->value();
+
+    if(reusable && dx == 0 && dy == 0) return;
+
+    const int w = width();
+    const int h = height();
+
+    //Scroll steps shift the cached glyphs and only paint the newly exposed strips.
+    //Fractional scaling would shift by partial pixels, so it falls back to a full repaint.
+    if(reusable && dpr == std::floor(dpr) && std::abs(dx) < w && std::abs(dy) < h){
+        text_layer.scroll(static_cast<int>(dx*dpr), static_cast<int>(dy*dpr), text_layer.rect());
+        if(dx > 0) paintTextLayer(QRect(0, 0, dx, h));
+        else if(dx < 0) paintTextLayer(QRect(w+dx, 0, -dx, h));
+        if(dy > 0) paintTextLayer(QRect(0, 0, w, dy));
+        else if(dy < 0) paintTextLayer(QRect(0, h+dy, w, -dy));
+        return;
+    }
+
+    if(text_layer.size() != device_size || text_layer.devicePixelRatio() != dpr){
+        text_layer = QPixmap(device_size);
+        text_layer.setDevicePixelRatio(dpr);
+    }
+    paintTextLayer(rect());
+}
+
+void View::paintTextLayer(const QRect& rect) {
+    QPainter layer_painter(&text_layer);
+    layer_painter.setRenderHints(QPainter::Antialiasing|QPainter::TextAntialiasing);
+    layer_painter.setClipRect(rect);
+    layer_painter.setCompositionMode(QPainter::CompositionMode_Source);
+    layer_painter.fillRect(rect, Qt::transparent);
+    layer_painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+
+    const double xL = xModel(rect.x());
+    const double yT = yModel(rect.y());
+    const double xR = xModel(rect.x() + rect.width());
+    const double yB = yModel(rect.y() + rect.height());
+
+    Painter painter(layer_painter, xL, yT, xR, yB);
+    painter.setZoom(zoom);
+    painter.setOffset(xOrigin(), yOrigin());
+    model->paint(painter, xL, yT, xR, yB);
+}
+
 void View::drawLinebox(double yT, double yB) {
     if(!show_line_nums) return;
 
@@ -1025,7 +1102,7 @@ void View::drawLinebox(double yT, double yB) {
     Line* end = model->nearestLine(yB);
 
     for(size_t i = start->id; i <= end->id; i++){
-        Line*& l = model->lines[i];
+        Line* l = model->expandedLine(i);
         size_t n = l->id+1;
         bool active = (l->id >= iL) & (l->id <= iR);
         painter.drawLineNumber(l->front()->y, n, active);
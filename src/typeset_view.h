@@ -3,8 +3,10 @@
 
 #include "typeset_controller.h"
 #include "typeset_painter.h"
+#include "typeset_themes.h"
 
 #include <QListWidget>
+#include <QPixmap>
 
 #ifdef TEST_QT
 #define TEST_PUBLIC public:
@@ -57,6 +59,7 @@ public:
     std::vector<Typeset::Selection> highlighted_words;
     void updateBackgroundColour() noexcept;
     void updateAfterHighlightChange() noexcept;
+    void invalidateTextLayer() noexcept;
 
     Typeset::Selection search_selection;
 
@@ -78,6 +81,8 @@ protected: TEST_PUBLIC
     void resolveSelectionDrag(double x, double y);
     bool isInLineBox(double x) const noexcept;
     void drawModel(double xL, double yT, double xR, double yB);
+    void updateTextLayer();
+    void paintTextLayer(const QRect& rect);
     void updateXSetpoint() noexcept;
     double xModel(double xScreen) const noexcept;
     double yModel(double yScreen) const noexcept;
@@ -126,6 +131,20 @@ protected: TEST_PUBLIC
     size_t model_undo_stack_size = 0;
     #endif
 
+    //The model text is cached so cursor blinks and scrolling don't repaint every glyph
+    struct TextLayerKey {
+        const Model* model = nullptr;
+        size_t revision = 0;
+        double zoom = 0;
+        bool show_line_nums = false;
+        std::array<QColor, NUM_COLOUR_ROLES> colours;
+        bool operator==(const TextLayerKey& other) const noexcept;
+    };
+    QPixmap text_layer;
+    TextLayerKey text_layer_key;
+    int text_layer_h_scroll = 0;
+    int text_layer_v_scroll = 0;
+
 //Qt specific code
 protected:
     QPainter qpainter;
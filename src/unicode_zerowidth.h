@@ -1,1887 +0,0 @@
-//CODEGEN FILE
-
-#ifndef FORSCAPE_UNICODE_ZEROWIDTH_H
-#define FORSCAPE_UNICODE_ZEROWIDTH_H
-
-#include <forscape_common.h>
-
-namespace Forscape {
-
-inline bool isZeroWidth(uint32_t code) noexcept {
-    switch(code){
-        case 32972:
-        case 33228:
-        case 33484:
-        case 33740:
-        case 33996:
-        case 34252:
-        case 34508:
-        case 34764:
-        case 35020:
-        case 35276:
-        case 35532:
-        case 35788:
-        case 36044:
-        case 36300:
-        case 36556:
-        case 36812:
-        case 37068:
-        case 37324:
-        case 37580:
-        case 37836:
-        case 38092:
-        case 38348:
-        case 38604:
-        case 38860:
-        case 39116:
-        case 39372:
-        case 39628:
-        case 39884:
-        case 40140:
-        case 40396:
-        case 40652:
-        case 40908:
-        case 41164:
-        case 41420:
-        case 41676:
-        case 41932:
-        case 42188:
-        case 42444:
-        case 42700:
-        case 42956:
-        case 43212:
-        case 43468:
-        case 43724:
-        case 43980:
-        case 44236:
-        case 44492:
-        case 44748:
-        case 45004:
-        case 45260:
-        case 45516:
-        case 45772:
-        case 46028:
-        case 46284:
-        case 46540:
-        case 46796:
-        case 47052:
-        case 47308:
-        case 47564:
-        case 47820:
-        case 48076:
-        case 48332:
-        case 48588:
-        case 48844:
-        case 49100:
-        case 32973:
-        case 33229:
-        case 33485:
-        case 33741:
-        case 33997:
-        case 34253:
-        case 34509:
-        case 34765:
-        case 35021:
-        case 35277:
-        case 35533:
-        case 35789:
-        case 36045:
-        case 36301:
-        case 36557:
-        case 36813:
-        case 37069:
-        case 37325:
-        case 37581:
-        case 37837:
-        case 38093:
-        case 38349:
-        case 38605:
-        case 38861:
-        case 39117:
-        case 39373:
-        case 39629:
-        case 39885:
-        case 40141:
-        case 40397:
-        case 40653:
-        case 40909:
-        case 41165:
-        case 41421:
-        case 41677:
-        case 41933:
-        case 42189:
-        case 42445:
-        case 42701:
-        case 42957:
-        case 43213:
-        case 43469:
-        case 43725:
-        case 43981:
-        case 44237:
-        case 44493:
-        case 44749:
-        case 45005:
-        case 33746:
-        case 34002:
-        case 34258:
-        case 34514:
-        case 34770:
-        case 35026:
-        case 35282:
-        case 37334:
-        case 37590:
-        case 37846:
-        case 38102:
-        case 38358:
-        case 38614:
-        case 38870:
-        case 39126:
-        case 39382:
-        case 39638:
-        case 39894:
-        case 40150:
-        case 40406:
-        case 40662:
-        case 40918:
-        case 41174:
-        case 41430:
-        case 41686:
-        case 41942:
-        case 42198:
-        case 42454:
-        case 42710:
-        case 42966:
-        case 43222:
-        case 43478:
-        case 43734:
-        case 43990:
-        case 44246:
-        case 44502:
-        case 44758:
-        case 45014:
-        case 45270:
-        case 45526:
-        case 45782:
-        case 46038:
-        case 46294:
-        case 46550:
-        case 46806:
-        case 47062:
-        case 47318:
-        case 47574:
-        case 47830:
-        case 48086:
-        case 48342:
-        case 48598:
-        case 49110:
-        case 33239:
-        case 33495:
-        case 34007:
-        case 34263:
-        case 34775:
-        case 37080:
-        case 37336:
-        case 37592:
-        case 37848:
-        case 38104:
-        case 38360:
-        case 38616:
-        case 38872:
-        case 39128:
-        case 39384:
-        case 39640:
-        case 35801:
-        case 36057:
-        case 36313:
-        case 36569:
-        case 36825:
-        case 37081:
-        case 37337:
-        case 37593:
-        case 37849:
-        case 38105:
-        case 38361:
-        case 38617:
-        case 38873:
-        case 39129:
-        case 39385:
-        case 39641:
-        case 39897:
-        case 40153:
-        case 40409:
-        case 40665:
-        case 40921:
-        case 45273:
-        case 38619:
-        case 38875:
-        case 39131:
-        case 39387:
-        case 39643:
-        case 39899:
-        case 40155:
-        case 40923:
-        case 41179:
-        case 41435:
-        case 41691:
-        case 41947:
-        case 42203:
-        case 42971:
-        case 43227:
-        case 43739:
-        case 43995:
-        case 44251:
-        case 44507:
-        case 37340:
-        case 45276:
-        case 45532:
-        case 45788:
-        case 46044:
-        case 46300:
-        case 46556:
-        case 46812:
-        case 47068:
-        case 47324:
-        case 47580:
-        case 47836:
-        case 48092:
-        case 48348:
-        case 48604:
-        case 48860:
-        case 49116:
-        case 32989:
-        case 33245:
-        case 33501:
-        case 33757:
-        case 34013:
-        case 34269:
-        case 34525:
-        case 34781:
-        case 35037:
-        case 35293:
-        case 35549:
-        case 42718:
-        case 42974:
-        case 43230:
-        case 43486:
-        case 43742:
-        case 43998:
-        case 44254:
-        case 44510:
-        case 44766:
-        case 45022:
-        case 45278:
-        case 43999:
-        case 44255:
-        case 44511:
-        case 44767:
-        case 45023:
-        case 45279:
-        case 45535:
-        case 45791:
-        case 46047:
-        case 48607:
-        case 9871584:
-        case 9937120:
-        case 10002656:
-        case 10068192:
-        case 10199264:
-        case 10264800:
-        case 10330336:
-        case 10395872:
-        case 10461408:
-        case 10526944:
-        case 10592480:
-        case 10658016:
-        case 10723552:
-        case 10854624:
-        case 10920160:
-        case 10985696:
-        case 11116768:
-        case 11182304:
-        case 11247840:
-        case 11313376:
-        case 11378912:
-        case 10068448:
-        case 10133984:
-        case 10199520:
-        case 9675744:
-        case 9741280:
-        case 9806816:
-        case 9872352:
-        case 9937888:
-        case 10003424:
-        case 10068960:
-        case 10134496:
-        case 10200032:
-        case 10265568:
-        case 10331104:
-        case 10396640:
-        case 10462176:
-        case 10527712:
-        case 10593248:
-        case 10724320:
-        case 10789856:
-        case 10855392:
-        case 10920928:
-        case 10986464:
-        case 11052000:
-        case 11117536:
-        case 11183072:
-        case 11248608:
-        case 11314144:
-        case 11379680:
-        case 11445216:
-        case 11510752:
-        case 11576288:
-        case 11641824:
-        case 11707360:
-        case 11772896:
-        case 11838432:
-        case 11903968:
-        case 11969504:
-        case 12035040:
-        case 12100576:
-        case 12166112:
-        case 12231648:
-        case 12297184:
-        case 12362720:
-        case 12428256:
-        case 12493792:
-        case 12559328:
-        case 8430816:
-        case 8496352:
-        case 8561888:
-        case 12231904:
-        case 12362976:
-        case 8496608:
-        case 8562144:
-        case 8627680:
-        case 8693216:
-        case 8758752:
-        case 8824288:
-        case 8889824:
-        case 8955360:
-        case 9283040:
-        case 9545184:
-        case 9610720:
-        case 9676256:
-        case 9741792:
-        case 9807328:
-        case 9872864:
-        case 9938400:
-        case 10659296:
-        case 10724832:
-        case 8496864:
-        case 12363488:
-        case 8497120:
-        case 8562656:
-        case 8628192:
-        case 8693728:
-        case 9283552:
-        case 10659808:
-        case 10725344:
-        case 12494816:
-        case 8497376:
-        case 8562912:
-        case 12364000:
-        case 8497632:
-        case 8563168:
-        case 8890848:
-        case 8956384:
-        case 9152992:
-        case 9218528:
-        case 9284064:
-        case 9546208:
-        case 11577824:
-        case 11643360:
-        case 11905504:
-        case 8497888:
-        case 8563424:
-        case 12364512:
-        case 8498144:
-        case 8563680:
-        case 8629216:
-        case 8694752:
-        case 8760288:
-        case 8891360:
-        case 8956896:
-        case 9284576:
-        case 10660832:
-        case 10726368:
-        case 12233696:
-        case 12299232:
-        case 12364768:
-        case 12430304:
-        case 12495840:
-        case 12561376:
-        case 8498400:
-        case 12365024:
-        case 12561632:
-        case 8498656:
-        case 8564192:
-        case 8629728:
-        case 8695264:
-        case 9285088:
-        case 9809376:
-        case 9874912:
-        case 10661344:
-        case 10726880:
-        case 8564448:
-        case 8433632:
-        case 9285600:
-        case 8433888:
-        case 8696032:
-        case 12497120:
-        case 12562656:
-        case 8434144:
-        case 8827360:
-        case 8892896:
-        case 8958432:
-        case 9089504:
-        case 9155040:
-        case 9220576:
-        case 9286112:
-        case 9810400:
-        case 9875936:
-        case 10662368:
-        case 10727904:
-        case 8499936:
-        case 12366560:
-        case 12563168:
-        case 8827872:
-        case 9221088:
-        case 9286624:
-        case 10662880:
-        case 10728416:
-        case 8434912:
-        case 8500448:
-        case 12301536:
-        case 12367072:
-        case 8500704:
-        case 8566240:
-        case 8631776:
-        case 8697312:
-        case 9287136:
-        case 10663392:
-        case 10728928:
-        case 8500960:
-        case 9091040:
-        case 9615328:
-        case 9680864:
-        case 9746400:
-        case 9877472:
-        case 11647200:
-        case 11843808:
-        case 11909344:
-        case 11974880:
-        case 12040416:
-        case 12105952:
-        case 12171488:
-        case 12237024:
-        case 8894944:
-        case 8960480:
-        case 9026016:
-        case 9091552:
-        case 9157088:
-        case 9222624:
-        case 9288160:
-        case 9353696:
-        case 11647712:
-        case 11844320:
-        case 11909856:
-        case 11975392:
-        case 12040928:
-        case 12106464:
-        case 12172000:
-        case 12237536:
-        case 12303072:
-        case 12368608:
-        case 8960992:
-        case 9026528:
-        case 9092064:
-        case 9157600:
-        case 9223136:
-        case 9288672:
-        case 10009824:
-        case 10075360:
-        case 11910368:
-        case 12041440:
-        case 12172512:
-        case 11648480:
-        case 11714016:
-        case 11779552:
-        case 11845088:
-        case 11910624:
-        case 11976160:
-        case 12041696:
-        case 12107232:
-        case 12172768:
-        case 12238304:
-        case 12303840:
-        case 12369376:
-        case 12434912:
-        case 12500448:
-        case 8437472:
-        case 8503008:
-        case 8568544:
-        case 8634080:
-        case 8699616:
-        case 8830688:
-        case 8896224:
-        case 9289440:
-        case 9354976:
-        case 9420512:
-        case 9486048:
-        case 9551584:
-        case 9617120:
-        case 9682656:
-        case 9748192:
-        case 9813728:
-        case 9879264:
-        case 9944800:
-        case 10075872:
-        case 10141408:
-        case 10206944:
-        case 10272480:
-        case 10338016:
-        case 10403552:
-        case 10469088:
-        case 10534624:
-        case 10600160:
-        case 10665696:
-        case 10731232:
-        case 10796768:
-        case 10862304:
-        case 10927840:
-        case 10993376:
-        case 11058912:
-        case 11124448:
-        case 11189984:
-        case 11255520:
-        case 11321056:
-        case 11386592:
-        case 11452128:
-        case 11517664:
-        case 11583200:
-        case 11648736:
-        case 11714272:
-        case 11779808:
-        case 11845344:
-        case 11910880:
-        case 11976416:
-        case 12041952:
-        case 12107488:
-        case 12173024:
-        case 12238560:
-        case 12304096:
-        case 12369632:
-        case 8830944:
-        case 11370721:
-        case 11436257:
-        case 11501793:
-        case 11567329:
-        case 11698401:
-        case 11763937:
-        case 11829473:
-        case 11895009:
-        case 11960545:
-        case 12026081:
-        case 12157153:
-        case 12222689:
-        case 12419297:
-        case 12484833:
-        case 9994721:
-        case 10060257:
-        case 10387937:
-        case 10453473:
-        case 10519009:
-        case 11633121:
-        case 11698657:
-        case 11764193:
-        case 11829729:
-        case 8553185:
-        case 8749793:
-        case 8815329:
-        case 9274081:
-        case 10322657:
-        case 10325473:
-        case 10391009:
-        case 10456545:
-        case 9608417:
-        case 9673953:
-        case 9739489:
-        case 11705569:
-        case 11771105:
-        case 11836641:
-        case 9608673:
-        case 9674209:
-        case 11705825:
-        case 11771361:
-        case 11837153:
-        case 11902689:
-        case 12033761:
-        case 12099297:
-        case 12164833:
-        case 12230369:
-        case 12295905:
-        case 12361441:
-        case 12426977:
-        case 8822753:
-        case 9019361:
-        case 9084897:
-        case 9150433:
-        case 9215969:
-        case 9281505:
-        case 9347041:
-        case 9412577:
-        case 9478113:
-        case 9543649:
-        case 9609185:
-        case 9674721:
-        case 10330081:
-        case 9150689:
-        case 9216225:
-        case 9281761:
-        case 8757985:
-        case 8823521:
-        case 11117281:
-        case 10527969:
-        case 10593505:
-        case 10659041:
-        case 10986721:
-        case 11052257:
-        case 11707617:
-        case 12166369:
-        case 12231905:
-        case 12297441:
-        case 9939169:
-        case 10004705:
-        case 10201313:
-        case 9873889:
-        case 10004961:
-        case 10070497:
-        case 10136033:
-        case 10201569:
-        case 10267105:
-        case 10332641:
-        case 10398177:
-        case 10529249:
-        case 10660321:
-        case 10856929:
-        case 10922465:
-        case 10988001:
-        case 11053537:
-        case 11119073:
-        case 11184609:
-        case 11250145:
-        case 11315681:
-        case 11774433:
-        case 11839969:
-        case 11905505:
-        case 11971041:
-        case 12036577:
-        case 12102113:
-        case 12167649:
-        case 12233185:
-        case 12298721:
-        case 12364257:
-        case 12560865:
-        case 11578081:
-        case 11643617:
-        case 11709153:
-        case 11774689:
-        case 11840225:
-        case 11905761:
-        case 11971297:
-        case 12036833:
-        case 12102369:
-        case 12167905:
-        case 12233441:
-        case 12298977:
-        case 12364513:
-        case 12430049:
-        case 12495585:
-        case 12561121:
-        case 8432609:
-        case 8432865:
-        case 8498401:
-        case 8563937:
-        case 8629473:
-        case 11840737:
-        case 11971809:
-        case 12037345:
-        case 12102881:
-        case 12168417:
-        case 12233953:
-        case 12365025:
-        case 8564193:
-        case 11251169:
-        case 11316705:
-        case 11382241:
-        case 11447777:
-        case 11513313:
-        case 11578849:
-        case 11644385:
-        case 11709921:
-        case 11775457:
-        case 8433377:
-        case 8498913:
-        case 10661601:
-        case 10727137:
-        case 10792673:
-        case 10858209:
-        case 11054817:
-        case 11120353:
-        case 11251425:
-        case 11316961:
-        case 11382497:
-        case 10924001:
-        case 11055073:
-        case 11120609:
-        case 11382753:
-        case 11513825:
-        case 11579361:
-        case 11644897:
-        case 11317473:
-        case 11383009:
-        case 11448545:
-        case 11514081:
-        case 11579617:
-        case 11645153:
-        case 11710689:
-        case 11776225:
-        case 11972833:
-        case 12038369:
-        case 9483233:
-        case 9548769:
-        case 9614305:
-        case 9745377:
-        case 9810913:
-        case 9876449:
-        case 9941985:
-        case 10007521:
-        case 10073057:
-        case 10138593:
-        case 10204129:
-        case 10269665:
-        case 10335201:
-        case 10400737:
-        case 10466273:
-        case 10531809:
-        case 10662881:
-        case 10728417:
-        case 10793953:
-        case 10859489:
-        case 10925025:
-        case 10990561:
-        case 11056097:
-        case 11383777:
-        case 11842529:
-        case 12104673:
-        case 12170209:
-        case 8435681:
-        case 8501217:
-        case 8566753:
-        case 8632289:
-        case 8697825:
-        case 8763361:
-        case 8828897:
-        case 8894433:
-        case 8959969:
-        case 9025505:
-        case 9091041:
-        case 9156577:
-        case 9222113:
-        case 9287649:
-        case 9353185:
-        case 9418721:
-        case 9484257:
-        case 9549793:
-        case 9615329:
-        case 9680865:
-        case 9746401:
-        case 9811937:
-        case 9877473:
-        case 9943009:
-        case 10008545:
-        case 10074081:
-        case 10139617:
-        case 10205153:
-        case 10270689:
-        case 10336225:
-        case 10401761:
-        case 10467297:
-        case 10532833:
-        case 10598369:
-        case 10663905:
-        case 10729441:
-        case 10794977:
-        case 10860513:
-        case 10926049:
-        case 10991585:
-        case 11057121:
-        case 11122657:
-        case 11188193:
-        case 11253729:
-        case 11319265:
-        case 11384801:
-        case 11450337:
-        case 11515873:
-        case 11581409:
-        case 11646945:
-        case 11712481:
-        case 11778017:
-        case 11843553:
-        case 11909089:
-        case 11974625:
-        case 12040161:
-        case 12105697:
-        case 12171233:
-        case 12302305:
-        case 12367841:
-        case 12433377:
-        case 12498913:
-        case 12564449:
-        case 9142498:
-        case 9208034:
-        case 9273570:
-        case 9339106:
-        case 9404642:
-        case 11043042:
-        case 11108578:
-        case 11174114:
-        case 11239650:
-        case 11305186:
-        case 11370722:
-        case 11436258:
-        case 10519010:
-        case 10584546:
-        case 10650082:
-        case 10715618:
-        case 9470946:
-        case 9536482:
-        case 9602018:
-        case 9667554:
-        case 9733090:
-        case 9798626:
-        case 9864162:
-        case 9929698:
-        case 9995234:
-        case 10060770:
-        case 10126306:
-        case 10191842:
-        case 10257378:
-        case 10322914:
-        case 10388450:
-        case 10453986:
-        case 10519522:
-        case 10585058:
-        case 10650594:
-        case 10716130:
-        case 10781666:
-        case 10847202:
-        case 10912738:
-        case 10978274:
-        case 11043810:
-        case 11109346:
-        case 11174882:
-        case 11240418:
-        case 11305954:
-        case 11371490:
-        case 11437026:
-        case 11502562:
-        case 11568098:
-        case 11514850:
-        case 11580386:
-        case 11645922:
-        case 12563938:
-        case 10532834:
-        case 10598370:
-        case 10663906:
-        case 10729442:
-        case 10794978:
-        case 10860514:
-        case 10926050:
-        case 10991586:
-        case 11057122:
-        case 11122658:
-        case 11188194:
-        case 11253730:
-        case 11319266:
-        case 11384802:
-        case 11450338:
-        case 11515874:
-        case 11581410:
-        case 11646946:
-        case 11712482:
-        case 11778018:
-        case 11843554:
-        case 11909090:
-        case 11974626:
-        case 12040162:
-        case 12105698:
-        case 12171234:
-        case 12236770:
-        case 12302306:
-        case 12367842:
-        case 12433378:
-        case 12498914:
-        case 12564450:
-        case 11174115:
-        case 11239651:
-        case 11305187:
-        case 11370723:
-        case 10060515:
-        case 10126051:
-        case 11508202:
-        case 11573738:
-        case 11639274:
-        case 11704810:
-        case 11835882:
-        case 11901418:
-        case 11966954:
-        case 12032490:
-        case 12098026:
-        case 12163562:
-        case 12229098:
-        case 12294634:
-        case 12360170:
-        case 12425706:
-        case 10394346:
-        case 10459882:
-        case 11574250:
-        case 11639786:
-        case 8560874:
-        case 8823018:
-        case 9150698:
-        case 10854634:
-        case 10920170:
-        case 11313386:
-        case 8692714:
-        case 8758250:
-        case 10527722:
-        case 10593258:
-        case 10658794:
-        case 10724330:
-        case 10789866:
-        case 10855402:
-        case 10920938:
-        case 10986474:
-        case 11052010:
-        case 11117546:
-        case 11183082:
-        case 11248618:
-        case 11314154:
-        case 11379690:
-        case 11445226:
-        case 11510762:
-        case 11576298:
-        case 11641834:
-        case 12559338:
-        case 10921194:
-        case 10986730:
-        case 11052266:
-        case 11117802:
-        case 11183338:
-        case 11248874:
-        case 11314410:
-        case 11379946:
-        case 8889834:
-        case 8955370:
-        case 9020906:
-        case 9086442:
-        case 9151978:
-        case 9217514:
-        case 9283050:
-        case 9348586:
-        case 9414122:
-        case 9479658:
-        case 9545194:
-        case 8431338:
-        case 8496874:
-        case 8562410:
-        case 11773674:
-        case 11970282:
-        case 12035818:
-        case 12101354:
-        case 12166890:
-        case 12363498:
-        case 12429034:
-        case 10856426:
-        case 11118826:
-        case 11184362:
-        case 11249898:
-        case 11315434:
-        case 11380970:
-        case 11446506:
-        case 11643114:
-        case 11708650:
-        case 11905258:
-        case 11970794:
-        case 8628714:
-        case 9218538:
-        case 12364266:
-        case 11578090:
-        case 11709162:
-        case 11774698:
-        case 11840234:
-        case 12036842:
-        case 12102378:
-        case 12495594:
-        case 12561130:
-        case 8498154:
-        case 11316202:
-        case 11381738:
-        case 11971562:
-        case 10858474:
-        case 11055082:
-        case 11382762:
-        case 10398959:
-        case 8435951:
-        case 8501487:
-        case 8567023:
-        case 8632559:
-        case 8698095:
-        case 8763631:
-        case 8829167:
-        case 8894703:
-        case 8960239:
-        case 9025775:
-        case 9091311:
-        case 9156847:
-        case 9222383:
-        case 9287919:
-        case 9353455:
-        case 9418991:
-        case 10533103:
-        case 10598639:
-        case 10664175:
-        case 10729711:
-        case 10795247:
-        case 10860783:
-        case 10926319:
-        case 10991855:
-        case 11057391:
-        case 11122927:
-        case 11188463:
-        case 11253999:
-        case 11319535:
-        case 11385071:
-        case 11450607:
-        case 11516143:
-        case 3179778288:
-        case 2693501168:
-        case 3062730992:
-        case 3079508208:
-        case 3096285424:
-        case 3113062640:
-        case 3129839856:
-        case 2175308016:
-        case 2192085232:
-        case 2208862448:
-        case 2242416880:
-        case 2259194096:
-        case 2359857392:
-        case 2376634608:
-        case 2393411824:
-        case 2410189040:
-        case 3098054896:
-        case 3114832112:
-        case 3131609328:
-        case 3215495408:
-        case 2779484400:
-        case 2796261616:
-        case 2763297008:
-        case 2780074224:
-        case 2796851440:
-        case 2813628656:
-        case 2881130736:
-        case 2897907952:
-        case 2260570352:
-        case 2277347568:
-        case 2294124784:
-        case 2310902000:
-        case 2327679216:
-        case 2344456432:
-        case 2361233648:
-        case 2378010864:
-        case 2394788080:
-        case 2411565296:
-        case 2428342512:
-        case 2172686832:
-        case 3095433712:
-        case 3112210928:
-        case 3128988144:
-        case 3145765360:
-        case 3162542576:
-        case 3179319792:
-        case 3196097008:
-        case 3212874224:
-        case 2155975152:
-        case 2172752368:
-        case 2189529584:
-        case 2206306800:
-        case 2223084016:
-        case 2239861232:
-        case 2256638448:
-        case 3212939760:
-        case 2156040688:
-        case 2172817904:
-        case 3011678704:
-        case 3028455920:
-        case 3045233136:
-        case 3062010352:
-        case 3112342000:
-        case 3129119216:
-        case 2156171760:
-        case 2172948976:
-        case 2189726192:
-        case 2810483184:
-        case 2827260400:
-        case 2844037616:
-        case 2860814832:
-        case 2877592048:
-        case 2911146480:
-        case 2927923696:
-        case 2944700912:
-        case 2961478128:
-        case 2978255344:
-        case 2995032560:
-        case 3011809776:
-        case 3028586992:
-        case 3011875312:
-        case 2156302832:
-        case 2173080048:
-        case 3062272496:
-        case 3079049712:
-        case 3095826928:
-        case 3112604144:
-        case 3129381360:
-        case 3146158576:
-        case 3162935792:
-        case 3179713008:
-        case 3196490224:
-        case 2307363312:
-        case 2324140528:
-        case 2340917744:
-        case 2357694960:
-        case 2408026608:
-        case 2944963056:
-        case 2961740272:
-        case 2978517488:
-        case 3028849136:
-        case 3062403568:
-        case 3079180784:
-        case 3196621296:
-        case 2676724208:
-        case 2743833072:
-        case 2760610288:
-        case 2777387504:
-        case 2794164720:
-        case 2810941936:
-        case 2827719152:
-        case 2844496368:
-        case 2861273584:
-        case 2156696048:
-        case 2173473264:
-        case 3146551792:
-        case 3163329008:
-        case 2156761584:
-        case 2794295792:
-        case 2811073008:
-        case 2827850224:
-        case 2844627440:
-        case 2861404656:
-        case 2878181872:
-        case 2894959088:
-        case 2962067952:
-        case 2978845168:
-        case 2995622384:
-        case 3012399600:
-        case 3029176816:
-        case 3096482288:
-        case 3113259504:
-        case 3130036720:
-        case 3146813936:
-        case 3163591152:
-        case 3180368368:
-        case 3197145584:
-        case 3213922800:
-        case 2190578160:
-        case 2207355376:
-        case 2224132592:
-        case 2257687024:
-        case 2660340208:
-        case 3012727280:
-        case 3029504496:
-        case 3046281712:
-        case 3063058928:
-        case 3079836144:
-        case 3096613360:
-        case 3130167792:
-        case 3214053872:
-        case 2157154800:
-        case 2190709232:
-        case 2207486448:
-        case 2996212208:
-        case 3012989424:
-        case 3029766640:
-        case 3046543856:
-        case 3163984368:
-        case 3180761584:
-        case 3214316016:
-        case 2157416944:
-        case 2627178992:
-        case 2643956208:
-        case 3013120496:
-        case 3029897712:
-        case 3046674928:
-        case 3063452144:
-        case 3080229360:
-        case 3097006576:
-        case 3113783792:
-        case 3130561008:
-        case 3180892656:
-        case 3214447088:
-        case 2157548016:
-        case 2879033840:
-        case 2912588272:
-        case 2962919920:
-        case 2979697136:
-        case 2996474352:
-        case 3013251568:
-        case 3030028784:
-        case 3046806000:
-        case 3080360432:
-        case 2644283888:
-        case 2661061104:
-        case 2677838320:
-        case 2728169968:
-        case 2744947184:
-        case 2761724400:
-        case 2778501616:
-        case 2812056048:
-        case 2828833264:
-        case 2845610480:
-        case 2862387696:
-        case 2879164912:
-        case 2946535920:
-        case 2963313136:
-        case 2980090352:
-        case 2996867568:
-        case 3013644784:
-        case 3030422000:
-        case 3047199216:
-        case 3063976432:
-        case 3080753648:
-        case 3114308080:
-        case 3131085296:
-        case 3148124656:
-        case 3164901872:
-        case 3198456304:
-        case 2208666096:
-        case 2494009840:
-        case 2510787056:
-        case 2527564272:
-        case 2544341488:
-        case 2594673136:
-        case 2611450352:
-        case 2695336432:
-        case 2175308272:
-        case 2192085488:
-        case 2208862704:
-        case 2225639920:
-        case 2242417136:
-        case 2259194352:
-        case 2275971568:
-        case 2292748784:
-        case 2309526000:
-        case 2326303216:
-        case 3014169072:
-        case 3030946288:
-        case 3047723504:
-        case 3064500720:
-        case 3081277936:
-        case 3098055152:
-        case 3148386800:
-        case 3165164016:
-        case 3181941232:
-        case 3198718448:
-        case 2276037104:
-        case 2443809264:
-        case 2460586480:
-        case 2477363696:
-        case 2494140912:
-        case 2510918128:
-        case 2527695344:
-        case 2578026992:
-        case 2594804208:
-        case 2611581424:
-        case 2326434288:
-        case 2343211504:
-        case 2359988720:
-        case 2376765936:
-        case 2393543152:
-        case 2410320368:
-        case 2427097584:
-        case 2443874800:
-        case 2460652016:
-        case 2477429232:
-        case 2494206448:
-        case 2510983664:
-        case 2527760880:
-        case 2561315312:
-        case 2578092528:
-        case 2964361712:
-        case 2981138928:
-        case 2997916144:
-        case 3014693360:
-        case 3031470576:
-        case 3048247792:
-        case 3065025008:
-        case 3098579440:
-        case 3115356656:
-        case 3132133872:
-        case 3148911088:
-        case 3165688304:
-        case 3182465520:
-        case 3216019952:
-        case 2461176304:
-        case 2477953520:
-        case 2494730736:
-        case 2511507952:
-        case 2528285168:
-        case 2545062384:
-        case 2561839600:
-        case 2578616816:
-        case 2595394032:
-        case 2612171248:
-        case 2628948464:
-        case 2645725680:
-        case 2662502896:
-        case 2679280112:
-        case 2696057328:
-        case 2712834544:
-        case 2729611760:
-        case 2746388976:
-        case 2763166192:
-        case 2779943408:
-        case 2796720624:
-        case 2813497840:
-        case 2863829488:
-        case 2880606704:
-        case 2897383920:
-        case 2914161136:
-        case 2930938352:
-        case 2947715568:
-        case 2964492784:
-        case 2998047216:
-        case 3014824432:
-        case 3048378864:
-        case 3065156080:
-        case 2981401072:
-        case 2998178288:
-        case 3014955504:
-        case 3031732720:
-        case 3048509936:
-        case 3065287152:
-        case 3132396016:
-        case 3165950448:
-        case 3182727664:
-        case 3216282096:
-        case 2159383024:
-        case 2176160240:
-        case 2192937456:
-        case 2209714672:
-        case 2226491888:
-        case 2243269104:
-        case 2276823536:
-        case 2427884016:
-        case 2444661232:
-        case 2511770096:
-        case 2545324528:
-        case 3015414256:
-        case 3032191472:
-        case 2964035312:
-        case 2980812528:
-        case 2997589744:
-        case 3014366960:
-        case 3031144176:
-        case 2964100848:
-        case 2980878064:
-        case 2997655280:
-        case 3014432496:
-        case 3031209712:
-        case 3047986928:
-        case 3064764144:
-        case 2411566832:
-        case 2411632368:
-        case 2428409584:
-        case 2445186800:
-        case 2461964016:
-        case 2764019440:
-        case 2645728240:
-        case 2662505456:
-        case 2810551792:
-        case 2827329008:
-        case 2844106224:
-        case 3146096112:
-        case 3162873328:
-        case 3179650544:
-        case 3196427760:
-        case 3213204976:
-        case 2156305904:
-        case 2173083120:
-        case 2189860336:
-        case 2240191984:
-        case 2256969200:
-        case 2273746416:
-        case 2290523632:
-        case 2307300848:
-        case 2324078064:
-        case 2340855280:
-        case 2860948976:
-        case 2877726192:
-        case 2894503408:
-        case 2911280624:
-        case 2190056944:
-        case 2206834160:
-        case 2223611376:
-        case 2158534128:
-        case 2175311344:
-        case 2192088560:
-        case 2208865776:
-        case 2225642992:
-        case 2242420208:
-        case 2259197424:
-        case 2275974640:
-        case 2292751856:
-        case 2309529072:
-        case 2326306288:
-        case 2343083504:
-        case 2359860720:
-        case 2376637936:
-        case 2393415152:
-        case 2410192368:
-        case 2426969584:
-        case 2443746800:
-        case 2460524016:
-        case 2477301232:
-        case 2494078448:
-        case 2510855664:
-        case 2527632880:
-        case 2544410096:
-        case 2561187312:
-        case 2577964528:
-        case 2594741744:
-        case 2611518960:
-        case 2628296176:
-        case 2645073392:
-        case 2661850608:
-        case 2678627824:
-        case 2695405040:
-        case 2712182256:
-        case 2728959472:
-        case 2745736688:
-        case 2762513904:
-        case 2779291120:
-        case 2796068336:
-        case 2812845552:
-        case 2829622768:
-        case 2846399984:
-        case 2863177200:
-        case 2879954416:
-        case 2896731632:
-        case 2913508848:
-        case 2930286064:
-        case 2947063280:
-        case 2963840496:
-        case 2980617712:
-        case 2997394928:
-        case 3014172144:
-        case 3030949360:
-        case 3047726576:
-        case 3064503792:
-        case 3148389872:
-        case 3165167088:
-        case 3181944304:
-        case 3198721520:
-        case 3215498736:
-        case 2158599664:
-        case 2175376880:
-        case 2192154096:
-        case 2208931312:
-        case 2225708528:
-        case 2242485744:
-        case 2259262960:
-        case 2276040176:
-        case 2292817392:
-        case 2309594608:
-        case 2326371824:
-        case 2343149040:
-        case 2359926256:
-        case 2376703472:
-        case 2393480688:
-        case 2410257904:
-        case 2427035120:
-        case 2443812336:
-        case 2460589552:
-        case 2477366768:
-        case 2494143984:
-        case 2510921200:
-        case 2527698416:
-        case 2544475632:
-        case 2561252848:
-        case 2578030064:
-        case 2594807280:
-        case 2611584496:
-        case 2628361712:
-        case 2645138928:
-        case 2661916144:
-        case 2678693360:
-        case 2695470576:
-        case 2712247792:
-        case 2729025008:
-        case 2745802224:
-        case 2762579440:
-        case 2779356656:
-        case 2796133872:
-        case 2812911088:
-        case 2829688304:
-        case 2846465520:
-        case 2863242736:
-        case 2880019952:
-        case 2896797168:
-        case 3047792112:
-        case 2225774064:
-        case 2611650032:
-        case 2628427248:
-        case 2645204464:
-        case 2661981680:
-        case 2678758896:
-        case 2712313328:
-        case 2729090544:
-        case 2745867760:
-        case 2762644976:
-        case 2779422192:
-        case 2796199408:
-        case 2812976624:
-        case 2829753840:
-        case 2846531056:
-        case 2863308272:
-        case 2880085488:
-        case 2896862704:
-        case 2913639920:
-        case 2930417136:
-        case 2947194352:
-        case 2155912944:
-        case 2172690160:
-        case 2189467376:
-        case 2206244592:
-        case 2223021808:
-        case 2239799024:
-        case 2256576240:
-        case 2290130672:
-        case 2306907888:
-        case 2323685104:
-        case 2340462320:
-        case 2357239536:
-        case 2374016752:
-        case 2390793968:
-        case 2407571184:
-        case 2424348400:
-        case 2441125616:
-        case 2457902832:
-        case 2474680048:
-        case 2491457264:
-        case 2508234480:
-        case 2525011696:
-        case 2541788912:
-        case 2558566128:
-        case 2608897776:
-        case 2625674992:
-        case 2642452208:
-        case 2659229424:
-        case 2676006640:
-        case 2692783856:
-        case 2709561072:
-        case 2743115504:
-        case 2759892720:
-        case 2793447152:
-        case 2810224368:
-        case 2827001584:
-        case 2843778800:
-        case 2860556016:
-        case 2961481456:
-        case 2978258672:
-        case 2995035888:
-        case 3011813104:
-        case 3028590320:
-        case 3045367536:
-        case 3062144752:
-        case 2894831344:
-        case 2911608560:
-        case 2928385776:
-        case 2945162992:
-        case 2426642160:
-        case 2443419376:
-        case 2460196592:
-        case 2476973808:
-        case 2493751024:
-        case 2510528240:
-        case 2527305456:
-        case 2225446640:
-        case 2242223856:
-        case 2259001072:
-        case 2275778288:
-        case 2292555504:
-        case 2309332720:
-        case 2326109936:
-        case 2156175603:
-        case 2172952819:
-        case 2189730035:
-        case 2206507251:
-        case 2223284467:
-        case 2240061683:
-        case 2256838899:
-        case 2273616115:
-        case 2290393331:
-        case 2307170547:
-        case 2323947763:
-        case 2340724979:
-        case 2357502195:
-        case 2374279411:
-        case 2391056627:
-        case 2407833843:
-        case 2424611059:
-        case 2441388275:
-        case 2458165491:
-        case 2474942707:
-        case 2491719923:
-        case 2508497139:
-        case 2525274355:
-        case 2542051571:
-        case 2558828787:
-        case 2575606003:
-        case 2592383219:
-        case 2609160435:
-        case 2625937651:
-        case 2642714867:
-        case 2659492083:
-        case 2676269299:
-        case 2693046515:
-        case 2709823731:
-        case 2726600947:
-        case 2743378163:
-        case 2760155379:
-        case 2776932595:
-        case 2793709811:
-        case 2810487027:
-        case 2827264243:
-        case 2844041459:
-        case 2860818675:
-        case 2877595891:
-        case 2894373107:
-        case 2911150323:
-        case 2927927539:
-        case 2944704755:
-        case 2961481971:
-        case 2978259187:
-        case 2995036403:
-        case 3011813619:
-        case 3028590835:
-        case 3045368051:
-        case 3062145267:
-        case 3078922483:
-        case 3095699699:
-        case 3112476915:
-        case 3129254131:
-        case 3146031347:
-        case 3162808563:
-        case 3179585779:
-        case 3196362995:
-        case 3213140211:
-        case 2156241139:
-        case 2173018355:
-        case 2189795571:
-        case 2206572787:
-        case 2223350003:
-        case 2240127219:
-        case 2256904435:
-        case 2273681651:
-        case 2290458867:
-        case 2307236083:
-        case 2324013299:
-        case 2340790515:
-        case 2357567731:
-        case 2374344947:
-        case 2391122163:
-        case 2407899379:
-        case 2424676595:
-        case 2441453811:
-        case 2458231027:
-        case 2475008243:
-        case 2491785459:
-        case 2508562675:
-        case 2525339891:
-        case 2542117107:
-        case 2558894323:
-        case 2575671539:
-        case 2592448755:
-        case 2609225971:
-        case 2626003187:
-        case 2642780403:
-        case 2659557619:
-        case 2676334835:
-        case 2693112051:
-        case 2709889267:
-        case 2726666483:
-        case 2743443699:
-        case 2760220915:
-        case 2776998131:
-        case 2793775347:
-        case 2810552563:
-        case 2827329779:
-        case 2844106995:
-        case 2860884211:
-        case 2877661427:
-        case 2894438643:
-        case 2911215859:
-        case 2927993075:
-        case 2944770291:
-        case 2961547507:
-        case 2978324723:
-        case 2995101939:
-        case 3011879155:
-        case 3028656371:
-        case 3045433587:
-        case 3062210803:
-        case 3078988019:
-        case 3095765235:
-        case 3112542451:
-        case 3129319667:
-        case 3146096883:
-        case 3162874099:
-        case 3179651315:
-        case 3196428531:
-        case 3213205747:
-        case 2156306675:
-        case 2173083891:
-        case 2189861107:
-        case 2206638323:
-        case 2223415539:
-        case 2240192755:
-        case 2256969971:
-        case 2273747187:
-        case 2290524403:
-        case 2307301619:
-        case 2324078835:
-        case 2340856051:
-        case 2357633267:
-        case 2374410483:
-        case 2391187699:
-        case 2407964915:
-        case 2424742131:
-        case 2441519347:
-        case 2458296563:
-        case 2475073779:
-        case 2491850995:
-        case 2508628211:
-        case 2525405427:
-        case 2542182643:
-        case 2558959859:
-        case 2575737075:
-        case 2592514291:
-        case 2609291507:
-        case 2626068723:
-        case 2642845939:
-        case 2659623155:
-        case 2676400371:
-        case 2693177587:
-        case 2709954803:
-        case 2726732019:
-        case 2743509235:
-        case 2760286451:
-        case 2777063667:
-        case 2793840883:
-        case 2810618099:
-        case 2827395315:
-        case 2844172531:
-        case 2860949747:
-        case 2877726963:
-        case 2894504179:
-        case 2911281395:
-        case 2928058611:
-        case 2944835827:
-        case 2961613043:
-        case 2978390259:
-        case 2995167475:
-        case 3011944691:
-        case 3028721907:
-        case 3045499123:
-        case 3062276339:
-        case 3079053555:
-        case 3095830771:
-        case 3112607987:
-        case 3129385203:
-        case 3146162419:
-        case 3162939635:
-        case 3179716851:
-        case 3196494067:
-        case 3213271283:
-        case 2156372211:
-        case 2173149427:
-        case 2189926643:
-        case 2206703859:
-        case 2223481075:
-        case 2240258291:
-        case 2257035507:
-        case 2273812723:
-        case 2290589939:
-        case 2307367155:
-        case 2324144371:
-        case 2340921587:
-        case 2357698803:
-        case 2374476019:
-        case 2391253235:
-        case 2408030451:
-        case 2424807667:
-        case 2441584883:
-        case 2458362099:
-        case 2475139315:
-        case 2491916531:
-        case 2508693747:
-        case 2525470963:
-        case 2542248179:
-        case 2559025395:
-        case 2575802611:
-        case 2592579827:
-        case 2609357043:
-        case 2626134259:
-        case 2642911475:
-        case 2659688691:
-        case 2676465907:
-        case 2693243123:
-        case 2710020339:
-        case 2726797555:
-        case 2743574771:
-        case 2760351987:
-        case 2777129203:
-        case 2793906419:
-        case 2810683635:
-        case 2827460851:
-        case 2844238067:
-        case 2861015283:
-        case 2877792499:
-        case 2894569715:
-        case 2911346931:
-        case 2928124147:
-        case 2944901363:
-            return true;
-        default: return false;
-    }
-};
-
-} // namespace Forscape
-
-#endif // FORSCAPE_UNICODE_ZEROWIDTH_H
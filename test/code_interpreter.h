@@ -1,4 +1,5 @@
 #include <forscape_interpreter.h>
+#include <forscape_message.h>
 #include <forscape_parser.h>
 #include <forscape_program.h>
 #include <forscape_scanner.h>
@@ -60,6 +61,37 @@ inline bool testExpression(const std::string& in, const std::string& expect){
     }
 }
 
+//What the optimiser rewrote in each script, so changes to the optimiser show which scripts they reach
+static std::vector<std::pair<std::string, OptimiserStats>> optimiser_stats;
+
+inline void recordOptimiserStats(){
+    std::filesystem::create_directory("../test/out");
+    std::ofstream out("../test/out/optimiser_stats.csv");
+    out << "script,constants folded,invariants hoisted,dead stores removed\n";
+
+    OptimiserStats total;
+    for(const auto& entry : optimiser_stats){
+        const OptimiserStats& stats = entry.second;
+        out << entry.first << ',' << stats.constants_folded << ','
+            << stats.invariants_hoisted << ',' << stats.dead_stores_removed << '\n';
+        total.constants_folded += stats.constants_folded;
+        total.invariants_hoisted += stats.invariants_hoisted;
+        total.dead_stores_removed += stats.dead_stores_removed;
+    }
+
+    std::cout << "-- Optimiser:           " << total.constants_folded << " folded, "
+              << total.invariants_hoisted << " hoisted, " << total.dead_stores_removed
+              << " dead stores in " << optimiser_stats.size() << " scripts" << std::endl;
+}
+
+inline const OptimiserStats& optimiserStatsOf(const std::string& name){
+    auto lookup = std::find_if(optimiser_stats.begin(), optimiser_stats.end(), [&name](const auto& entry){
+        return entry.first == name;
+    });
+    assert(lookup != optimiser_stats.end());
+    return lookup->second;
+}
+
 inline bool testCase(const std::string& name){
     std::string file_name = BASE_TEST_DIR "/in/" + name + ".π";
     std::string in = readFile(file_name);
@@ -70,6 +102,7 @@ inline bool testCase(const std::string& name){
     Forscape::Program::instance()->setProgramEntryPoint(input->path, input);
     input->postmutate();
     std::string str = Forscape::Program::instance()->run();
+    optimiser_stats.push_back({name, Forscape::Program::instance()->optimiser.stats});
 
     #ifndef NDEBUG
     input->parseTreeDot(); //Make sure dot generation doesn't crash
@@ -93,6 +126,131 @@ inline bool testCase(const std::string& name){
     }
 }
 
+inline bool testOptimisedCopy(){
+    //The editor navigates the resolved tree, so the optimiser only rewrites the copy which runs
+    Typeset::Model* input = Typeset::Model::fromSerial("x ← 2 + 3\nprint(1)");
+    Program* program = Program::instance();
+    program->setProgramEntryPoint("", input);
+    input->postmutate();
+    program->run();
+
+    ParseNode store = program->parse_tree.arg<0>(program->parse_tree.root);
+    bool passing = program->parse_tree.getOp(store) != OP_DO_NOTHING &&
+                   program->parse_tree.getOp(program->parse_tree.rhs(store)) == OP_ADDITION &&
+                   program->executable_tree.getOp(store) == OP_DO_NOTHING;
+    if(!passing) printf("Optimiser rewrote the tree read by the editor\n");
+
+    program->freeFileMemory();
+
+    return passing;
+}
+
+inline bool testPlotStreaming(){
+    //Vectors grown by a point send a copy of their tail, while doubled vectors alias the tail in the matrix
+    Typeset::Model* input = Typeset::Model::fromSerial(
+        "t ← 0\n"
+        "for(k ← 0; k < 5; k ← k + 1){\n"
+        "    plot(\"Scalar\", \"t\", t, \"y\", 2t)\n"
+        "    t ← t + 1\n"
+        "}\n"
+        "v ← ⁜[1x3]⏴1⏵⏴2⏵⏴3⏵⁜^⏴⊤⏵\n"
+        "for(k ← 0; k < 2; k ← k + 1)\n"
+        "    plot(\"Vector\", \"x\", v, \"y\", v)\n"
+        "w ← ⁜[1x8]⏴0⏵⏴1⏵⏴2⏵⏴3⏵⏴4⏵⏴5⏵⏴6⏵⏴7⏵⁜^⏴⊤⏵\n"
+        "for(k ← 1; k < 5; k ← k + 1)\n"
+        "    plot(\"Growing\", \"x\", w⁜_⏴0:k⏵, \"y\", 2w⁜_⏴0:k⏵)\n"
+        "k ← 1\n"
+        "while(k < 8){\n"
+        "    plot(\"Doubling\", \"x\", w⁜_⏴0:k⏵, \"y\", w⁜_⏴0:k⏵)\n"
+        "    k ← 2k + 1\n"
+        "}");
+    Program* program = Program::instance();
+    program->setProgramEntryPoint("", input);
+    input->postmutate();
+    program->interpreter.run(
+        program->parse_tree,
+        program->static_pass.instantiation_lookup,
+        program->static_pass.switch_tables,
+        program->static_pass.strings);
+
+    std::vector<size_t> created;
+    size_t series = 0;
+    std::vector<std::vector<double>> appended_x;
+    std::vector<std::vector<double>> appended_y;
+    bool passing = true;
+    InterpreterOutput* msg;
+    while(program->interpreter.message_queue.try_dequeue(msg)){
+        switch(msg->getType()){
+            case InterpreterOutput::CreatePlot:
+                created.push_back(static_cast<PlotCreate*>(msg)->id);
+                appended_x.emplace_back();
+                appended_y.emplace_back();
+                break;
+            case InterpreterOutput::AddDiscreteSeries: series++; break;
+            case InterpreterOutput::AppendDiscreteSeries:{
+                const PlotAppend& append = *static_cast<PlotAppend*>(msg);
+                const size_t plot = std::find(created.begin(), created.end(), append.id) - created.begin();
+                passing &= plot < created.size();
+                if(!passing) break;
+                for(size_t i = 0; i < append.data.size; i++){
+                    appended_x[plot].push_back(append.data.x.get()[i]);
+                    appended_y[plot].push_back(append.data.y.get()[i]);
+                }
+                break;
+            }
+            default: break;
+        }
+        delete msg;
+    }
+    program->freeFileMemory();
+
+    if(created.size() != 4 || series != 4 ||
+       appended_y[0] != std::vector<double>({2, 4, 6, 8}) ||
+       !appended_y[1].empty() ||
+       appended_x[2] != std::vector<double>({2, 3, 4}) || appended_y[2] != std::vector<double>({4, 6, 8}) ||
+       appended_x[3] != std::vector<double>({2, 3, 4, 5, 6, 7}) || appended_y[3] != appended_x[3]){
+        std::cout << "Plot streaming failed: " << created.size() << " plots, " << series << " series" << std::endl;
+        return false;
+    }
+
+    return passing;
+}
+
+inline bool testPlotSharing(){
+    //The series are only read once the script has finished writing to the plotted matrix
+    Typeset::Model* input = Typeset::Model::fromSerial(readFile(BASE_TEST_DIR "/in/plot_sharing.π"));
+    Program* program = Program::instance();
+    program->setProgramEntryPoint("", input);
+    input->postmutate();
+    program->interpreter.run(
+        program->parse_tree,
+        program->static_pass.instantiation_lookup,
+        program->static_pass.switch_tables,
+        program->static_pass.strings);
+
+    std::vector<std::vector<double>> xs;
+    std::vector<std::vector<double>> ys;
+    InterpreterOutput* msg;
+    while(program->interpreter.message_queue.try_dequeue(msg)){
+        if(msg->getType() == InterpreterOutput::AddDiscreteSeries){
+            const PlotColumns& data = static_cast<PlotDiscreteSeries*>(msg)->data;
+            xs.push_back(std::vector<double>(data.x.get(), data.x.get() + data.size));
+            ys.push_back(std::vector<double>(data.y.get(), data.y.get() + data.size));
+        }
+        delete msg;
+    }
+    program->freeFileMemory();
+
+    const std::vector<std::vector<double>> expected = {{1, 2, 3}, {5, 2, 3}, {5, 0, 3}, {1}};
+    if(xs != expected || ys.size() != expected.size() || ys.back() != std::vector<double>({2})){
+        std::cout << "Plot sharing failed: " << xs.size() << " series" << std::endl;
+        return false;
+    }
+    ys.back() = xs.back();
+
+    return ys == xs;
+}
+
 inline bool testInterpreter(){
     bool passing = true;
 
@@ -105,11 +263,22 @@ inline bool testInterpreter(){
     passing &= testExpression("2^2", "4");
     passing &= testExpression("4^0.5", "2");
 
+    passing &= testOptimisedCopy();
+    passing &= testPlotStreaming();
+    passing &= testPlotSharing();
+
     writeAbsoluteImportTest();
     for(directory_iterator end, dir(BASE_TEST_DIR "/in"); dir != end; dir++)
         if(std::filesystem::is_regular_file(dir->path()))
             passing &= testCase(dir->path().stem().string());
 
+    //The dead store at the top level and those local to each loop body are all dropped
+    if(optimiserStatsOf("dead_stores").dead_stores_removed != 3){
+        printf("Dead stores removed: %zu\n", optimiserStatsOf("dead_stores").dead_stores_removed);
+        passing = false;
+    }
+    recordOptimiserStats();
+
     #ifndef NDEBUG
     if(!allTypesetElementsFreed()){
         printf("Unfreed typeset elements\n");
@@ -119,6 +119,26 @@ inline bool testScanner(){
     delete model;
     delete scanner;
 
+    //Every keyword has a slot of its own, and near misses land on another keyword's slot
+    for(const auto& entry : Scanner::keywords){
+        const ForscapeTokenType* lookup = Scanner::keywords.find(entry.first);
+        if(lookup == nullptr || *lookup != entry.second){
+            std::cout << "Keyword \"" << entry.first << "\" not found by perfect hash" << std::endl;
+            passing = false;
+        }
+        const std::string prefixed = '_' + std::string(entry.first);
+        const std::string truncated(entry.first.substr(0, entry.first.size()-1));
+        if(Scanner::keywords.contains(prefixed) || (!truncated.empty() && Scanner::keywords.find(truncated) &&
+                                                     *Scanner::keywords.find(truncated) == entry.second)){
+            std::cout << "Perfect hash matched a near miss of \"" << entry.first << "\"" << std::endl;
+            passing = false;
+        }
+    }
+    if(Scanner::keywords.contains("") || Scanner::keywords.contains("alg ")){
+        std::cout << "Perfect hash matched a non-keyword" << std::endl;
+        passing = false;
+    }
+
     #ifndef NDEBUG
     if(!allTypesetElementsFreed()){
         printf("Unfreed typeset elements\n");
@@ -5,8 +5,15 @@
 #include "forscape_program.h"
 #include "forscape_scanner.h"
 #include "forscape_serial.h"
+#include "forscape_document_file.h"
 #include "forscape_symbol_lexical_pass.h"
 
+#ifndef FORSCAPE_TYPESET_HEADLESS
+#include "plot.h"
+#endif
+
+#include <algorithm>
+
 using namespace Forscape;
 using namespace Code;
 
@@ -17,28 +24,67 @@ using namespace Code;
 #endif
 
 static constexpr size_t ITER_SERIAL_VALIDATION = DEBUG_CAP(50000);
+static constexpr size_t ITER_GRAPHEMES = DEBUG_CAP(200000);
+static constexpr size_t ITER_ZERO_WIDTH = DEBUG_CAP(200000);
 static constexpr size_t ITER_MODEL_LOAD_DELETE = DEBUG_CAP(5000);
+static constexpr size_t ITER_OPEN_LARGE = DEBUG_CAP(200);
+static constexpr size_t ITER_KEYSTROKES = DEBUG_CAP(20000);
+static constexpr size_t ITER_SEARCH = DEBUG_CAP(500);
 static constexpr size_t ITER_SCANNER = DEBUG_CAP(500000);
 static constexpr size_t ITER_PARSER = DEBUG_CAP(500000);
 static constexpr size_t ITER_SYMBOL_TABLE = DEBUG_CAP(50000);
 static constexpr size_t ITER_STATIC_PASS = DEBUG_CAP(50000);
 static constexpr size_t ITER_INTERPRETER = DEBUG_CAP(5000);
+static constexpr size_t ITER_GRID = DEBUG_CAP(20);
+static constexpr size_t ITER_WAVES = DEBUG_CAP(3);
+static constexpr size_t ITER_PASS_MATRIX = DEBUG_CAP(10);
+static constexpr size_t ITER_STRING_SWITCH = DEBUG_CAP(10);
+static constexpr size_t ITER_STATE_MACHINE = DEBUG_CAP(10);
+static constexpr size_t ITER_LOOP_INVARIANTS = DEBUG_CAP(10);
+static constexpr size_t ITER_PLOT_HANDOFF = DEBUG_CAP(10);
+static constexpr size_t ITER_SUGGESTIONS = DEBUG_CAP(1000);
 static constexpr size_t ITER_CALC_SIZE = DEBUG_CAP(5000000);
 static constexpr size_t ITER_LAYOUT = DEBUG_CAP(10000000);
+static constexpr size_t ITER_EDIT_LAYOUT = DEBUG_CAP(1000000);
 static constexpr size_t ITER_PAINT = DEBUG_CAP(1500);
+static constexpr size_t ITER_PAINT_WIDE = DEBUG_CAP(1500);
 static constexpr size_t ITER_LOOP = DEBUG_CAP(10);
 static constexpr size_t ITER_PRINT_SIZE = DEBUG_CAP(100);
 static constexpr size_t ITER_PRINT_LAYOUT = DEBUG_CAP(100);
 static constexpr size_t ITER_PRINT_PAINT = DEBUG_CAP(30);
+static constexpr size_t ITER_PLOT_PAINT = DEBUG_CAP(200);
+static constexpr size_t ITER_PLOT_STREAM = DEBUG_CAP(999);
 
 void runBenchmark(){
     std::string src = readFile("../test/interpreter_scripts/in/root_finding_terse.π");
 
+    //Read through a volatile pointer so the pure validation call is not hoisted out of the loop
+    const std::string* volatile validated = &src;
     startClock();
     for(size_t i = 0; i < ITER_SERIAL_VALIDATION; i++)
-        if(!isValidSerial(src)) exit(1);
+        if(!isValidSerial(*validated)) exit(1);
     report("Serial validation", ITER_SERIAL_VALIDATION);
 
+    size_t num_graphemes = 0;
+    startClock();
+    for(size_t i = 0; i < ITER_GRAPHEMES; i++)
+        num_graphemes += countGraphemes(*validated);
+    report("Count graphemes", ITER_GRAPHEMES);
+    if(num_graphemes == 0) exit(1);
+
+    const std::string math_symbols = "∑∫∮∂∇αβγδεθλμπσφωΓΔΘΛΠΣΦΨΩ×÷±∓≤≥≠≈≡∝∞√∛∈∉∋⊂⊃⊆⊇∪∩∧∨¬∀∃∄→←↔⇒⇔ℝℂℕℤℚ"
+                                     "ẋẍx̂x̄x⃗ŷȳy⃗²³⁴⁵⁻¹₀₁₂₃ᵀ⊤⊥∘⋅⊗⊕†‖∥⌈⌉⌊⌋⟨⟩";
+    const std::string* volatile symbols = &math_symbols;
+    size_t num_zero_width = 0;
+    startClock();
+    for(size_t i = 0; i < ITER_ZERO_WIDTH; i++){
+        const std::string& str = *symbols;
+        for(size_t j = 0; j < str.size(); j += codepointSize(str[j]))
+            num_zero_width += isZeroWidth(codepointInt(str, j));
+    }
+    report("Zero-width lookup", ITER_ZERO_WIDTH);
+    if(num_zero_width == 0) exit(1);
+
     startClock();
     for(size_t i = 0; i < ITER_MODEL_LOAD_DELETE; i++){
         Typeset::Model* m = Typeset::Model::fromSerial(src);
@@ -46,6 +92,78 @@ void runBenchmark(){
     }
     report("Load / delete", ITER_MODEL_LOAD_DELETE);
 
+    //Opening covers reading from disk, validation, building the model and deleting it
+    std::string large_src;
+    for(size_t i = 0; i < 500; i++) large_src += src + '\n';
+    std::filesystem::create_directory("../test/out");
+    const std::string large_text_path = "../test/out/benchmark_large.π";
+    std::ofstream(large_text_path, std::ios::binary) << large_src;
+
+    startClock();
+    for(size_t i = 0; i < ITER_OPEN_LARGE; i++){
+        std::ifstream in(large_text_path);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        std::string text = buffer.str();
+        text.erase( std::remove(text.begin(), text.end(), '\r'), text.end() );
+        if(!isValidSerial(text)) exit(1);
+        delete Typeset::Model::fromSerial(text);
+    }
+    report("Open text (large)", ITER_OPEN_LARGE);
+
+    startClock();
+    for(size_t i = 0; i < ITER_OPEN_LARGE; i++){
+        DocumentFile in(std::filesystem::u8path(large_text_path));
+        if(!isValidSerial(in.serial())) exit(1);
+        delete Typeset::Model::fromSerial(in.serial());
+    }
+    report("Open mapped (large)", ITER_OPEN_LARGE);
+
+    startClock();
+    for(size_t i = 0; i < ITER_OPEN_LARGE; i++)
+        delete Typeset::Model::fromSerial(large_src, true);
+    report("Load output (large)", ITER_OPEN_LARGE);
+
+    //A long editing session where typing is regularly interrupted, so the history keeps growing.
+    //Every keystroke re-parses the whole document, so the session is quadratic in its length.
+    Typeset::Model* session = new Typeset::Model();
+    Program::instance()->setProgramEntryPoint("", session);
+    Typeset::Controller session_controller(session);
+    startClock();
+    for(size_t i = 0; i < ITER_KEYSTROKES; i++){
+        if(i % 97 == 0) session_controller.newline();
+        else if(i % 13 == 0) session_controller.moveToPrevChar();
+        else if(i % 7 == 0) session_controller.backspace();
+        else session_controller.insertText("x");
+    }
+    report("Edit session", ITER_KEYSTROKES);
+    reportBytes("Edit session history", session->historyBytes());
+    delete session;
+
+    Typeset::Model* large = Typeset::Model::fromSerial(large_src);
+    std::vector<Typeset::Selection> hits;
+    startClock();
+    for(size_t i = 0; i < ITER_SEARCH; i++){
+        hits.clear();
+        large->search("iter", hits, false, false);
+    }
+    report("Search (large)", ITER_SEARCH);
+
+    startClock();
+    for(size_t i = 0; i < ITER_SEARCH; i++){
+        hits.clear();
+        large->search("iter", hits, false, true);
+    }
+    report("Search word (large)", ITER_SEARCH);
+
+    startClock();
+    for(size_t i = 0; i < ITER_SEARCH; i++){
+        hits.clear();
+        large->search("jacobians", hits, false, false);
+    }
+    report("Search miss (large)", ITER_SEARCH);
+    delete large;
+
     Typeset::Model* m = Typeset::Model::fromSerial(src);
     Program::instance()->setProgramEntryPoint(m->path, m);
     Code::Scanner scanner(m);
@@ -93,11 +211,175 @@ void runBenchmark(){
         interpreter.run(
             parse_tree,
             static_pass.instantiation_lookup,
-            static_pass.number_switch,
-            static_pass.string_switch);
+            static_pass.switch_tables,
+            static_pass.strings);
     assert(interpreter.error_code == NO_ERROR_FOUND);
     report("Interpreter", ITER_INTERPRETER);
 
+    Typeset::Model* grid = Typeset::Model::fromSerial(
+        "A ← 0⁜_⏴300×300⏵\n"
+        "A⁜_⏴i,j⏵ ← i + j\n"
+        "A⁜_⏴i,j⏵ ← i - j\n"
+        "A⁜_⏴0,0⏵ ← 1");
+    Program::instance()->setProgramEntryPoint("", grid);
+    grid->postmutate();
+
+    startClock();
+    for(size_t i = 0; i < ITER_GRID; i++)
+        Program::instance()->run();
+    assert(Program::instance()->interpreter.error_code == NO_ERROR_FOUND);
+    report("Fill grid 300x300", ITER_GRID);
+    delete grid;
+
+    Typeset::Model* waves = Typeset::Model::fromSerial(
+        "B ← 0⁜_⏴2000×2000⏵\n"
+        "B⁜_⏴i,j⏵ ← sin(i/100)cos(j/100) + i*j/1000");
+    Program::instance()->setProgramEntryPoint("", waves);
+    waves->postmutate();
+
+    startClock();
+    for(size_t i = 0; i < ITER_WAVES; i++)
+        Program::instance()->run();
+    assert(Program::instance()->interpreter.error_code == NO_ERROR_FOUND);
+    report("Fill waves 2000x2000", ITER_WAVES);
+    delete waves;
+
+    Typeset::Model* pass = Typeset::Model::fromSerial(
+        "alg depth(X, n){\n"
+        "    if(n ≤ 0) return 0\n"
+        "    return depth(X, n-1) + 1\n"
+        "}\n"
+        "S ← 0⁜_⏴200×200⏵\n"
+        "total ← 0\n"
+        "for(i ← 0; i < 50; i ← i + 1)\n"
+        "    total ← total + depth(S, 20)");
+    Program::instance()->setProgramEntryPoint("", pass);
+    pass->postmutate();
+
+    startClock();
+    for(size_t i = 0; i < ITER_PASS_MATRIX; i++)
+        Program::instance()->run();
+    assert(Program::instance()->interpreter.error_code == NO_ERROR_FOUND);
+    report("Pass matrix 200x200", ITER_PASS_MATRIX);
+    delete pass;
+
+    Typeset::Model* string_switch = Typeset::Model::fromSerial(
+        "alg classify(s){\n"
+        "    switch(s){\n"
+        "        case \"alpha\": return 1\n"
+        "        case \"beta\": return 2\n"
+        "        case \"gamma\": return 3\n"
+        "        case \"delta\": return 4\n"
+        "        default: return 0\n"
+        "    }\n"
+        "}\n"
+        "total ← 0\n"
+        "for(i ← 0; i < 20000; i ← i + 1)\n"
+        "    total ← total + classify(\"gamma\") + classify(\"del\" + \"ta\") + classify(\"omega\")");
+    Program::instance()->setProgramEntryPoint("", string_switch);
+    string_switch->postmutate();
+
+    startClock();
+    for(size_t i = 0; i < ITER_STRING_SWITCH; i++)
+        Program::instance()->run();
+    assert(Program::instance()->interpreter.error_code == NO_ERROR_FOUND);
+    report("String switch", ITER_STRING_SWITCH);
+    delete string_switch;
+
+    Typeset::Model* state_machine = Typeset::Model::fromSerial(
+        "state ← 0\n"
+        "count ← 0\n"
+        "for(i ← 0; i < 100000; i ← i + 1){\n"
+        "    switch(state){\n"
+        "        case 0: state ← 1\n"
+        "        case 1: count ← count + 1\n"
+        "        case 2: state ← 3\n"
+        "        case 3: state ← 4\n"
+        "        case 4: state ← 0\n"
+        "        default: state ← 0\n"
+        "    }\n"
+        "}");
+    Program::instance()->setProgramEntryPoint("", state_machine);
+    state_machine->postmutate();
+
+    startClock();
+    for(size_t i = 0; i < ITER_STATE_MACHINE; i++)
+        Program::instance()->run();
+    assert(Program::instance()->interpreter.error_code == NO_ERROR_FOUND);
+    report("Switch state machine", ITER_STATE_MACHINE);
+    delete state_machine;
+
+    Typeset::Model* invariants = Typeset::Model::fromSerial(
+        "N ← 64\n"
+        "v ← ⁜[1x3]⏴1⏵⏴2⏵⏴3⏵⁜^⏴⊤⏵\n"
+        "A ← 0⁜_⏴3×3⏵\n"
+        "total ← 0\n"
+        "for(i ← 0; i < 20000; i ← i + 1)\n"
+        "    total ← total + sin(i×2π/N) + ‖v‖ + v⁜^⏴⊤⏵(A + 1⁜_⏴3×3⏵)v");
+    Program::instance()->optimiser.enabled = false;
+    Program::instance()->setProgramEntryPoint("", invariants);
+    invariants->postmutate();
+
+    startClock();
+    for(size_t i = 0; i < ITER_LOOP_INVARIANTS; i++)
+        Program::instance()->run();
+    assert(Program::instance()->interpreter.error_code == NO_ERROR_FOUND);
+    report("Loop (unoptimised)", ITER_LOOP_INVARIANTS);
+
+    Program::instance()->optimiser.enabled = true;
+    invariants->postmutate();
+
+    startClock();
+    for(size_t i = 0; i < ITER_LOOP_INVARIANTS; i++)
+        Program::instance()->run();
+    assert(Program::instance()->interpreter.error_code == NO_ERROR_FOUND);
+    assert(Program::instance()->optimiser.stats.invariants_hoisted > 0);
+    report("Loop (optimised)", ITER_LOOP_INVARIANTS);
+    delete invariants;
+
+    Typeset::Model* handoff = Typeset::Model::fromSerial(
+        "t ← 0⁜_⏴200000×1⏵\n"
+        "for(i ← 0; i < 20; i ← i + 1)\n"
+        "    plot(\"Trace\", \"t\", t, \"y\", t)");
+    Program::instance()->setProgramEntryPoint("", handoff);
+    handoff->postmutate();
+
+    startClock();
+    for(size_t i = 0; i < ITER_PLOT_HANDOFF; i++)
+        Program::instance()->run();
+    assert(Program::instance()->interpreter.error_code == NO_ERROR_FOUND);
+    report("Plot hand-off", ITER_PLOT_HANDOFF);
+    delete handoff;
+
+    for(size_t num_symbols : {1000, 10000}){
+        std::string declarations;
+        for(size_t i = 0; i < num_symbols; i++)
+            declarations += "x" + std::to_string(i) + " ← " + std::to_string(i) + "\n";
+        Typeset::Model* symbols = Typeset::Model::fromSerial(declarations + "x12");
+        Program::instance()->setProgramEntryPoint("", symbols);
+        symbols->postmutate();
+        const Typeset::Marker typed(symbols->lastText(), symbols->lastText()->numChars());
+        std::vector<std::string> suggestions;
+
+        startClock();
+        for(size_t i = 0; i < ITER_SUGGESTIONS; i++){
+            suggestions.clear();
+            symbols->symbol_builder.symbol_table.getSuggestions(typed, suggestions);
+        }
+        //Every declared name which extends the typed "x12", in the index's sorted order
+        std::vector<std::string> expected;
+        for(size_t i = 0; i < num_symbols; i++){
+            std::string name = "x" + std::to_string(i);
+            if(name.size() > 3 && name.compare(0, 3, "x12") == 0) expected.push_back(name);
+        }
+        std::sort(expected.begin(), expected.end());
+        assert(expected.size() == (num_symbols == 1000 ? 10 : 110));
+        assert(suggestions == expected);
+        report("Suggest " + std::to_string(num_symbols/1000) + "k symbols", ITER_SUGGESTIONS);
+        delete symbols;
+    }
+    Program::instance()->setProgramEntryPoint(m->path, m);
+
     #ifndef FORSCAPE_TYPESET_HEADLESS
     m = Typeset::Model::fromSerial(src);
 
@@ -111,6 +393,17 @@ void runBenchmark(){
         m->updateLayout();
     report("Update layout", ITER_LAYOUT);
 
+    Typeset::Text* edited = m->nearestLine(m->getHeight()/2)->back();
+    const std::string appended = "x";
+
+    startClock();
+    for(size_t i = 0; i < ITER_EDIT_LAYOUT; i++){
+        if(i % 2) edited->erase(edited->numChars()-appended.size(), appended);
+        else edited->append(appended);
+        m->updateLayout();
+    }
+    report("Edit layout", ITER_EDIT_LAYOUT);
+
     Typeset::Console view;
     //view.show();
 
@@ -122,6 +415,39 @@ void runBenchmark(){
     startClock();
     for(size_t i = 0; i < ITER_PAINT; i++) view.render(&painter);
     report("Paint", ITER_PAINT);
+
+    Typeset::Painter::resetGlyphCacheStats();
+    startClock();
+    for(size_t i = 0; i < ITER_PAINT; i++){
+        view.invalidateTextLayer();
+        view.render(&painter);
+    }
+    report("Paint uncached", ITER_PAINT);
+    reportRate("Glyph cache hits", Typeset::Painter::glyphCacheHitRate());
+
+    //Most of each line is clipped, so painting should only pay for the visible columns
+    std::string wide_src;
+    for(size_t i = 0; i < 40; i++){
+        wide_src += "A = ";
+        for(size_t j = 0; j < 12; j++){
+            wide_src += CONSTRUCT_STR "[3x9]";
+            for(size_t k = 0; k < 27; k++) wide_src += OPEN_STR "1.23456789" CLOSE_STR;
+            wide_src += " + ";
+        }
+        wide_src += "B\n";
+    }
+    Typeset::Model* wide = Typeset::Model::fromSerial(wide_src);
+    view.setModel(wide);
+
+    startClock();
+    for(size_t i = 0; i < ITER_PAINT_WIDE; i++){
+        view.invalidateTextLayer();
+        view.render(&painter);
+    }
+    report("Paint wide matrix", ITER_PAINT_WIDE);
+
+    view.setModel(m);
+    delete wide;
     #endif
 
     #ifdef NDEBUG
@@ -159,6 +485,55 @@ void runBenchmark(){
     startClock();
     for(size_t i = 0; i < ITER_PRINT_PAINT; i++) view.render(&painter);
     report("Print output Paint", ITER_PRINT_PAINT);
+
+    constexpr size_t TRACE_POINTS = 1000000;
+    Eigen::MatrixXd trace_t(TRACE_POINTS, 1);
+    Eigen::MatrixXd trace_y(TRACE_POINTS, 1);
+    for(size_t i = 0; i < TRACE_POINTS; i++){
+        const double t = i * 1e-4;
+        trace_t(i) = t;
+        trace_y(i) = std::sin(t) + 0.1*std::sin(1000*t);
+    }
+    SharedMatrix shared_t(std::move(trace_t));
+    SharedMatrix shared_y(std::move(trace_y));
+
+    Plot plot("Trace", "t", "y");
+    plot.addSeries(PlotColumns{shared_t.share(), shared_y.share(), TRACE_POINTS});
+    plot.resize(QSize(1200, 800));
+    QImage plot_img(plot.size(), QImage::Format_RGB32);
+    QPainter plot_painter(&plot_img);
+
+    startClock();
+    for(size_t i = 0; i < ITER_PLOT_PAINT; i++) plot.render(&plot_painter);
+    report("Plot Paint 1M", ITER_PLOT_PAINT);
+
+    startClock();
+    for(size_t i = 0; i < ITER_PLOT_PAINT; i++){
+        plot.resize(QSize(1200 - i%2, 800));
+        plot.render(&plot_painter);
+    }
+    report("Plot Resize 1M", ITER_PLOT_PAINT);
+
+    constexpr size_t STREAM_CHUNK = TRACE_POINTS / 1000;
+    auto streamChunk = [&](size_t i){
+        const std::shared_ptr<const double> t = shared_t.share();
+        const std::shared_ptr<const double> y = shared_y.share();
+        return PlotColumns{
+            std::shared_ptr<const double>(t, t.get() + i*STREAM_CHUNK),
+            std::shared_ptr<const double>(y, y.get() + i*STREAM_CHUNK),
+            STREAM_CHUNK};
+    };
+
+    Plot streamed("Stream", "t", "y");
+    streamed.resize(QSize(1200, 800));
+    streamed.addSeries(streamChunk(0));
+
+    startClock();
+    for(size_t i = 1; i <= ITER_PLOT_STREAM; i++){
+        streamed.appendSeries(streamChunk(i));
+        streamed.render(&plot_painter);
+    }
+    report("Plot stream append", ITER_PLOT_STREAM);
     #endif
 
     recordResults();
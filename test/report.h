@@ -92,6 +92,22 @@ inline void report(const std::string& test_name, size_t N){
     std::cout << std::endl;
 }
 
+inline void reportRate(const std::string& test_name, double rate){
+    std::cout << "-- " << test_name << ":";
+    for(size_t i = test_name.size(); i < name_width; i++)
+        std::cout << ' ';
+    std::cout << 100*rate << '%' << std::endl;
+}
+
+inline void reportBytes(const std::string& test_name, size_t bytes){
+    std::cout << "-- " << test_name << ":";
+    for(size_t i = test_name.size(); i < name_width; i++)
+        std::cout << ' ';
+    if(bytes < 1024) std::cout << bytes << " B" << std::endl;
+    else if(bytes < 1024*1024) std::cout << bytes/1024.0 << " KiB" << std::endl;
+    else std::cout << bytes/(1024.0*1024) << " MiB" << std::endl;
+}
+
 inline void recordResults(){
     std::filesystem::create_directory("../test/out");
 
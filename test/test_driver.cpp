@@ -5,6 +5,7 @@
 #include "serial.h"
 #include "test_convert_to_unicode.h"
 #include "test_keywords.h"
+#include "test_scope_suggestions.h"
 #include "test_unicode.h"
 #include "typeset_loadsave.h"
 #include "typeset_control.h"
@@ -48,6 +49,7 @@ int main(int argc, char* argv[]){
     passing &= testInterpreter();
     passing &= testIllFormedPrograms();
     passing &= testTypesetMutability();
+    passing &= testScopeSuggestions();
 
     #ifdef TEST_QT
     passing &= testIdeFeatures();
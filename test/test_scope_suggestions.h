@@ -0,0 +1,91 @@
+#ifndef TEST_SCOPE_SUGGESTIONS_H
+#define TEST_SCOPE_SUGGESTIONS_H
+
+#include <forscape_program.h>
+#include "report.h"
+#include "typeset.h"
+
+using namespace Forscape;
+
+//Each line holding only "qq" is a cursor. Suggestions are taken at the end of each cursor, in document order.
+static std::vector<std::vector<std::string>> suggestionsAtCursors(const std::string& src){
+    Typeset::Model* model = Typeset::Model::fromSerial(src);
+    Program::instance()->setProgramEntryPoint("", model);
+    model->postmutate();
+
+    std::vector<std::vector<std::string>> suggestions;
+    for(Typeset::Line* l = model->firstText()->getLine(); l; l = l->next()){
+        Typeset::Text* t = l->front();
+        const std::string& str = t->getString();
+        if(l->numTexts() != 1 || str.size() < 2 || str.compare(str.size()-2, 2, "qq") != 0) continue;
+        if(str.find_first_not_of(' ') != str.size()-2) continue;
+
+        suggestions.emplace_back();
+        model->symbol_builder.symbol_table.getSuggestions(Typeset::Marker(t, t->numChars()), suggestions.back());
+    }
+
+    Program::instance()->freeFileMemory();
+
+    return suggestions;
+}
+
+static bool checkSuggestions(
+        const std::string& test,
+        const std::vector<std::string>& expected,
+        const std::vector<std::string>& actual){
+    if(expected == actual) return true;
+
+    std::cout << test << " suggestions failing:\n";
+    std::cout << "---EXPECTED---\n";
+    for(const std::string& str : expected) std::cout << str << "\n";
+    std::cout << "---ACTUAL---\n";
+    for(const std::string& str : actual) std::cout << str << "\n";
+    std::cout.flush();
+
+    return false;
+}
+
+inline bool testScopeSuggestions(){
+    bool passing = true;
+
+    const std::vector<std::vector<std::string>> suggestions = suggestionsAtCursors(
+        "qqa ← 1\n"
+        "qqb ← 2\n"
+        "alg sibling(qqsib){\n"
+        "    qqhidden ← qqsib\n"
+        "    qq\n"
+        "    return qqhidden\n"
+        "}\n"
+        "alg outer(qqa){\n"
+        "    qqz ← qqa\n"
+        "    for(qqi ← 0; qqi < 2; qqi ← qqi + 1){\n"
+        "        qqloop ← qqz + qqb\n"
+        "        qq\n"
+        "    }\n"
+        "    return qqz\n"
+        "}\n"
+        "qq\n"
+        "print(sibling(qqa), outer(qqb))"
+    );
+
+    if(suggestions.size() != 3){
+        printf("Scope suggestions found %zu cursors\n", suggestions.size());
+        report("Scope suggestions", false);
+        return false;
+    }
+
+    //Names local to the sibling are suggested only within it, ahead of the globals
+    passing &= checkSuggestions("Sibling body", {"qqhidden", "qqsib", "qqa", "qqb"}, suggestions[0]);
+
+    //The innermost declarations are ranked first, even where they sort after outer names.
+    //The parameter qqa shadows the global, so it is suggested once, at the depth of the parameter.
+    passing &= checkSuggestions("Nested loop", {"qqi", "qqloop", "qqa", "qqz", "qqb"}, suggestions[1]);
+
+    //Nothing declared in an algorithm or loop leaks into the global scope
+    passing &= checkSuggestions("Global", {"qqa", "qqb"}, suggestions[2]);
+
+    report("Scope suggestions", passing);
+    return passing;
+}
+
+#endif // TEST_SCOPE_SUGGESTIONS_H
@@ -38,6 +38,33 @@ inline bool testUnicode(){
     assert(isIllFormedUtf8(FOUR_BYTE_LEAD CONTINUATION_CHAR CONTINUATION_CHAR "normal ASCII"));
     assert(isIllFormedUtf8(ZERO_WIDTH_CODEPOINT "Leading zero-width codepoint"));
 
+    //Runs of ASCII are counted a vector at a time, so check either side of the vector widths
+    for(size_t ascii_run = 0; ascii_run < 70; ascii_run++){
+        const std::string str = std::string(ascii_run, 'a') + "x" ZERO_WIDTH_CODEPOINT "π" + std::string(ascii_run, 'b') + "²";
+        if(countGraphemes(str) != 2*ascii_run + 3 || countGraphemes(std::string_view(str)) != 2*ascii_run + 3){
+            printf("Grapheme count incorrect after %zu ASCII characters\n", ascii_run);
+            passing = false;
+        }
+        if(asciiPrefixEnd(str.data(), 0, str.size()) != ascii_run + 1){
+            printf("ASCII prefix end incorrect after %zu ASCII characters\n", ascii_run);
+            passing = false;
+        }
+    }
+
+    //Zero-width lookup goes through a two-stage table, so check either side of block and range boundaries
+    for(std::string_view ch : {"\u0300", "\u036F", "\u0483", "\u20D7", "\u200B", "\uFE0F", "\uFE2F", "\U000E0100", "\U000E01EF"}){
+        if(!isZeroWidth(codepointInt(ch))){
+            printf("Expected zero-width codepoint: %s\n", std::string(ch).c_str());
+            passing = false;
+        }
+    }
+    for(std::string_view ch : {"\u00AD", "\u02FF", "\u0370", "π", "²", "∑", "\u20F1", "\uFF00", "😎", "\U000E01F0", "\U0010FFFD"}){
+        if(isZeroWidth(codepointInt(ch))){
+            printf("Unexpected zero-width codepoint: %s\n", std::string(ch).c_str());
+            passing = false;
+        }
+    }
+
     report("UTF-8 handling", passing);
     return passing;
 }
@@ -1,6 +1,7 @@
 #include <cassert>
 #include <fstream>
 #include <construct_codes.h>
+#include "forscape_program.h"
 #include "forscape_unicode.h"
 #include "typeset.h"
 #include <sstream>
@@ -64,6 +65,87 @@ inline bool testTypesetController(){
 
     delete model;
 
+    //Long enough that hits land in vector blocks and in the scalar tail
+    std::string haystack;
+    for(size_t i = 0; i < 40; i++) haystack += "Alpha alphabet _alpha alpha1 ALPHA+";
+    model = Forscape::Typeset::Model::fromSerial(haystack);
+    Program::instance()->setProgramEntryPoint("", model);
+    controller = Typeset::Controller(model);
+    std::vector<Typeset::Selection> hits;
+    model->search("alpha", hits, false, false);
+    if(hits.size() != 40*5){
+        printf("Case-insensitive search found %zu hits\n", hits.size());
+        passing = false;
+    }
+    hits.clear();
+    model->search("alpha", hits, true, false);
+    if(hits.size() != 40*3){
+        printf("Case-sensitive search found %zu hits\n", hits.size());
+        passing = false;
+    }
+    hits.clear();
+    model->search("alpha", hits, false, true);
+    if(hits.size() != 40*2){
+        printf("Word search found %zu hits\n", hits.size());
+        passing = false;
+    }
+    hits.clear();
+    model->search("a+A", hits, false, false);
+    if(hits.size() != 39){
+        printf("Search across repeats found %zu hits\n", hits.size());
+        passing = false;
+    }
+
+    //The trigram index rules out absent strings, and is refreshed by edits
+    if(model->mayContain("zebra")){
+        printf("Trigram index reports absent string\n");
+        passing = false;
+    }
+    controller.moveToEndOfDocument();
+    controller.insertText(" zebra");
+    hits.clear();
+    Program::instance()->search("ZEBRA", hits, false, false);
+    if(hits.size() != 1){
+        printf("Search after edit missed inserted text\n");
+        passing = false;
+    }
+    model->undo(controller);
+    hits.clear();
+    model->search("zebra", hits, false, false);
+    if(!hits.empty()){
+        printf("Search after undo found removed text\n");
+        passing = false;
+    }
+
+    //Lines appended outside of a command, as for console output, also refresh the index
+    model->appendLine()->front()->setString("quagga");
+    hits.clear();
+    model->search("QUAGGA", hits, false, false);
+    if(hits.size() != 1){
+        printf("Search after appending a line missed its text\n");
+        passing = false;
+    }
+
+    //The index is built from the serial, so a query with a literal construct glyph is escaped to match it
+    Typeset::Model* glyphs = Typeset::Model::fromSerial("xa⁜⏴bc");
+    hits.clear();
+    glyphs->search("a⏴b", hits, false, false);
+    if(!glyphs->mayContain("a⏴b") || hits.size() != 1){
+        printf("Search missed text with a literal construct glyph\n");
+        passing = false;
+    }
+    delete glyphs;
+
+    //The index is sized to the document
+    Typeset::Model* small = Typeset::Model::fromSerial("abc");
+    if(!small->mayContain("abc") || small->mayContain("abd") || small->searchIndexBits() >= model->searchIndexBits()){
+        printf("Trigram index is not sized to the document\n");
+        passing = false;
+    }
+    delete small;
+
+    Program::instance()->freeFileMemory();
+
     #ifndef NDEBUG
     if(!allTypesetElementsFreed()){
         printf("Unfreed typeset elements\n");
@@ -1,5 +1,6 @@
 #include <cassert>
 #include <fstream>
+#include "forscape_document_file.h"
 #include "typeset.h"
 #include <sstream>
 #include <string>
@@ -21,6 +22,151 @@ inline bool testTypesetLoadSave(){
 
     delete model;
 
+    //Output models defer building lines until they are visited
+    model = Forscape::Typeset::Model::fromSerial(input, true);
+    if(model->toSerial() != input){
+        printf("Collapsed output model serial inconsistent\n");
+        passing = false;
+    }
+    std::vector<Forscape::Typeset::Selection> hits;
+    model->search("x", hits, false, false);
+    if(model->toSerial() != input){
+        printf("Expanded output model serial inconsistent\n");
+        passing = false;
+    }
+
+    //Collapsed lines are sized from their serial, and a selection across them builds only the lines it reads
+    const std::string block = "a⁜^⏴2⏵\nb⁜_⏴1⏵ x\nc⁜f⏴x⏵⏴2⏵\nd⁜^⏴x⏵\ne";
+    Forscape::Typeset::Model* collapsed = Forscape::Typeset::Model::fromSerial(block, true);
+    if(collapsed->serialChars() != block.size()){
+        printf("Collapsed output model serial size inconsistent\n");
+        passing = false;
+    }
+    #ifdef TYPESET_MEMORY_DEBUG
+    const size_t constructs_before = Typeset::Construct::all.size();
+    #endif
+    Forscape::Typeset::Text* first = collapsed->firstText();
+    Forscape::Typeset::Text* third = first->getLine()->nextAsserted()->nextAsserted()->front();
+    Forscape::Typeset::Selection sel(Forscape::Typeset::Marker(first, 1), Forscape::Typeset::Marker(third, 1));
+    hits.clear();
+    sel.search("x", hits, false, false);
+    if(hits.size() != 1 || sel.str() != block.substr(1, block.find("\nc") + 1)){
+        printf("Selection across collapsed lines inconsistent\n");
+        passing = false;
+    }
+    #ifdef TYPESET_MEMORY_DEBUG
+    if(Typeset::Construct::all.size() != constructs_before + 3){
+        printf("Selection built collapsed lines outside of it\n");
+        passing = false;
+    }
+    #endif
+    if(collapsed->toSerial() != block){
+        printf("Partially collapsed output model serial inconsistent\n");
+        passing = false;
+    }
+    delete collapsed;
+
+    //Searching builds only the collapsed lines whose serial has a match
+    collapsed = Forscape::Typeset::Model::fromSerial("a⁜^⏴2⏵\nb⁜^⏴x⏵\nc⁜^⏴2⏵", true);
+    #ifdef TYPESET_MEMORY_DEBUG
+    const size_t constructs_before_search = Typeset::Construct::all.size();
+    #endif
+    hits.clear();
+    collapsed->search("x", hits, false, false);
+    if(hits.size() != 1){
+        printf("Search of collapsed output model found %zu hits\n", hits.size());
+        passing = false;
+    }
+    #ifdef TYPESET_MEMORY_DEBUG
+    if(Typeset::Construct::all.size() != constructs_before_search + 1){
+        printf("Search built collapsed lines without a match\n");
+        passing = false;
+    }
+    #endif
+    delete collapsed;
+
+    model->appendSerialToOutput("\n" + input);
+    model->appendSerialToOutput(input);
+    if(model->toSerial() != input + '\n' + input + input){
+        printf("Appended output model serial inconsistent\n");
+        passing = false;
+    }
+    delete model;
+
+    std::filesystem::create_directory("../test/out");
+    const std::string text_path = "../test/out/serial_valid_crlf.π";
+    std::string crlf;
+    for(char ch : input){
+        if(ch == '\n') crlf += '\r';
+        crlf += ch;
+    }
+    std::ofstream(text_path, std::ios::binary) << crlf;
+    {
+        DocumentFile document(std::filesystem::u8path(text_path));
+        if(!document.isOpen() || document.serial() != input){
+            printf("Text document file inconsistent\n");
+            passing = false;
+        }else{
+            model = Forscape::Typeset::Model::fromSerial(document.serial());
+            if(model->toSerial() != input){
+                printf("Document file=>Typeset=>Serial inconsistent\n");
+                passing = false;
+            }
+            delete model;
+        }
+    }
+    {
+        MappedFile mapped(std::filesystem::u8path(text_path));
+        if(!mapped.isOpen() || mapped.bytes() != crlf){
+            printf("Mapped file does not match written file\n");
+            passing = false;
+        }
+    }
+
+    if(DocumentFile(std::filesystem::u8path("../test/out/missing_document.π")).isOpen()){
+        printf("Missing document file opened\n");
+        passing = false;
+    }
+
+    //Nodes are carved from pooled slabs, which are returned once all of their nodes are freed
+    const size_t slabs_before = Typeset::NodePool::numSlabs();
+    std::vector<size_t*> nodes;
+    for(size_t i = 0; i < 10000; i++){
+        nodes.push_back(static_cast<size_t*>(Typeset::NodePool::allocate(48)));
+        *nodes.back() = i;
+    }
+    for(size_t i = 0; i < nodes.size(); i++){
+        if(*nodes[i] != i){
+            printf("Pooled nodes overlap\n");
+            passing = false;
+            break;
+        }
+    }
+    if(Typeset::NodePool::numSlabs() <= slabs_before){
+        printf("Pooled nodes not allocated from new slabs\n");
+        passing = false;
+    }
+    Typeset::NodePool::deallocate(nodes[5000], 48);
+    if(Typeset::NodePool::allocate(48) != nodes[5000]){
+        printf("Freed pooled node not reused\n");
+        passing = false;
+    }
+    for(size_t* node : nodes) Typeset::NodePool::deallocate(node, 48);
+    if(Typeset::NodePool::numSlabs() > slabs_before + 1){
+        printf("Empty slabs not released\n");
+        passing = false;
+    }
+
+    std::string large;
+    for(size_t i = 0; i < 200; i++) large += input + '\n';
+    model = Forscape::Typeset::Model::fromSerial(large);
+    const size_t slabs_loaded = Typeset::NodePool::numSlabs();
+    delete model;
+    if(Typeset::NodePool::numSlabs() - slabs_before > (slabs_loaded - slabs_before) / 2){
+        printf("Slabs of a deleted document not released\n");
+        passing = false;
+    }
+
     #ifndef NDEBUG
     if(!allTypesetElementsFreed()){
         printf("Unfreed typeset elements\n");
@@ -6,6 +6,67 @@
 
 using namespace Forscape;
 
+#ifndef FORSCAPE_TYPESET_HEADLESS
+inline void appendLayout(const Typeset::Phrase* p, std::vector<double>& dims){
+    dims.insert(dims.end(), {p->width, p->above_center, p->under_center, p->x, p->y});
+    for(size_t i = 0; i < p->numTexts(); i++)
+        dims.insert(dims.end(), {p->text(i)->x, p->text(i)->y, p->text(i)->getWidth()});
+    for(size_t i = 0; i < p->numConstructs(); i++){
+        const Typeset::Construct* c = p->construct(i);
+        dims.insert(dims.end(), {c->width, c->above_center, c->under_center, c->x, c->y});
+        for(size_t j = 0; j < c->numArgs(); j++) appendLayout(c->arg(j), dims);
+    }
+}
+
+inline std::vector<double> layoutOf(const Typeset::Model* model){
+    std::vector<double> dims;
+    for(const Typeset::Line* l = model->firstText()->getLine(); l; l = l->next()) appendLayout(l, dims);
+    return dims;
+}
+
+inline bool testIncrementalLayout(){
+    bool passing = true;
+
+    Typeset::Model* model = Typeset::Model::fromSerial(
+        "a = ⁜f⏴1⏵⏴2⏵ + b⁜^⏴2⏵\nc = 3\nd = ⁜{2⏴1⏵⏴x = 0⏵⏴0⏵⏴x ≠ 0⏵\ne");
+    Typeset::Controller controller(model);
+
+    //Repeated edits to a phrase which is already stale should still reach the line
+    controller.moveToEndOfLine();
+    controller.moveToPrevChar();
+    controller.insertText("3");
+    controller.insertText("4");
+    model->updateLayout();
+    controller.insertText("5");
+    model->updateLayout();
+
+    controller.moveToEndOfDocument();
+    controller.newline();
+    controller.insertSerial("⁜f⏴q⏵⏴r⏵");
+    controller.moveToPrevChar();
+    controller.insertText("s");
+    controller.insertText("t");
+    model->updateLayout();
+
+    controller.moveToStartOfDocument();
+    controller.del();
+    controller.newline();
+    model->updateLayout();
+
+    const std::vector<double> incremental = layoutOf(model);
+    model->calculateSizes();
+    model->updateLayout();
+    if(layoutOf(model) != incremental){
+        printf("Incremental layout differs from a full recompute\n");
+        passing = false;
+    }
+
+    delete model;
+
+    return passing;
+}
+#endif
+
 inline bool testTypesetMutability(){
     bool passing = true;
 
@@ -110,8 +171,105 @@ inline bool testTypesetMutability(){
         passing = false;
     }
 
+    model->path = "saved.π";
+    controller.insertText("s");
+    model->markSaved();
+    controller.insertText("t");
+
+    if(model->isSaved()){
+        printf("Edit after save not detected\n");
+        passing = false;
+    }
+
+    model->undo(controller);
+
+    if(!model->isSaved()){
+        printf("Undo to save point not detected\n");
+        passing = false;
+    }
+
+    model->undo(controller);
+    model->redo(controller);
+
+    if(!model->isSaved()){
+        printf("Redo to save point not detected\n");
+        passing = false;
+    }
+
+    model->undo(controller);
+    controller.insertText("x");
+    model->undo(controller);
+
+    if(model->isSaved()){
+        printf("Discarded save point not detected\n");
+        passing = false;
+    }
+
+    controller.selectAll();
+    controller.insertText("alpha beta gamma");
+    controller.backspaceWord();
+    controller.backspaceWord();
+    controller.backspaceWord();
+
+    if(model->toSerial() != "alpha "){
+        printf("Repeated backspace word failed\n");
+        passing = false;
+    }
+
+    model->undo(controller);
+
+    if(model->toSerial() != "alpha beta gamma"){
+        printf("Undo of consecutive word deletions not merged\n");
+        passing = false;
+    }
+
+    controller.moveToEndOfDocument();
+    controller.newline();
+    controller.insertText("a");
+    controller.insertText("b");
+    controller.insertText("c");
+    controller.backspace();
+    controller.insertText("d");
+
+    if(model->toSerial() != "alpha beta gamma\nabd"){
+        printf("Correcting a typed run failed\n");
+        passing = false;
+    }
+
+    model->undo(controller);
+
+    if(model->toSerial() != "alpha beta gamma\n"){
+        printf("Undo of a corrected typed run not merged\n");
+        passing = false;
+    }
+
+    model->undo(controller);
+
+    model->history_budget = 1024;
+    for(size_t i = 0; i < 200; i++){
+        controller.insertText("z");
+        controller.moveToPrevChar();
+    }
+
+    size_t undo_steps = 0;
+    while(model->undoAvailable()){
+        model->undo(controller);
+        undo_steps++;
+    }
+
+    if(undo_steps >= 200 || model->historyBytes() > model->history_budget){
+        printf("History budget not enforced\n");
+        passing = false;
+    }
+    model->history_budget = Typeset::Model::DEFAULT_HISTORY_BUDGET;
+
+    model->path.clear();
     delete model;
 
+    #ifndef FORSCAPE_TYPESET_HEADLESS
+    passing &= testIncrementalLayout();
+    #endif
+
     #ifndef NDEBUG
     if(!allTypesetElementsFreed()){
         printf("Unfreed typeset elements\n");